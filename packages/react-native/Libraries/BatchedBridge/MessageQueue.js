@@ -12,6 +12,7 @@
 
 const Systrace = require('../Performance/Systrace');
 const deepFreezeAndThrowOnMutationInDev = require('../Utilities/deepFreezeAndThrowOnMutationInDev');
+const encodeBinaryQueue = require('./encodeBinaryQueue');
 const stringifySafe = require('../Utilities/stringifySafe').default;
 const warnOnce = require('../Utilities/warnOnce');
 const ErrorUtils = require('../vendor/core/ErrorUtils');
@@ -25,6 +26,11 @@ export type SpyData = {
   ...
 };
 
+type Queue = [Array<number>, Array<number>, Array<mixed>, number];
+
+// Native hands over binary queues when it supports them.
+export type FlushedQueue = Queue | ArrayBuffer;
+
 const TO_JS = 0;
 const TO_NATIVE = 1;
 
@@ -40,7 +46,7 @@ const DEBUG_INFO_LIMIT = 32;
 
 class MessageQueue {
   _lazyCallableModules: {[key: string]: (void) => {...}, ...};
-  _queue: [number[], number[], mixed[], number];
+  _queue: Queue;
   _successCallbacks: Map<number, ?(...mixed[]) => void>;
   _failureCallbacks: Map<number, ?(...mixed[]) => void>;
   _callID: number;
@@ -108,7 +114,7 @@ class MessageQueue {
     module: string,
     method: string,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): null | FlushedQueue {
     this.__guard(() => {
       this.__callFunction(module, method, args);
     });
@@ -119,7 +125,7 @@ class MessageQueue {
   invokeCallbackAndReturnFlushedQueue(
     cbID: number,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): null | FlushedQueue {
     this.__guard(() => {
       this.__invokeCallback(cbID, args);
     });
@@ -127,14 +133,14 @@ class MessageQueue {
     return this.flushedQueue();
   }
 
-  flushedQueue(): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  flushedQueue(): null | FlushedQueue {
     this.__guard(() => {
       this.__callReactNativeMicrotasks();
     });
 
     const queue = this._queue;
     this._queue = [[], [], [], this._callID];
-    return queue[0].length ? queue : null;
+    return queue[0].length ? toFlushedQueue(queue) : null;
   }
 
   getEventLoopRunningTime(): number {
@@ -317,7 +323,7 @@ class MessageQueue {
       const queue = this._queue;
       this._queue = [[], [], [], this._callID];
       this._lastFlush = now;
-      global.nativeFlushQueueImmediate(queue);
+      global.nativeFlushQueueImmediate(toFlushedQueue(queue));
     }
     Systrace.counterEvent('pending_js_to_native_queue', this._queue[0].length);
     if (__DEV__ && this.__spy && isFinite(moduleID)) {
@@ -489,4 +495,10 @@ class MessageQueue {
   }
 }
 
+function toFlushedQueue(queue: Queue): FlushedQueue {
+  return global.__nativeBinaryCallQueue === true
+    ? encodeBinaryQueue(queue)
+    : queue;
+}
+
 module.exports = MessageQueue;
@@ -161,4 +161,27 @@ describe('MessageQueue', function () {
     queue.callFunctionReturnFlushedQueue(name, 'dummy', []);
     expect(queue.__shouldPauseOnThrow).toHaveBeenCalledTimes(2);
   });
+
+  it('should flush binary queues when native supports them', () => {
+    global.__nativeBinaryCallQueue = true;
+    try {
+      queue.enqueueNativeCall(3, 1, ['é', {a: 1, b: undefined}]);
+      const flushedQueue = queue.flushedQueue();
+      expect(flushedQueue).toBeInstanceOf(ArrayBuffer);
+      expect(Array.from(new Uint8Array(flushedQueue))).toEqual([
+        // 1 call, first call id 0
+        1, 0, 0, 0, 0, 0, 0, 0,
+        // module 3, method 1, 31 bytes of arguments
+        3, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0,
+        // an array of 2 values
+        5, 2, 0, 0, 0,
+        // the 2-byte string 'é'
+        4, 2, 0, 0, 0, 0xc3, 0xa9,
+        // an object with the 1-byte key 'a' and the number 1
+        6, 1, 0, 0, 0, 1, 0, 0, 0, 0x61, 3, 0, 0, 0, 0, 0, 0, 0xf0, 0x3f,
+      ]);
+    } finally {
+      delete global.__nativeBinaryCallQueue;
+    }
+  });
 });
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict
+ * @format
+ */
+
+'use strict';
+
+// Value types, see parseEncodedMethodCalls in ReactCommon/cxxreact.
+const NULL = 0;
+const FALSE = 1;
+const TRUE = 2;
+const NUMBER = 3;
+const STRING = 4;
+const ARRAY = 5;
+const OBJECT = 6;
+
+const INITIAL_CAPACITY = 1024;
+
+class BinaryQueueWriter {
+  _buffer: ArrayBuffer;
+  _bytes: Uint8Array;
+  _view: DataView;
+  _offset: number;
+
+  constructor(capacity: number) {
+    this._buffer = new ArrayBuffer(capacity);
+    this._bytes = new Uint8Array(this._buffer);
+    this._view = new DataView(this._buffer);
+    this._offset = 0;
+  }
+
+  getOffset(): number {
+    return this._offset;
+  }
+
+  finish(): ArrayBuffer {
+    return this._buffer.slice(0, this._offset);
+  }
+
+  reserve(size: number): number {
+    const offset = this._offset;
+    const required = offset + size;
+    if (required > this._buffer.byteLength) {
+      const buffer = new ArrayBuffer(
+        Math.max(required, this._buffer.byteLength * 2),
+      );
+      const bytes = new Uint8Array(buffer);
+      bytes.set(this._bytes.subarray(0, offset));
+      this._buffer = buffer;
+      this._bytes = bytes;
+      this._view = new DataView(buffer);
+    }
+    this._offset = required;
+    return offset;
+  }
+
+  writeUint8(value: number): void {
+    this._bytes[this.reserve(1)] = value;
+  }
+
+  writeUint32(value: number): void {
+    this._view.setUint32(this.reserve(4), value, true);
+  }
+
+  setUint32(offset: number, value: number): void {
+    this._view.setUint32(offset, value, true);
+  }
+
+  writeInt32(value: number): void {
+    this._view.setInt32(this.reserve(4), value, true);
+  }
+
+  writeFloat64(value: number): void {
+    this._view.setFloat64(this.reserve(8), value, true);
+  }
+
+  // Writes the size and UTF-8 bytes of the string. Lone surrogates become
+  // U+FFFD, like when JSI converts strings.
+  writeString(value: string): void {
+    const sizeOffset = this.reserve(4);
+    // UTF-16 code units take at most 3 UTF-8 bytes.
+    let offset = this.reserve(value.length * 3);
+    const bytes = this._bytes;
+    for (let i = 0; i < value.length; i++) {
+      let code = value.charCodeAt(i);
+      if (code < 0x80) {
+        bytes[offset++] = code;
+        continue;
+      }
+      if (code < 0x800) {
+        bytes[offset++] = 0xc0 | (code >> 6);
+        bytes[offset++] = 0x80 | (code & 0x3f);
+        continue;
+      }
+      if (code >= 0xd800 && code <= 0xdfff) {
+        const next = i + 1 < value.length ? value.charCodeAt(i + 1) : 0;
+        if (code <= 0xdbff && next >= 0xdc00 && next <= 0xdfff) {
+          code = 0x10000 + ((code - 0xd800) << 10) + (next - 0xdc00);
+          i++;
+          bytes[offset++] = 0xf0 | (code >> 18);
+          bytes[offset++] = 0x80 | ((code >> 12) & 0x3f);
+          bytes[offset++] = 0x80 | ((code >> 6) & 0x3f);
+          bytes[offset++] = 0x80 | (code & 0x3f);
+          continue;
+        }
+        code = 0xfffd;
+      }
+      bytes[offset++] = 0xe0 | (code >> 12);
+      bytes[offset++] = 0x80 | ((code >> 6) & 0x3f);
+      bytes[offset++] = 0x80 | (code & 0x3f);
+    }
+    this._offset = offset;
+    this.setUint32(sizeOffset, offset - sizeOffset - 4);
+  }
+
+  // Converts values the way JSIDynamic does: undefined becomes null, as do
+  // functions in objects, and undefined properties are skipped.
+  writeValue(value: mixed): void {
+    switch (typeof value) {
+      case 'undefined':
+        this.writeUint8(NULL);
+        return;
+      case 'boolean':
+        this.writeUint8(value ? TRUE : FALSE);
+        return;
+      case 'number':
+        this.writeUint8(NUMBER);
+        this.writeFloat64(value);
+        return;
+      case 'string':
+        this.writeUint8(STRING);
+        this.writeString(value);
+        return;
+      case 'object':
+        if (value == null) {
+          this.writeUint8(NULL);
+        } else if (Array.isArray(value)) {
+          this.writeUint8(ARRAY);
+          this.writeUint32(value.length);
+          for (let i = 0; i < value.length; i++) {
+            this.writeValue(value[i]);
+          }
+        } else {
+          this.writeUint8(OBJECT);
+          const countOffset = this.reserve(4);
+          let count = 0;
+          for (const key in value) {
+            const property = value[key];
+            if (property === undefined) {
+              continue;
+            }
+            this.writeString(key);
+            this.writeValue(typeof property === 'function' ? null : property);
+            count++;
+          }
+          this.setUint32(countOffset, count);
+        }
+        return;
+      default:
+        throw new Error(
+          `Values of type ${typeof value} can't be passed to native modules`,
+        );
+    }
+  }
+}
+
+/**
+ * Encodes a batch of native calls, as built by MessageQueue, in the binary
+ * call queue format that JSIExecutor reads without materializing the
+ * arguments of every call.
+ */
+function encodeBinaryQueue(
+  queue: [Array<number>, Array<number>, Array<mixed>, number],
+): ArrayBuffer {
+  const [moduleIDs, methodIDs, params, callID] = queue;
+  const writer = new BinaryQueueWriter(INITIAL_CAPACITY);
+  writer.writeUint32(moduleIDs.length);
+  writer.writeInt32(callID);
+  for (let i = 0; i < moduleIDs.length; i++) {
+    writer.writeUint32(moduleIDs[i]);
+    writer.writeUint32(methodIDs[i]);
+    const sizeOffset = writer.reserve(4);
+    writer.writeValue(params[i]);
+    writer.setUint32(sizeOffset, writer.getOffset() - sizeOffset - 4);
+  }
+  return writer.finish();
+}
+
+module.exports = encodeBinaryQueue;
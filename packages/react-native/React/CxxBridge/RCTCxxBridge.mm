@@ -150,6 +150,10 @@ static void mapReactMarkerToPerformanceLogger(
       // Not needed in bridge mode.
     case ReactMarker::REACT_INSTANCE_INIT_START:
     case ReactMarker::REACT_INSTANCE_INIT_STOP:
+    case ReactMarker::PREPARE_JS_BUNDLE_START:
+    case ReactMarker::PREPARE_JS_BUNDLE_STOP:
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_START:
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_STOP:
       // Not used on iOS.
     case ReactMarker::CREATE_REACT_CONTEXT_STOP:
     case ReactMarker::JS_BUNDLE_STRING_CONVERT_START:
@@ -92,6 +92,10 @@ public enum ReactMarkerConstants {
   CREATE_MC_MODULE_GET_METADATA_END,
   REGISTER_JS_SEGMENT_START(true),
   REGISTER_JS_SEGMENT_STOP(true),
+  PREPARE_JS_BUNDLE_START,
+  PREPARE_JS_BUNDLE_END,
+  INSTALL_RUNTIME_BINDINGS_START,
+  INSTALL_RUNTIME_BINDINGS_END,
   VM_INIT,
   ON_FRAGMENT_CREATE,
   JAVASCRIPT_EXECUTOR_FACTORY_INJECT_START,
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<90dcb658c018c8007953964b24b84278>>
+ * @generated SignedSource<<d2388ef70b4dd1763d30658b211383a0>>
  */
 
 /**
@@ -70,6 +70,12 @@ public object ReactNativeFeatureFlags {
   @JvmStatic
   public fun enableAndroidLineHeightCentering(): Boolean = accessor.enableAndroidLineHeightCentering()
 
+  /**
+   * Enables handing native module calls over from JavaScript to JSIExecutor as ArrayBuffers instead of arrays of JS values.
+   */
+  @JvmStatic
+  public fun enableBinaryNativeCallQueue(): Boolean = accessor.enableBinaryNativeCallQueue()
+
   /**
    * Feature flag to enable the new bridgeless architecture. Note: Enabling this will force enable the following flags: `useTurboModules` & `enableFabricRenderer.
    */
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<ad976a93c28bf6e46dfd7ed1ba0493ed>>
+ * @generated SignedSource<<b1dacdeca7ced6121307c58737e1af82>>
  */
 
 /**
@@ -27,6 +27,7 @@ public class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAccesso
   private var enableAccumulatedUpdatesInRawPropsAndroidCache: Boolean? = null
   private var enableAlignItemsBaselineOnFabricIOSCache: Boolean? = null
   private var enableAndroidLineHeightCenteringCache: Boolean? = null
+  private var enableBinaryNativeCallQueueCache: Boolean? = null
   private var enableBridgelessArchitectureCache: Boolean? = null
   private var enableCppPropsIteratorSetterCache: Boolean? = null
   private var enableDeletionOfUnmountedViewsCache: Boolean? = null
@@ -132,6 +133,15 @@ public class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAccesso
     return cached
   }
 
+  override fun enableBinaryNativeCallQueue(): Boolean {
+    var cached = enableBinaryNativeCallQueueCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enableBinaryNativeCallQueue()
+      enableBinaryNativeCallQueueCache = cached
+    }
+    return cached
+  }
+
   override fun enableBridgelessArchitecture(): Boolean {
     var cached = enableBridgelessArchitectureCache
     if (cached == null) {
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<2e766bcc58b8d6b0fb605ee71520dd2e>>
+ * @generated SignedSource<<5baafaafc35111580b6efb9c5b204191>>
  */
 
 /**
@@ -42,6 +42,8 @@ public object ReactNativeFeatureFlagsCxxInterop {
 
   @DoNotStrip @JvmStatic public external fun enableAndroidLineHeightCentering(): Boolean
 
+  @DoNotStrip @JvmStatic public external fun enableBinaryNativeCallQueue(): Boolean
+
   @DoNotStrip @JvmStatic public external fun enableBridgelessArchitecture(): Boolean
 
   @DoNotStrip @JvmStatic public external fun enableCppPropsIteratorSetter(): Boolean
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<d21071fcbf501d1e7aba6b227ef74351>>
+ * @generated SignedSource<<3d7737d4f573b2b1e7c3b1a7614c260f>>
  */
 
 /**
@@ -37,6 +37,8 @@ public open class ReactNativeFeatureFlagsDefaults : ReactNativeFeatureFlagsProvi
 
   override fun enableAndroidLineHeightCentering(): Boolean = true
 
+  override fun enableBinaryNativeCallQueue(): Boolean = false
+
   override fun enableBridgelessArchitecture(): Boolean = false
 
   override fun enableCppPropsIteratorSetter(): Boolean = false
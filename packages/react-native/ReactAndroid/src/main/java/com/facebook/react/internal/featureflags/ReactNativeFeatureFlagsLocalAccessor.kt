@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<f56022e0738217726e5e7b938666b56e>>
+ * @generated SignedSource<<fb0fca41f87395d5cfa11d8fcc616b1d>>
  */
 
 /**
@@ -31,6 +31,7 @@ public class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcces
   private var enableAccumulatedUpdatesInRawPropsAndroidCache: Boolean? = null
   private var enableAlignItemsBaselineOnFabricIOSCache: Boolean? = null
   private var enableAndroidLineHeightCenteringCache: Boolean? = null
+  private var enableBinaryNativeCallQueueCache: Boolean? = null
   private var enableBridgelessArchitectureCache: Boolean? = null
   private var enableCppPropsIteratorSetterCache: Boolean? = null
   private var enableDeletionOfUnmountedViewsCache: Boolean? = null
@@ -143,6 +144,16 @@ public class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcces
     return cached
   }
 
+  override fun enableBinaryNativeCallQueue(): Boolean {
+    var cached = enableBinaryNativeCallQueueCache
+    if (cached == null) {
+      cached = currentProvider.enableBinaryNativeCallQueue()
+      accessedFeatureFlags.add("enableBinaryNativeCallQueue")
+      enableBinaryNativeCallQueueCache = cached
+    }
+    return cached
+  }
+
   override fun enableBridgelessArchitecture(): Boolean {
     var cached = enableBridgelessArchitectureCache
     if (cached == null) {
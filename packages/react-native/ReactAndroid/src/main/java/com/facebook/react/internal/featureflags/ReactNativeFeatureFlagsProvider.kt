@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<94d6ce778ccf52a7f7b2ab574b1c9547>>
+ * @generated SignedSource<<ebaf4b7efc3ed0374560c2a19683f110>>
  */
 
 /**
@@ -37,6 +37,8 @@ public interface ReactNativeFeatureFlagsProvider {
 
   @DoNotStrip public fun enableAndroidLineHeightCentering(): Boolean
 
+  @DoNotStrip public fun enableBinaryNativeCallQueue(): Boolean
+
   @DoNotStrip public fun enableBridgelessArchitecture(): Boolean
 
   @DoNotStrip public fun enableCppPropsIteratorSetter(): Boolean
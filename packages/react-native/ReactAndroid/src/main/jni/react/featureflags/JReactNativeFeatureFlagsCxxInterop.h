@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<bc53fc826ce10cd270fe71ebaefc9ad8>>
+ * @generated SignedSource<<e40fad161fdf6d02da2a235865200e08>>
  */
 
 /**
@@ -51,6 +51,9 @@ class JReactNativeFeatureFlagsCxxInterop
   static bool enableAndroidLineHeightCentering(
     facebook::jni::alias_ref<JReactNativeFeatureFlagsCxxInterop>);
 
+  static bool enableBinaryNativeCallQueue(
+    facebook::jni::alias_ref<JReactNativeFeatureFlagsCxxInterop>);
+
   static bool enableBridgelessArchitecture(
     facebook::jni::alias_ref<JReactNativeFeatureFlagsCxxInterop>);
 
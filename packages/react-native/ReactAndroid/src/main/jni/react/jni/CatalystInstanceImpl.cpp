@@ -19,6 +19,7 @@
 #include <cxxreact/JSIndexedRAMBundle.h>
 #include <cxxreact/MethodCall.h>
 #include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModuleWorkerPool.h>
 #include <cxxreact/RAMBundleRegistry.h>
 #include <cxxreact/RecoverableError.h>
 #include <fb/log.h>
@@ -189,11 +190,23 @@ void CatalystInstanceImpl::initializeBridge(
   // don't need jsModuleDescriptions any more, all the way up and down the
   // stack.
 
+  // Thread safe C++ modules run their calls in parallel there, its threads
+  // are only started if there are any. Their errors are rethrown on the
+  // native modules thread, to be handled like those of the other modules.
+  nativeModuleWorkerPool_ = std::make_shared<NativeModuleWorkerPool>(
+      NativeModuleWorkerPool::getDefaultThreadCount(),
+      [moduleMessageQueue = moduleMessageQueue_](std::exception_ptr error) {
+        moduleMessageQueue->runOnQueue(
+            [error]() { std::rethrow_exception(error); });
+      });
+
   moduleRegistry_ = std::make_shared<ModuleRegistry>(buildNativeModuleList(
       std::weak_ptr<Instance>(instance_),
       javaModules,
       cxxModules,
-      moduleMessageQueue_));
+      moduleMessageQueue_,
+      nativeModuleWorkerPool_));
+  moduleRegistry_->setWorkerPool(nativeModuleWorkerPool_);
 
   instance_->initializeBridge(
       std::make_unique<InstanceCallbackImpl>(callback),
@@ -214,7 +227,8 @@ void CatalystInstanceImpl::extendNativeModules(
       std::weak_ptr<Instance>(instance_),
       javaModules,
       cxxModules,
-      moduleMessageQueue_));
+      moduleMessageQueue_,
+      nativeModuleWorkerPool_));
 }
 
 void CatalystInstanceImpl::jniSetSourceURL(const std::string& sourceURL) {
@@ -117,6 +117,7 @@ class CatalystInstanceImpl : public jni::HybridClass<CatalystInstanceImpl> {
   std::shared_ptr<Instance> instance_;
   std::shared_ptr<ModuleRegistry> moduleRegistry_;
   std::shared_ptr<JMessageQueueThread> moduleMessageQueue_;
+  std::shared_ptr<NativeModuleWorkerPool> nativeModuleWorkerPool_;
   jni::global_ref<CallInvokerHolder::javaobject> jsCallInvokerHolder_;
   jni::global_ref<NativeMethodCallInvokerHolder::javaobject>
       nativeMethodCallInvokerHolder_;
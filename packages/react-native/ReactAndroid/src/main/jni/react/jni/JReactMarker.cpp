@@ -29,6 +29,14 @@ void JReactMarker::logMarker(const std::string& marker) {
   meth(cls, marker);
 }
 
+void JReactMarker::logMarker(
+    const std::string& marker,
+    const int instanceKey) {
+  static auto cls = javaClassStatic();
+  static auto meth = cls->getStaticMethod<void(std::string, int)>("logMarker");
+  meth(cls, marker, instanceKey);
+}
+
 void JReactMarker::logMarker(
     const std::string& marker,
     const std::string& tag) {
@@ -106,6 +114,18 @@ void JReactMarker::logPerfMarkerWithInstanceKey(
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
       JReactMarker::logMarker("REGISTER_JS_SEGMENT_STOP", tag, instanceKey);
       break;
+    case ReactMarker::PREPARE_JS_BUNDLE_START:
+      JReactMarker::logMarker("PREPARE_JS_BUNDLE_START", instanceKey);
+      break;
+    case ReactMarker::PREPARE_JS_BUNDLE_STOP:
+      JReactMarker::logMarker("PREPARE_JS_BUNDLE_END", instanceKey);
+      break;
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_START:
+      JReactMarker::logMarker("INSTALL_RUNTIME_BINDINGS_START", instanceKey);
+      break;
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_STOP:
+      JReactMarker::logMarker("INSTALL_RUNTIME_BINDINGS_END", instanceKey);
+      break;
     case ReactMarker::NATIVE_REQUIRE_START:
     case ReactMarker::NATIVE_REQUIRE_STOP:
     case ReactMarker::REACT_INSTANCE_INIT_START:
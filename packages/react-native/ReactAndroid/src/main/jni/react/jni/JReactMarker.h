@@ -23,6 +23,7 @@ class JReactMarker : public facebook::jni::JavaClass<JReactMarker> {
 
  private:
   static void logMarker(const std::string& marker);
+  static void logMarker(const std::string& marker, const int instanceKey);
   static void logMarker(const std::string& marker, const std::string& tag);
   static void logMarker(
       const std::string& marker,
@@ -46,7 +46,8 @@ std::vector<std::unique_ptr<NativeModule>> buildNativeModuleList(
         javaModules,
     jni::alias_ref<jni::JCollection<ModuleHolder::javaobject>::javaobject>
         cxxModules,
-    std::shared_ptr<MessageQueueThread> moduleMessageQueue) {
+    std::shared_ptr<MessageQueueThread> moduleMessageQueue,
+    std::shared_ptr<NativeModuleWorkerPool> workerPool) {
   std::vector<std::unique_ptr<NativeModule>> modules;
   if (javaModules) {
     for (const auto& jm : *javaModules) {
@@ -61,7 +62,8 @@ std::vector<std::unique_ptr<NativeModule>> buildNativeModuleList(
           winstance,
           moduleName,
           cm->getProvider(moduleName),
-          moduleMessageQueue));
+          moduleMessageQueue,
+          workerPool));
     }
   }
   return modules;
@@ -17,6 +17,7 @@
 namespace facebook::react {
 
 class MessageQueueThread;
+class NativeModuleWorkerPool;
 
 class ModuleHolder : public jni::JavaClass<ModuleHolder> {
  public:
@@ -34,5 +35,6 @@ std::vector<std::unique_ptr<NativeModule>> buildNativeModuleList(
         javaModules,
     jni::alias_ref<jni::JCollection<ModuleHolder::javaobject>::javaobject>
         cxxModules,
-    std::shared_ptr<MessageQueueThread> moduleMessageQueue);
+    std::shared_ptr<MessageQueueThread> moduleMessageQueue,
+    std::shared_ptr<NativeModuleWorkerPool> workerPool = nullptr);
 } // namespace facebook::react
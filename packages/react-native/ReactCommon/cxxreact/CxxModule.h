@@ -228,6 +228,16 @@ class CxxModule {
    */
   virtual auto getMethods() -> std::vector<Method> = 0;
 
+  /**
+   * @return whether the methods of this module can run concurrently with
+   * those of other modules. If so, and the bridge has a worker pool, they run
+   * there rather than on the module's message queue thread, still one call at
+   * a time and in order.
+   */
+  virtual bool isThreadSafe() {
+    return false;
+  }
+
   /**
    *  Called during the construction of CxxNativeModule.
    */
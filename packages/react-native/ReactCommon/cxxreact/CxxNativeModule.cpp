@@ -14,6 +14,7 @@
 
 #include "JsArgumentHelpers.h"
 #include "MessageQueueThread.h"
+#include "NativeModuleWorkerPool.h"
 #include "SystraceSection.h"
 
 #include <logger/react_native_log.h>
@@ -256,6 +257,10 @@ void CxxNativeModule::lazyInit() {
   if (module_) {
     module_->setInstance(instance_);
     methods_ = module_->getMethods();
+    auto workerPool = workerPool_.lock();
+    if (workerPool && module_->isThreadSafe()) {
+      messageQueueThread_ = workerPool->createQueue();
+    }
   }
 }
 
@@ -18,6 +18,7 @@ namespace facebook::react {
 
 class Instance;
 class MessageQueueThread;
+class NativeModuleWorkerPool;
 
 typedef void (*WarnOnUsageLogger)(std::string message);
 
@@ -31,11 +32,13 @@ class RN_EXPORT CxxNativeModule : public NativeModule {
       std::weak_ptr<Instance> instance,
       std::string name,
       xplat::module::CxxModule::Provider provider,
-      std::shared_ptr<MessageQueueThread> messageQueueThread)
+      std::shared_ptr<MessageQueueThread> messageQueueThread,
+      std::shared_ptr<NativeModuleWorkerPool> workerPool = nullptr)
       : instance_(instance),
         name_(std::move(name)),
         provider_(provider),
-        messageQueueThread_(messageQueueThread) {}
+        messageQueueThread_(messageQueueThread),
+        workerPool_(workerPool) {}
 
   std::string getName() override;
   std::string getSyncMethodName(unsigned int methodId) override;
@@ -56,6 +59,8 @@ class RN_EXPORT CxxNativeModule : public NativeModule {
   std::string name_;
   xplat::module::CxxModule::Provider provider_;
   std::shared_ptr<MessageQueueThread> messageQueueThread_;
+  // Owned by the registry, which stops it before destroying the modules.
+  std::weak_ptr<NativeModuleWorkerPool> workerPool_;
   std::unique_ptr<xplat::module::CxxModule> module_;
   std::vector<xplat::module::CxxModule::Method> methods_;
   void emitWarnIfWarnOnUsage(
@@ -9,6 +9,8 @@
 
 #include <folly/Exception.h>
 
+#include <memory>
+
 #ifndef RN_EXPORT
 #ifdef _MSC_VER
 #define RN_EXPORT
@@ -106,6 +108,35 @@ class RN_EXPORT JSBigBufferString : public JSBigString {
   size_t m_size;
 };
 
+// JSBigString implementation which refers to a part of another JSBigString,
+// sharing ownership of it. The part must be followed by a \0 byte in the
+// other string.
+class RN_EXPORT JSBigStringSlice : public JSBigString {
+ public:
+  JSBigStringSlice(
+      std::shared_ptr<const JSBigString> string,
+      size_t offset,
+      size_t size)
+      : m_string(std::move(string)), m_offset(offset), m_size(size) {}
+
+  bool isAscii() const override {
+    return m_string->isAscii();
+  }
+
+  const char* c_str() const override {
+    return m_string->c_str() + m_offset;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> m_string;
+  size_t m_offset;
+  size_t m_size;
+};
+
 // JSBigString interface implemented by a file-backed mmap region.
 class RN_EXPORT JSBigFileString : public JSBigString {
  public:
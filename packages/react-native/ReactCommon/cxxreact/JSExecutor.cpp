@@ -7,6 +7,7 @@
 
 #include "JSExecutor.h"
 
+#include "MethodCall.h"
 #include "RAMBundleRegistry.h"
 
 #include <folly/Conv.h>
@@ -17,6 +18,31 @@
 
 namespace facebook::react {
 
+void ExecutorDelegate::callNativeModules(
+    JSExecutor& executor,
+    const uint8_t* calls,
+    size_t size,
+    bool isEndOfBatch) {
+  // Delegates that don't handle binary calls get them as JSON calls.
+  auto methodCalls = parseEncodedMethodCalls(calls, size);
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (const auto& call : methodCalls) {
+    moduleIds.push_back(call.moduleId);
+    methodIds.push_back(call.methodId);
+    params.push_back(call.arguments.decode());
+  }
+  auto jsonCalls = methodCalls.empty()
+      ? folly::dynamic(nullptr)
+      : folly::dynamic::array(
+            std::move(moduleIds),
+            std::move(methodIds),
+            std::move(params),
+            methodCalls.front().callId);
+  callNativeModules(executor, std::move(jsonCalls), isEndOfBatch);
+}
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string& bundlePath) {
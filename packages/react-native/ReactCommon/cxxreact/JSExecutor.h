@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -40,6 +42,13 @@ class ExecutorDelegate {
       JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) = 0;
+  // Calls in the binary format of parseEncodedMethodCalls. The data is only
+  // valid for the duration of the call.
+  virtual void callNativeModules(
+      JSExecutor& executor,
+      const uint8_t* calls,
+      size_t size,
+      bool isEndOfBatch);
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor& executor,
       unsigned int moduleId,
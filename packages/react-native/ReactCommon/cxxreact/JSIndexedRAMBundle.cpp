@@ -7,10 +7,13 @@
 
 #include "JSIndexedRAMBundle.h"
 
+#include <folly/portability/SysMman.h>
+#include <folly/portability/Unistd.h>
 #include <glog/logging.h>
-#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <ios>
 #include <memory>
-#include <sstream>
 
 namespace facebook::react {
 
@@ -21,27 +24,14 @@ JSIndexedRAMBundle::buildFactory() {
   };
 }
 
-JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath) {
-  m_bundle = std::make_unique<std::ifstream>(sourcePath, std::ifstream::binary);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle ", sourcePath, "cannot be opened: ", m_bundle->rdstate()));
-  }
+JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath)
+    : m_bundle(JSBigFileString::fromPath(sourcePath)) {
   init();
 }
 
 JSIndexedRAMBundle::JSIndexedRAMBundle(
-    std::unique_ptr<const JSBigString> script) {
-  // tmpStream is needed because m_bundle is std::istream type
-  // which has no member 'write'
-  std::unique_ptr<std::stringstream> tmpStream =
-      std::make_unique<std::stringstream>();
-  tmpStream->write(script->c_str(), script->size());
-  m_bundle = std::move(tmpStream);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle from string cannot be opened: ", m_bundle->rdstate()));
-  }
+    std::unique_ptr<const JSBigString> script)
+    : m_bundle(std::move(script)) {
   init();
 }
 
@@ -52,77 +42,147 @@ void JSIndexedRAMBundle::init() {
       sizeof(header) == 12,
       "header size must exactly match the input file format");
 
-  readBundle(reinterpret_cast<char*>(header), sizeof(header));
+  readBundle(reinterpret_cast<char*>(header), sizeof(header), 0);
   const size_t numTableEntries = folly::Endian::little(header[1]);
   const size_t startupCodeSize = folly::Endian::little(header[2]);
 
+  if (numTableEntries * sizeof(ModuleData) > m_bundle->size()) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
+
   // allocate memory for meta data and lookup table.
   m_table = ModuleTable(numTableEntries);
   m_baseOffset = sizeof(header) + m_table.byteLength();
 
-  // read the lookup table from the file
-  readBundle(reinterpret_cast<char*>(m_table.data.get()), m_table.byteLength());
-
-  // read the startup code
-  m_startupCode = std::unique_ptr<JSBigBufferString>(
-      new JSBigBufferString{startupCodeSize - 1});
+  // read the lookup table from the bundle
+  readBundle(
+      reinterpret_cast<char*>(m_table.data.get()),
+      m_table.byteLength(),
+      sizeof(header));
 
-  readBundle(m_startupCode->data(), startupCodeSize - 1);
+  if (startupCodeSize == 0 ||
+      m_baseOffset + startupCodeSize > m_bundle->size()) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
+  m_startupCode = {m_baseOffset, startupCodeSize - 1};
+  m_loadedModules.resize(numTableEntries);
 }
 
 JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
+  auto range = getModuleRange(moduleId);
+  recordModuleLoad(moduleId);
+
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
-  ret.code = getModuleCode(moduleId);
+  ret.code = std::string(m_bundle->c_str() + range.offset, range.length);
   return ret;
 }
 
+JSIndexedRAMBundle::ModuleSource JSIndexedRAMBundle::getModuleSource(
+    uint32_t moduleId) const {
+  auto range = getModuleRange(moduleId);
+  recordModuleLoad(moduleId);
+  return {folly::to<std::string>(moduleId, ".js"), getCode(range)};
+}
+
 std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
-  CHECK(m_startupCode)
+  CHECK(!m_startupCodeRetrieved)
       << "startup code for a RAM Bundle can only be retrieved once";
-  return std::move(m_startupCode);
+  m_startupCodeRetrieved = true;
+  return getCode(m_startupCode);
 }
 
-std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
+void JSIndexedRAMBundle::prefetchModules(
+    const std::vector<uint32_t>& moduleIds) const {
+  static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto base = reinterpret_cast<uintptr_t>(m_bundle->c_str());
+
+  // Page ranges, merged so that adjacent modules take a single call.
+  auto pages = std::vector<std::pair<uintptr_t, uintptr_t>>{};
+  pages.reserve(moduleIds.size());
+  for (auto id : moduleIds) {
+    if (auto range = findModuleRange(id)) {
+      pages.emplace_back(
+          (base + range->offset) / pageSize * pageSize,
+          base + range->offset + range->length + 1);
+    }
+  }
+  std::sort(pages.begin(), pages.end());
+
+  auto advise = [](uintptr_t begin, uintptr_t end) {
+    // Only a hint: failures are ignored.
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+  };
+  for (size_t i = 0; i < pages.size();) {
+    auto [begin, end] = pages[i++];
+    while (i < pages.size() && pages[i].first <= end) {
+      end = std::max(end, pages[i++].second);
+    }
+    advise(begin, end);
+  }
+}
+
+const std::vector<uint32_t>& JSIndexedRAMBundle::getModuleLoadOrder() const {
+  return m_moduleLoadOrder;
+}
+
+std::optional<JSIndexedRAMBundle::CodeRange>
+JSIndexedRAMBundle::findModuleRange(const uint32_t id) const {
   const auto moduleData = id < m_table.numEntries ? &m_table.data[id] : nullptr;
 
   // entries without associated code have offset = 0 and length = 0
   const uint32_t length =
       moduleData ? folly::Endian::little(moduleData->length) : 0;
   if (length == 0) {
+    return std::nullopt;
+  }
+
+  const size_t offset =
+      m_baseOffset + folly::Endian::little(moduleData->offset);
+  if (offset + length > m_bundle->size()) {
+    return std::nullopt;
+  }
+  return CodeRange{offset, length - 1};
+}
+
+JSIndexedRAMBundle::CodeRange JSIndexedRAMBundle::getModuleRange(
+    const uint32_t id) const {
+  auto range = findModuleRange(id);
+  if (!range) {
     throw std::ios_base::failure(
         folly::to<std::string>("Error loading module", id, "from RAM Bundle"));
   }
+  return *range;
+}
 
-  std::string ret(length - 1, '\0');
-  readBundle(
-      &ret.front(),
-      length - 1,
-      m_baseOffset + folly::Endian::little(moduleData->offset));
-  return ret;
+std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getCode(
+    CodeRange range) const {
+  // Code is \0 terminated in bundles built by Metro, so it can be used in
+  // place.
+  if (m_bundle->c_str()[range.offset + range.length] == '\0') {
+    return std::make_unique<JSBigStringSlice>(
+        m_bundle, range.offset, range.length);
+  }
+  return std::make_unique<JSBigStdString>(
+      std::string(m_bundle->c_str() + range.offset, range.length));
 }
 
-void JSIndexedRAMBundle::readBundle(char* buffer, const std::streamsize bytes)
-    const {
-  if (!m_bundle->read(buffer, bytes)) {
-    if (m_bundle->rdstate() & std::ios::eofbit) {
-      throw std::ios_base::failure("Unexpected end of RAM Bundle file");
-    }
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+void JSIndexedRAMBundle::recordModuleLoad(const uint32_t id) const {
+  if (!m_loadedModules[id]) {
+    m_loadedModules[id] = true;
+    m_moduleLoadOrder.push_back(id);
   }
 }
 
 void JSIndexedRAMBundle::readBundle(
     char* buffer,
-    const std::streamsize bytes,
-    const std::ifstream::pos_type position) const {
-  if (!m_bundle->seekg(position)) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+    const size_t bytes,
+    const size_t position) const {
+  if (position + bytes > m_bundle->size()) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
   }
-  readBundle(buffer, bytes);
+  std::memcpy(buffer, m_bundle->c_str() + position, bytes);
 }
 
 } // namespace facebook::react
@@ -7,8 +7,10 @@
 
 #pragma once
 
-#include <istream>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -19,6 +21,13 @@
 
 namespace facebook::react {
 
+/**
+ * Reads an indexed RAM bundle in memory: bundles read from files are
+ * memory-mapped, so that only the pages of the modules that are loaded are
+ * read from disk. Module code is handed out without copying it.
+ *
+ * Not thread safe.
+ */
 class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
  public:
   static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
@@ -32,6 +41,20 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   std::unique_ptr<const JSBigString> getStartupCode();
   // Throws std::runtime_error on failure.
   Module getModule(uint32_t moduleId) const override;
+  // Throws std::runtime_error on failure.
+  ModuleSource getModuleSource(uint32_t moduleId) const override;
+
+  /**
+   * Hints the OS to read the code of the modules ahead, e.g. the ones the
+   * previous launch loaded at startup. Unknown module ids are ignored.
+   */
+  void prefetchModules(const std::vector<uint32_t>& moduleIds) const override;
+
+  /**
+   * Returns the ids of the modules loaded so far, in the order in which they
+   * were first loaded.
+   */
+  const std::vector<uint32_t>& getModuleLoadOrder() const;
 
  private:
   struct ModuleData {
@@ -54,18 +77,28 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
     }
   };
 
+  // The position of code in the bundle, without its terminating \0.
+  struct CodeRange {
+    size_t offset;
+    size_t length;
+  };
+
   void init();
-  std::string getModuleCode(const uint32_t id) const;
-  void readBundle(char* buffer, const std::streamsize bytes) const;
-  void readBundle(
-      char* buffer,
-      const std::streamsize bytes,
-      const std::istream::pos_type position) const;
-
-  mutable std::unique_ptr<std::istream> m_bundle;
+  // Returns nothing if the module has no code in the bundle.
+  std::optional<CodeRange> findModuleRange(const uint32_t id) const;
+  CodeRange getModuleRange(const uint32_t id) const;
+  std::unique_ptr<const JSBigString> getCode(CodeRange range) const;
+  void recordModuleLoad(const uint32_t id) const;
+  void readBundle(char* buffer, const size_t bytes, const size_t position)
+      const;
+
+  std::shared_ptr<const JSBigString> m_bundle;
   ModuleTable m_table;
   size_t m_baseOffset;
-  std::unique_ptr<JSBigBufferString> m_startupCode;
+  CodeRange m_startupCode;
+  bool m_startupCodeRetrieved{false};
+  mutable std::vector<uint32_t> m_moduleLoadOrder;
+  mutable std::vector<bool> m_loadedModules;
 };
 
 } // namespace facebook::react
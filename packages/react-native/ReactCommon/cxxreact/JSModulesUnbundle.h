@@ -8,9 +8,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include <cxxreact/JSBigString.h>
 #include <folly/Conv.h>
 
 namespace facebook::react {
@@ -35,10 +38,33 @@ class JSModulesUnbundle {
     std::string name;
     std::string code;
   };
+  struct ModuleSource {
+    std::string name;
+    std::unique_ptr<const JSBigString> code;
+  };
   JSModulesUnbundle() {}
   virtual ~JSModulesUnbundle() {}
   virtual Module getModule(uint32_t moduleId) const = 0;
 
+  /**
+   * Same as `getModule`, for unbundles that can hand out the code without
+   * copying it. By default, the code is moved out of `getModule`.
+   */
+  virtual ModuleSource getModuleSource(uint32_t moduleId) const {
+    auto module = getModule(moduleId);
+    return {
+        std::move(module.name),
+        std::make_unique<JSBigStdString>(std::move(module.code)),
+    };
+  }
+
+  /**
+   * Hints the unbundle to read the code of the modules ahead. Does nothing
+   * by default.
+   */
+  virtual void prefetchModules(const std::vector<uint32_t>& /*moduleIds*/)
+      const {}
+
  private:
   JSModulesUnbundle(const JSModulesUnbundle&) = delete;
 };
@@ -7,7 +7,10 @@
 
 #include "MethodCall.h"
 
+#include <folly/Conv.h>
 #include <folly/json.h>
+#include <bit>
+#include <cstring>
 #include <stdexcept>
 
 namespace facebook::react {
@@ -84,4 +87,213 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic&& jsonData) {
   return methodCalls;
 }
 
+namespace {
+
+enum class ValueType : uint8_t {
+  Null = 0,
+  False = 1,
+  True = 2,
+  Number = 3,
+  String = 4,
+  Array = 5,
+  Object = 6,
+};
+
+// Deeper arguments are rejected rather than risking a stack overflow.
+constexpr size_t kMaxNestingDepth = 512;
+
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  bool atEnd() const {
+    return offset_ == size_;
+  }
+
+  template <typename T>
+  T read() {
+    T value;
+    std::memcpy(&value, skip(sizeof(T)), sizeof(T));
+    return folly::Endian::little(value);
+  }
+
+  double readDouble() {
+    return std::bit_cast<double>(read<uint64_t>());
+  }
+
+  std::string readString() {
+    auto size = read<uint32_t>();
+    return std::string(reinterpret_cast<const char*>(skip(size)), size);
+  }
+
+  const uint8_t* skip(size_t size) {
+    if (size > size_ - offset_) {
+      throw std::invalid_argument(
+          folly::to<std::string>(errorPrefix, "truncated binary call queue"));
+    }
+    const auto* data = data_ + offset_;
+    offset_ += size;
+    return data;
+  }
+
+  folly::dynamic readValue(size_t depth = 0) {
+    if (depth > kMaxNestingDepth) {
+      throw std::invalid_argument(
+          folly::to<std::string>(errorPrefix, "arguments nested too deeply"));
+    }
+    auto type = read<uint8_t>();
+    switch (static_cast<ValueType>(type)) {
+      case ValueType::Null:
+        return nullptr;
+      case ValueType::False:
+        return false;
+      case ValueType::True:
+        return true;
+      case ValueType::Number:
+        return readDouble();
+      case ValueType::String:
+        return readString();
+      case ValueType::Array: {
+        auto count = read<uint32_t>();
+        auto array = folly::dynamic::array();
+        for (uint32_t i = 0; i < count; i++) {
+          array.push_back(readValue(depth + 1));
+        }
+        return array;
+      }
+      case ValueType::Object: {
+        auto count = read<uint32_t>();
+        auto object = folly::dynamic::object();
+        for (uint32_t i = 0; i < count; i++) {
+          auto key = readString();
+          object[std::move(key)] = readValue(depth + 1);
+        }
+        return object;
+      }
+    }
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "unknown value type ", type));
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_{0};
+};
+
+template <typename T>
+void write(std::string& data, T value) {
+  value = folly::Endian::little(value);
+  data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write(std::string& data, ValueType type) {
+  data.push_back(static_cast<char>(type));
+}
+
+void writeString(std::string& data, const std::string& string) {
+  write(data, static_cast<uint32_t>(string.size()));
+  data.append(string);
+}
+
+void writeValue(std::string& data, const folly::dynamic& value) {
+  switch (value.type()) {
+    case folly::dynamic::NULLT:
+      write(data, ValueType::Null);
+      break;
+    case folly::dynamic::BOOL:
+      write(data, value.getBool() ? ValueType::True : ValueType::False);
+      break;
+    case folly::dynamic::INT64:
+    case folly::dynamic::DOUBLE:
+      write(data, ValueType::Number);
+      write(data, std::bit_cast<uint64_t>(value.asDouble()));
+      break;
+    case folly::dynamic::STRING:
+      write(data, ValueType::String);
+      writeString(data, value.getString());
+      break;
+    case folly::dynamic::ARRAY:
+      write(data, ValueType::Array);
+      write(data, static_cast<uint32_t>(value.size()));
+      for (const auto& element : value) {
+        writeValue(data, element);
+      }
+      break;
+    case folly::dynamic::OBJECT:
+      write(data, ValueType::Object);
+      write(data, static_cast<uint32_t>(value.size()));
+      for (const auto& [key, element] : value.items()) {
+        if (!key.isString()) {
+          throw std::invalid_argument(folly::to<std::string>(
+              errorPrefix, "object key isn't string but ", key.typeName()));
+        }
+        writeString(data, key.getString());
+        writeValue(data, element);
+      }
+      break;
+  }
+}
+
+} // namespace
+
+folly::dynamic EncodedMethodArguments::decode() const {
+  Reader reader{data_, size_};
+  auto arguments = reader.readValue();
+  if (!arguments.isArray() || !reader.atEnd()) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "method arguments aren't a single array"));
+  }
+  return arguments;
+}
+
+std::vector<EncodedMethodCall> parseEncodedMethodCalls(
+    const uint8_t* data,
+    size_t size) {
+  Reader reader{data, size};
+  auto count = reader.read<uint32_t>();
+  auto callId = static_cast<int>(reader.read<int32_t>());
+
+  std::vector<EncodedMethodCall> methodCalls;
+  // Each call takes at least 13 bytes, don't trust larger counts.
+  methodCalls.reserve(std::min<size_t>(count, size / 13));
+  for (uint32_t i = 0; i < count; i++) {
+    auto moduleId = static_cast<int>(reader.read<uint32_t>());
+    auto methodId = static_cast<int>(reader.read<uint32_t>());
+    auto argumentsSize = reader.read<uint32_t>();
+    methodCalls.push_back({
+        moduleId,
+        methodId,
+        EncodedMethodArguments{reader.skip(argumentsSize), argumentsSize},
+        callId,
+    });
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  if (!reader.atEnd()) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "unexpected data after ", count, " calls"));
+  }
+  return methodCalls;
+}
+
+std::string encodeMethodCalls(const folly::dynamic& calls) {
+  auto methodCalls = parseMethodCalls(folly::dynamic(calls));
+  auto callId = methodCalls.empty() ? -1 : methodCalls.front().callId;
+
+  std::string data;
+  write(data, static_cast<uint32_t>(methodCalls.size()));
+  write(data, static_cast<int32_t>(callId));
+  for (const auto& call : methodCalls) {
+    write(data, static_cast<uint32_t>(call.moduleId));
+    write(data, static_cast<uint32_t>(call.methodId));
+    std::string arguments;
+    writeValue(arguments, call.arguments);
+    writeString(data, arguments);
+  }
+  return data;
+}
+
 } // namespace facebook::react
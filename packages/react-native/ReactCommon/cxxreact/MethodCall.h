@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -31,4 +33,58 @@ struct MethodCall {
 /// \throws std::invalid_argument
 std::vector<MethodCall> parseMethodCalls(folly::dynamic&& calls);
 
+/**
+ * The arguments of a call in a binary call queue, which are only decoded when
+ * the method is invoked. Points into the queue, which must outlive it.
+ */
+class EncodedMethodArguments {
+ public:
+  EncodedMethodArguments(const uint8_t* data, size_t size)
+      : data_(data), size_(size) {}
+
+  /// \throws std::invalid_argument
+  folly::dynamic decode() const;
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+};
+
+struct EncodedMethodCall {
+  int moduleId;
+  int methodId;
+  EncodedMethodArguments arguments;
+  int callId;
+};
+
+/**
+ * Binary call queues carry the calls that MessageQueue.js batches up without
+ * materializing their arguments as JS arrays on the native side. All values
+ * are little endian:
+ *
+ *   queue:     u32 call count, i32 first call id (-1 if none), calls
+ *   call:      u32 module id, u32 method id, u32 arguments size, arguments
+ *   arguments: an array value
+ *   value:     u8 type, then
+ *              null (0), false (1), true (2): nothing
+ *              number (3): f64
+ *              string (4): u32 size, UTF-8 bytes
+ *              array (5): u32 count, values
+ *              object (6): u32 count, (u32 size, UTF-8 key bytes, value)s
+ *
+ * Call ids increase by one per call, like in the JSON call queue.
+ */
+
+/// \throws std::invalid_argument
+std::vector<EncodedMethodCall> parseEncodedMethodCalls(
+    const uint8_t* data,
+    size_t size);
+
+/**
+ * Encodes a JSON call queue, as parsed by parseMethodCalls, in the binary
+ * format.
+ */
+/// \throws std::invalid_argument
+std::string encodeMethodCalls(const folly::dynamic& calls);
+
 } // namespace facebook::react
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ModuleLoadTrace.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint32_t kMagicNumber = 0x544D4E52; // "RNMT"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderSize = 8;
+constexpr size_t kEventSize = 24;
+
+template <typename T>
+void append(std::string& data, T value) {
+  for (size_t i = 0; i < sizeof(T); i++) {
+    data.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+template <typename T>
+T read(const std::string& data, size_t& offset) {
+  T value = 0;
+  for (size_t i = 0; i < sizeof(T); i++) {
+    value |= static_cast<T>(static_cast<uint8_t>(data[offset + i])) << (i * 8);
+  }
+  offset += sizeof(T);
+  return value;
+}
+
+} // namespace
+
+ModuleLoadTrace::ModuleLoadTrace()
+    : startTime_(std::chrono::steady_clock::now()) {}
+
+void ModuleLoadTrace::record(
+    uint32_t bundleId,
+    uint32_t moduleId,
+    size_t size) {
+  auto elapsed = std::chrono::steady_clock::now() - startTime_;
+  auto lock = std::lock_guard<std::mutex>(mutex_);
+  auto [threadId, inserted] = threadIds_.try_emplace(
+      std::this_thread::get_id(), static_cast<uint32_t>(threadIds_.size()));
+  events_.push_back({
+      .timestamp = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count()),
+      .bundleId = bundleId,
+      .moduleId = moduleId,
+      .size = static_cast<uint32_t>(
+          std::min<size_t>(size, std::numeric_limits<uint32_t>::max())),
+      .threadId = threadId->second,
+  });
+}
+
+std::vector<ModuleLoadEvent> ModuleLoadTrace::getEvents() const {
+  auto lock = std::lock_guard<std::mutex>(mutex_);
+  return events_;
+}
+
+std::string ModuleLoadTrace::serialize() const {
+  auto events = getEvents();
+  auto data = std::string{};
+  data.reserve(kHeaderSize + events.size() * kEventSize);
+  append(data, kMagicNumber);
+  append(data, kVersion);
+  for (const auto& event : events) {
+    append(data, event.timestamp);
+    append(data, event.bundleId);
+    append(data, event.moduleId);
+    append(data, event.size);
+    append(data, event.threadId);
+  }
+  return data;
+}
+
+std::vector<ModuleLoadEvent> ModuleLoadTrace::deserialize(
+    const std::string& data) {
+  if (data.size() < kHeaderSize ||
+      (data.size() - kHeaderSize) % kEventSize != 0) {
+    throw std::runtime_error("Not a module load trace");
+  }
+  size_t offset = 0;
+  auto magicNumber = read<uint32_t>(data, offset);
+  auto version = read<uint32_t>(data, offset);
+  if (magicNumber != kMagicNumber || version != kVersion) {
+    throw std::runtime_error("Not a module load trace");
+  }
+
+  auto events = std::vector<ModuleLoadEvent>{};
+  events.reserve((data.size() - kHeaderSize) / kEventSize);
+  while (offset < data.size()) {
+    auto& event = events.emplace_back();
+    event.timestamp = read<uint64_t>(data, offset);
+    event.bundleId = read<uint32_t>(data, offset);
+    event.moduleId = read<uint32_t>(data, offset);
+    event.size = read<uint32_t>(data, offset);
+    event.threadId = read<uint32_t>(data, offset);
+  }
+  return events;
+}
+
+std::vector<ModulePreload> getPreloadList(
+    const std::vector<ModuleLoadEvent>& events,
+    std::chrono::nanoseconds until) {
+  auto preloadList = std::vector<ModulePreload>{};
+  auto seen = std::unordered_set<uint64_t>{};
+  for (const auto& event : events) {
+    // Events of concurrent loads may be slightly out of order.
+    if (event.timestamp > static_cast<uint64_t>(until.count())) {
+      continue;
+    }
+    auto key = (static_cast<uint64_t>(event.bundleId) << 32) | event.moduleId;
+    if (seen.insert(key).second) {
+      preloadList.push_back({event.bundleId, event.moduleId});
+    }
+  }
+  return preloadList;
+}
+
+std::string formatPreloadList(const std::vector<ModulePreload>& preloadList) {
+  auto stream = std::ostringstream{};
+  for (const auto& preload : preloadList) {
+    stream << preload.bundleId << ' ' << preload.moduleId << '\n';
+  }
+  return stream.str();
+}
+
+std::vector<ModulePreload> parsePreloadList(const std::string& text) {
+  auto preloadList = std::vector<ModulePreload>{};
+  auto stream = std::istringstream{text};
+  auto line = std::string{};
+  while (std::getline(stream, line)) {
+    auto lineStream = std::istringstream{line};
+    auto preload = ModulePreload{};
+    if (lineStream >> preload.bundleId >> preload.moduleId) {
+      preloadList.push_back(preload);
+    }
+  }
+  return preloadList;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef RN_EXPORT
+#define RN_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace facebook::react {
+
+/**
+ * A module loaded from a RAM bundle.
+ */
+struct ModuleLoadEvent {
+  // Nanoseconds since the trace started.
+  uint64_t timestamp;
+  uint32_t bundleId;
+  uint32_t moduleId;
+  // Size of the module's code, in bytes.
+  uint32_t size;
+  // Identifies the loading thread within the trace.
+  uint32_t threadId;
+};
+
+/**
+ * A module to read ahead, in the order of the preload list.
+ */
+struct ModulePreload {
+  uint32_t bundleId;
+  uint32_t moduleId;
+
+  bool operator==(const ModulePreload& other) const = default;
+};
+
+/**
+ * Records the modules loaded from RAM bundles, e.g. during startup, to
+ * optimize the bundle layout or preload them at the next launch.
+ *
+ * The trace is written in a compact binary format: the "RNMT" magic number
+ * and a version, followed by the events, all little endian. Use
+ * `scripts/ram-bundle-preload-list.js` to turn it into a preload list.
+ *
+ * Thread safe.
+ */
+class RN_EXPORT ModuleLoadTrace {
+ public:
+  ModuleLoadTrace();
+
+  void record(uint32_t bundleId, uint32_t moduleId, size_t size);
+
+  std::vector<ModuleLoadEvent> getEvents() const;
+
+  std::string serialize() const;
+
+  // Throws std::runtime_error if the data isn't a trace.
+  static std::vector<ModuleLoadEvent> deserialize(const std::string& data);
+
+ private:
+  mutable std::mutex mutex_;
+  std::chrono::steady_clock::time_point startTime_;
+  std::vector<ModuleLoadEvent> events_;
+  std::unordered_map<std::thread::id, uint32_t> threadIds_;
+};
+
+/**
+ * Returns the modules in the order in which they were first loaded, up to
+ * `until` after the start of the trace.
+ */
+RN_EXPORT std::vector<ModulePreload> getPreloadList(
+    const std::vector<ModuleLoadEvent>& events,
+    std::chrono::nanoseconds until = std::chrono::nanoseconds::max());
+
+/**
+ * Preload lists are text, with a "<bundle id> <module id>" line per module.
+ * Malformed lines are ignored.
+ */
+RN_EXPORT std::string formatPreloadList(
+    const std::vector<ModulePreload>& preloadList);
+RN_EXPORT std::vector<ModulePreload> parsePreloadList(const std::string& text);
+
+} // namespace facebook::react
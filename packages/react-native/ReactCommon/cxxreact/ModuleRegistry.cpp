@@ -11,6 +11,7 @@
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
 #include "NativeModule.h"
+#include "NativeModuleWorkerPool.h"
 #include "SystraceSection.h"
 
 namespace facebook::react {
@@ -223,6 +224,31 @@ void ModuleRegistry::callNativeMethod(
   modules_[moduleId]->invoke(methodId, std::move(params), callId);
 }
 
+void ModuleRegistry::callNativeMethod(
+    unsigned int moduleId,
+    unsigned int methodId,
+    const EncodedMethodArguments& params,
+    int callId) {
+  if (moduleId >= modules_.size()) {
+    throw std::runtime_error(folly::to<std::string>(
+        "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
+  }
+  modules_[moduleId]->invoke(methodId, params.decode(), callId);
+}
+
+void ModuleRegistry::setWorkerPool(
+    std::shared_ptr<NativeModuleWorkerPool> workerPool) {
+  workerPool_ = std::move(workerPool);
+}
+
+void ModuleRegistry::runAfterDispatchedCalls(std::function<void()>&& callback) {
+  if (workerPool_) {
+    workerPool_->runWhenDrained(std::move(callback));
+  } else {
+    callback();
+  }
+}
+
 MethodCallResult ModuleRegistry::callSerializableNativeHook(
     unsigned int moduleId,
     unsigned int methodId,
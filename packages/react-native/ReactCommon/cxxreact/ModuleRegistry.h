@@ -12,6 +12,7 @@
 #include <vector>
 
 #include <cxxreact/JSExecutor.h>
+#include <cxxreact/MethodCall.h>
 #include <folly/dynamic.h>
 #include <optional>
 
@@ -22,6 +23,7 @@
 namespace facebook::react {
 
 class NativeModule;
+class NativeModuleWorkerPool;
 
 struct ModuleConfig {
   size_t index;
@@ -53,11 +55,29 @@ class RN_EXPORT ModuleRegistry {
       unsigned int methodId,
       folly::dynamic&& params,
       int callId);
+  // Decodes the arguments right before invoking the method.
+  void callNativeMethod(
+      unsigned int moduleId,
+      unsigned int methodId,
+      const EncodedMethodArguments& params,
+      int callId);
   MethodCallResult callSerializableNativeHook(
       unsigned int moduleId,
       unsigned int methodId,
       folly::dynamic&& args);
 
+  /**
+   * Sets the pool that thread safe modules run their calls on, see
+   * CxxModule::isThreadSafe.
+   */
+  void setWorkerPool(std::shared_ptr<NativeModuleWorkerPool> workerPool);
+
+  /**
+   * Runs the callback once the calls dispatched to the worker pool so far
+   * have run, or right away without a pool.
+   */
+  void runAfterDispatchedCalls(std::function<void()>&& callback);
+
   std::string getModuleName(unsigned int moduleId);
   std::string getModuleSyncMethodName(
       unsigned int moduleId,
@@ -80,6 +100,9 @@ class RN_EXPORT ModuleRegistry {
   // registry.
   std::unordered_set<std::string> unknownModules_;
 
+  // Declared after modules_, so that it stops before they are destroyed.
+  std::shared_ptr<NativeModuleWorkerPool> workerPool_;
+
   // Function will be called if a module was requested but was not found.
   // If the function returns true, ModuleRegistry will try to find the module
   // again (assuming it's registered) If the function returns false,
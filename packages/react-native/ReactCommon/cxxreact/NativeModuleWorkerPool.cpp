@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "NativeModuleWorkerPool.h"
+
+#include <glog/logging.h>
+#include <algorithm>
+#include <future>
+#include <iterator>
+
+#ifdef ANDROID
+#include <fbjni/fbjni.h>
+#endif
+
+namespace facebook::react {
+
+namespace {
+
+// The queue whose call runs on this thread, if any.
+thread_local const void* currentQueue = nullptr;
+
+// Set when the pool is destroyed by the worker running on this thread.
+thread_local bool isPoolDestroyedOnThisThread = false;
+
+} // namespace
+
+class NativeModuleWorkerPool::Queue : public MessageQueueThread {
+ public:
+  Queue(std::weak_ptr<NativeModuleWorkerPool> pool)
+      : pool_(std::move(pool)), state_(std::make_shared<QueueState>()) {}
+
+  void runOnQueue(std::function<void()>&& work) override {
+    if (auto pool = pool_.lock()) {
+      pool->enqueue(state_, std::move(work));
+    }
+  }
+
+  void runOnQueueSync(std::function<void()>&& work) override {
+    // Waiting for the queue from one of its calls would never return.
+    if (currentQueue == state_.get()) {
+      work();
+      return;
+    }
+
+    auto done = std::promise<void>();
+    auto future = done.get_future();
+    auto pool = pool_.lock();
+    if (pool && pool->enqueue(state_, [&work, &done]() {
+          work();
+          done.set_value();
+        })) {
+      future.wait();
+    }
+  }
+
+  void quitSynchronous() override {
+    if (auto pool = pool_.lock()) {
+      pool->quit(state_);
+    }
+  }
+
+ private:
+  std::weak_ptr<NativeModuleWorkerPool> pool_;
+  std::shared_ptr<QueueState> state_;
+};
+
+NativeModuleWorkerPool::NativeModuleWorkerPool(
+    size_t threadCount,
+    ErrorHandler onError)
+    : threadCount_(std::max<size_t>(threadCount, 1)),
+      onError_(std::move(onError)) {
+  epochs_.emplace_back();
+}
+
+NativeModuleWorkerPool::~NativeModuleWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  workAvailable_.notify_all();
+  for (auto& thread : threads_) {
+    // The last reference was released by the worker running on this thread,
+    // which returns as soon as this is done.
+    if (thread.get_id() == std::this_thread::get_id()) {
+      isPoolDestroyedOnThisThread = true;
+      thread.detach();
+    } else {
+      thread.join();
+    }
+  }
+}
+
+std::shared_ptr<MessageQueueThread> NativeModuleWorkerPool::createQueue() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (threads_.empty()) {
+    for (size_t i = 0; i < threadCount_; i++) {
+#ifdef ANDROID
+      // Calls may use JNI, like on the native modules thread.
+      threads_.emplace_back([this]() {
+        jni::ThreadScope::WithClassLoader([this]() { runWorker(); });
+      });
+#else
+      threads_.emplace_back([this]() { runWorker(); });
+#endif
+    }
+  }
+  return std::make_shared<Queue>(weak_from_this());
+}
+
+void NativeModuleWorkerPool::runWhenDrained(std::function<void()>&& callback) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  epochs_.back().callbacks.push_back(std::move(callback));
+  epochs_.emplace_back();
+  runDrainedCallbacks(lock);
+}
+
+size_t NativeModuleWorkerPool::getDefaultThreadCount() {
+  return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 2, 4);
+}
+
+bool NativeModuleWorkerPool::enqueue(
+    const std::shared_ptr<QueueState>& queue,
+    std::function<void()>&& work) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isStopping_ || queue->hasQuit) {
+      return false;
+    }
+    queue->tasks.push_back({std::move(work), firstEpoch_ + epochs_.size() - 1});
+    epochs_.back().pendingTasks++;
+    if (queue->isScheduled || queue->isRunning) {
+      return true;
+    }
+    queue->isScheduled = true;
+    scheduledQueues_.push_back(queue);
+  }
+  workAvailable_.notify_one();
+  return true;
+}
+
+void NativeModuleWorkerPool::quit(const std::shared_ptr<QueueState>& queue) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue->hasQuit = true;
+  for (const auto& task : queue->tasks) {
+    completeTask(task.epoch);
+  }
+  queue->tasks.clear();
+  runDrainedCallbacks(lock);
+  taskFinished_.wait(lock, [&]() { return !queue->isRunning; });
+}
+
+void NativeModuleWorkerPool::runWorker() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    workAvailable_.wait(
+        lock, [&]() { return isStopping_ || !scheduledQueues_.empty(); });
+    if (scheduledQueues_.empty()) {
+      return;
+    }
+
+    auto queue = std::move(scheduledQueues_.front());
+    scheduledQueues_.pop_front();
+    queue->isScheduled = false;
+    if (queue->tasks.empty()) {
+      continue;
+    }
+    queue->isRunning = true;
+    auto task = std::move(queue->tasks.front());
+    queue->tasks.pop_front();
+
+    // Keeps the pool alive until the call and the callbacks of the epochs it
+    // completes have run, in case they release the last reference to it.
+    // Null if the pool is already being destroyed on another thread, which
+    // waits for this one.
+    auto self = weak_from_this().lock();
+
+    lock.unlock();
+    currentQueue = queue.get();
+    runTask(task);
+    currentQueue = nullptr;
+    // Whatever the call captured is released while the pool is kept alive.
+    task.work = nullptr;
+    lock.lock();
+
+    // A queue runs a call at a time, and goes back in line after each, so
+    // that busy modules don't starve the others.
+    queue->isRunning = false;
+    if (!queue->tasks.empty()) {
+      queue->isScheduled = true;
+      scheduledQueues_.push_back(queue);
+    }
+    taskFinished_.notify_all();
+
+    completeTask(task.epoch);
+    runDrainedCallbacks(lock);
+
+    lock.unlock();
+    self = nullptr;
+    if (isPoolDestroyedOnThisThread) {
+      return;
+    }
+    lock.lock();
+  }
+}
+
+void NativeModuleWorkerPool::runTask(Task& task) noexcept {
+  try {
+    task.work();
+  } catch (...) {
+    if (onError_) {
+      onError_(std::current_exception());
+    } else {
+      LOG(ERROR) << "Uncaught exception in a native module call";
+    }
+  }
+}
+
+void NativeModuleWorkerPool::completeTask(uint64_t epoch) {
+  epochs_[epoch - firstEpoch_].pendingTasks--;
+}
+
+void NativeModuleWorkerPool::runDrainedCallbacks(
+    std::unique_lock<std::mutex>& lock) {
+  // The last epoch is still open, earlier ones are drained in order.
+  while (epochs_.size() > 1 && epochs_.front().pendingTasks == 0) {
+    auto& callbacks = epochs_.front().callbacks;
+    std::move(
+        callbacks.begin(),
+        callbacks.end(),
+        std::back_inserter(drainedCallbacks_));
+    epochs_.pop_front();
+    firstEpoch_++;
+  }
+
+  // Only one thread runs callbacks at a time, so that they run in order.
+  if (isRunningCallbacks_) {
+    return;
+  }
+  isRunningCallbacks_ = true;
+  while (!drainedCallbacks_.empty()) {
+    auto callback = std::move(drainedCallbacks_.front());
+    drainedCallbacks_.pop_front();
+    lock.unlock();
+    callback();
+    lock.lock();
+  }
+  isRunningCallbacks_ = false;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cxxreact/MessageQueueThread.h>
+
+#ifndef RN_EXPORT
+#define RN_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace facebook::react {
+
+/**
+ * Runs the calls of thread safe native modules (see
+ * CxxModule::isThreadSafe) on a few worker threads. Each module gets its own
+ * queue: calls to a module run one at a time and in order, while calls to
+ * different modules run in parallel.
+ *
+ * Threads are only started once the first queue is created. On Android,
+ * they are attached to the JVM, like the native modules thread.
+ *
+ * The pool may be released by a call running on it: the worker running the
+ * call keeps it alive until the call returns.
+ */
+class RN_EXPORT NativeModuleWorkerPool
+    : public std::enable_shared_from_this<NativeModuleWorkerPool> {
+ public:
+  /**
+   * Receives the exceptions thrown by calls, on the thread that ran the
+   * call. Without one, they are logged.
+   */
+  using ErrorHandler = std::function<void(std::exception_ptr error)>;
+
+  explicit NativeModuleWorkerPool(
+      size_t threadCount = getDefaultThreadCount(),
+      ErrorHandler onError = nullptr);
+
+  // Runs the work queued so far before joining the threads.
+  ~NativeModuleWorkerPool();
+
+  NativeModuleWorkerPool(const NativeModuleWorkerPool&) = delete;
+  NativeModuleWorkerPool& operator=(const NativeModuleWorkerPool&) = delete;
+
+  /**
+   * Returns a new queue for the calls of a module.
+   */
+  std::shared_ptr<MessageQueueThread> createQueue();
+
+  /**
+   * Runs the callback once all the work queued so far has run, on the thread
+   * that finishes it, or right away if there is none. Callbacks run in the
+   * order in which they were added.
+   */
+  void runWhenDrained(std::function<void()>&& callback);
+
+  static size_t getDefaultThreadCount();
+
+ private:
+  class Queue;
+
+  struct Task {
+    std::function<void()> work;
+    // The epoch in which the task was queued, see runWhenDrained.
+    uint64_t epoch;
+  };
+
+  struct QueueState {
+    std::deque<Task> tasks;
+    bool isScheduled{false};
+    bool isRunning{false};
+    bool hasQuit{false};
+  };
+
+  // Work queued between two runWhenDrained calls.
+  struct Epoch {
+    size_t pendingTasks{0};
+    std::vector<std::function<void()>> callbacks;
+  };
+
+  // Returns false if the work was dropped.
+  bool enqueue(
+      const std::shared_ptr<QueueState>& queue,
+      std::function<void()>&& work);
+  void quit(const std::shared_ptr<QueueState>& queue);
+  void runWorker();
+  void runTask(Task& task) noexcept;
+  // These must be called with the mutex held.
+  void completeTask(uint64_t epoch);
+  void runDrainedCallbacks(std::unique_lock<std::mutex>& lock);
+
+  const size_t threadCount_;
+  const ErrorHandler onError_;
+  std::mutex mutex_;
+  std::condition_variable workAvailable_;
+  std::condition_variable taskFinished_;
+  std::deque<std::shared_ptr<QueueState>> scheduledQueues_;
+  std::deque<Epoch> epochs_;
+  uint64_t firstEpoch_{0};
+  std::deque<std::function<void()>> drainedCallbacks_;
+  bool isRunningCallbacks_{false};
+  bool isStopping_{false};
+  std::vector<std::thread> threads_;
+};
+
+} // namespace facebook::react
@@ -70,15 +70,30 @@ class JsToNativeBridge : public react::ExecutorDelegate {
           call.moduleId, call.methodId, std::move(call.arguments), call.callId);
     }
     if (isEndOfBatch) {
-      // onBatchComplete will be called on the native (module) queue, but
-      // decrementPendingJSCalls will be called sync. Be aware that the bridge
-      // may still be processing native calls when the bridge idle signaler
-      // fires.
-      if (m_batchHadNativeModuleOrTurboModuleCalls) {
-        m_callback->onBatchComplete();
-        m_batchHadNativeModuleOrTurboModuleCalls = false;
-      }
-      m_callback->decrementPendingJSCalls();
+      endBatch();
+    }
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor& executor,
+      const uint8_t* calls,
+      size_t size,
+      bool isEndOfBatch) override {
+    auto methodCalls = parseEncodedMethodCalls(calls, size);
+    CHECK(m_registry || methodCalls.empty())
+        << "native module calls cannot be completed with no native modules";
+    m_batchHadNativeModuleOrTurboModuleCalls =
+        m_batchHadNativeModuleOrTurboModuleCalls || !methodCalls.empty();
+    BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
+        (int)methodCalls.size());
+
+    // Arguments are decoded one call at a time, as the calls are dispatched.
+    for (const auto& call : methodCalls) {
+      m_registry->callNativeMethod(
+          call.moduleId, call.methodId, call.arguments, call.callId);
+    }
+    if (isEndOfBatch) {
+      endBatch();
     }
   }
 
@@ -96,6 +111,26 @@ class JsToNativeBridge : public react::ExecutorDelegate {
   }
 
  private:
+  void endBatch() {
+    // onBatchComplete will be called on the native (module) queue, but
+    // decrementPendingJSCalls will be called sync. Be aware that the bridge
+    // may still be processing native calls when the bridge idle signaler
+    // fires.
+    if (m_batchHadNativeModuleOrTurboModuleCalls) {
+      // Calls to thread safe modules may run in parallel on a worker pool:
+      // the batch only completes once they have run, like the calls queued
+      // before onBatchComplete on the native modules queue.
+      if (m_registry) {
+        m_registry->runAfterDispatchedCalls(
+            [callback = m_callback]() { callback->onBatchComplete(); });
+      } else {
+        m_callback->onBatchComplete();
+      }
+      m_batchHadNativeModuleOrTurboModuleCalls = false;
+    }
+    m_callback->decrementPendingJSCalls();
+  }
+
   // These methods are always invoked from an Executor.  The NativeToJsBridge
   // keeps a reference to the executor, and when destroy() is called, the
   // executor is destroyed synchronously on its queue.
@@ -9,6 +9,7 @@
 
 #include <folly/String.h>
 
+#include <map>
 #include <memory>
 
 namespace facebook::react {
@@ -46,6 +47,55 @@ void RAMBundleRegistry::registerBundle(
 JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     uint32_t bundleId,
     uint32_t moduleId) {
+  auto module = getOrCreateBundle(bundleId)->getModule(moduleId);
+  if (m_trace) {
+    m_trace->record(bundleId, moduleId, module.code.size());
+  }
+  return {
+      getModuleName(bundleId, std::move(module.name)),
+      std::move(module.code),
+  };
+}
+
+JSModulesUnbundle::ModuleSource RAMBundleRegistry::getModuleSource(
+    uint32_t bundleId,
+    uint32_t moduleId) {
+  auto module = getOrCreateBundle(bundleId)->getModuleSource(moduleId);
+  if (m_trace) {
+    m_trace->record(bundleId, moduleId, module.code->size());
+  }
+  return {
+      getModuleName(bundleId, std::move(module.name)),
+      std::move(module.code),
+  };
+}
+
+void RAMBundleRegistry::setModuleLoadTrace(
+    std::shared_ptr<ModuleLoadTrace> trace) {
+  m_trace = std::move(trace);
+}
+
+void RAMBundleRegistry::prefetchModules(
+    const std::vector<ModulePreload>& preloadList) {
+  auto moduleIds = std::map<uint32_t, std::vector<uint32_t>>{};
+  for (const auto& preload : preloadList) {
+    moduleIds[preload.bundleId].push_back(preload.moduleId);
+  }
+
+  for (const auto& [bundleId, bundleModuleIds] : moduleIds) {
+    if (m_bundles.find(bundleId) == m_bundles.end() &&
+        (!m_factory || m_bundlePaths.find(bundleId) == m_bundlePaths.end())) {
+      continue;
+    }
+    getOrCreateBundle(bundleId)->prefetchModules(bundleModuleIds);
+  }
+}
+
+JSModulesUnbundle* RAMBundleRegistry::getBundle(uint32_t bundleId) const {
+  return m_bundles.at(bundleId).get();
+}
+
+JSModulesUnbundle* RAMBundleRegistry::getOrCreateBundle(uint32_t bundleId) {
   if (m_bundles.find(bundleId) == m_bundles.end()) {
     if (!m_factory) {
       throw std::runtime_error(
@@ -61,19 +111,16 @@ JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     }
     m_bundles.emplace(bundleId, m_factory(bundlePath->second));
   }
+  return getBundle(bundleId);
+}
 
-  auto module = getBundle(bundleId)->getModule(moduleId);
+std::string RAMBundleRegistry::getModuleName(
+    uint32_t bundleId,
+    std::string moduleName) const {
   if (bundleId == MAIN_BUNDLE_ID) {
-    return module;
+    return moduleName;
   }
-  return {
-      folly::to<std::string>("seg-", bundleId, '_', std::move(module.name)),
-      std::move(module.code),
-  };
-}
-
-JSModulesUnbundle* RAMBundleRegistry::getBundle(uint32_t bundleId) const {
-  return m_bundles.at(bundleId).get();
+  return folly::to<std::string>("seg-", bundleId, '_', std::move(moduleName));
 }
 
 } // namespace facebook::react
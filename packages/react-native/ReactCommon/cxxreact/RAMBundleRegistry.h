@@ -12,8 +12,10 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cxxreact/JSModulesUnbundle.h>
+#include <cxxreact/ModuleLoadTrace.h>
 
 #ifndef RN_EXPORT
 #define RN_EXPORT __attribute__((visibility("default")))
@@ -41,14 +43,34 @@ class RN_EXPORT RAMBundleRegistry {
 
   void registerBundle(uint32_t bundleId, std::string bundlePath);
   JSModulesUnbundle::Module getModule(uint32_t bundleId, uint32_t moduleId);
+  // Same as `getModule`, without copying the code if the bundle supports it.
+  JSModulesUnbundle::ModuleSource getModuleSource(
+      uint32_t bundleId,
+      uint32_t moduleId);
+
+  /**
+   * Records the modules loaded from now on in the trace.
+   */
+  void setModuleLoadTrace(std::shared_ptr<ModuleLoadTrace> trace);
+
+  /**
+   * Hints the bundles to read the modules ahead, e.g. with the preload list
+   * of a previous launch. Modules of bundles that aren't registered yet are
+   * ignored.
+   */
+  void prefetchModules(const std::vector<ModulePreload>& preloadList);
+
   virtual ~RAMBundleRegistry(){};
 
  private:
   JSModulesUnbundle* getBundle(uint32_t bundleId) const;
+  JSModulesUnbundle* getOrCreateBundle(uint32_t bundleId);
+  std::string getModuleName(uint32_t bundleId, std::string moduleName) const;
 
   std::function<std::unique_ptr<JSModulesUnbundle>(std::string)> m_factory;
   std::unordered_map<uint32_t, std::string> m_bundlePaths;
   std::unordered_map<uint32_t, std::unique_ptr<JSModulesUnbundle>> m_bundles;
+  std::shared_ptr<ModuleLoadTrace> m_trace;
 };
 
 } // namespace facebook::react
@@ -34,7 +34,11 @@ enum ReactMarkerId {
   REGISTER_JS_SEGMENT_START,
   REGISTER_JS_SEGMENT_STOP,
   REACT_INSTANCE_INIT_START,
-  REACT_INSTANCE_INIT_STOP
+  REACT_INSTANCE_INIT_STOP,
+  PREPARE_JS_BUNDLE_START,
+  PREPARE_JS_BUNDLE_STOP,
+  INSTALL_RUNTIME_BINDINGS_START,
+  INSTALL_RUNTIME_BINDINGS_STOP
 };
 
 #ifdef __APPLE__
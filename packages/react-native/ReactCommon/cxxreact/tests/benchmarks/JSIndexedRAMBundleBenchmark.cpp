@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A 10MB bundle of 10k modules of ~1KB, of which a random fifth is loaded,
+ * like at startup.
+ */
+constexpr uint32_t kModuleCount = 10000;
+constexpr size_t kModuleSize = 1000;
+constexpr uint32_t kLoadedModuleCount = kModuleCount / 5;
+
+/*
+ * Writes the bundle to a temporary file.
+ */
+class BundleFile {
+ public:
+  BundleFile()
+      : path_(std::filesystem::temp_directory_path() /
+              "JSIndexedRAMBundleBenchmark.bundle") {
+    auto startupCode = std::string("startup();");
+    auto table = std::vector<uint32_t>{};
+    auto code = startupCode + '\0';
+    auto generator = std::mt19937{42};
+    for (uint32_t id = 0; id < kModuleCount; id++) {
+      auto module = "__d(function() { /* " + std::to_string(id) + " */ ";
+      while (module.size() < kModuleSize - 4) {
+        module += static_cast<char>('a' + generator() % 26);
+      }
+      module += " });";
+      table.push_back(static_cast<uint32_t>(code.size()));
+      table.push_back(static_cast<uint32_t>(module.size() + 1));
+      code += module + '\0';
+    }
+
+    auto header = std::vector<uint32_t>{
+        0xFB0BD1E5,
+        kModuleCount,
+        static_cast<uint32_t>(startupCode.size() + 1)};
+    auto file = std::ofstream(path_, std::ios::binary);
+    file.write(
+        reinterpret_cast<const char*>(header.data()),
+        header.size() * sizeof(uint32_t));
+    file.write(
+        reinterpret_cast<const char*>(table.data()),
+        table.size() * sizeof(uint32_t));
+    file.write(code.data(), code.size());
+
+    loadedModules_.resize(kModuleCount);
+    for (uint32_t id = 0; id < kModuleCount; id++) {
+      loadedModules_[id] = id;
+    }
+    std::shuffle(loadedModules_.begin(), loadedModules_.end(), generator);
+    loadedModules_.resize(kLoadedModuleCount);
+  }
+
+  ~BundleFile() {
+    std::filesystem::remove(path_);
+  }
+
+  const std::string& getPath() const {
+    return path_;
+  }
+
+  const std::vector<uint32_t>& getLoadedModules() const {
+    return loadedModules_;
+  }
+
+ private:
+  std::string path_;
+  std::vector<uint32_t> loadedModules_;
+};
+
+static void loadModules(benchmark::State& state) {
+  auto file = BundleFile{};
+  for (auto _ : state) {
+    auto bundle = JSIndexedRAMBundle{file.getPath().c_str()};
+    for (auto id : file.getLoadedModules()) {
+      auto module = bundle.getModuleSource(id);
+      benchmark::DoNotOptimize(module.code->c_str());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kLoadedModuleCount);
+}
+BENCHMARK(loadModules);
+
+/*
+ * Same, with the modules read ahead at once, like with the load order of a
+ * previous launch. This only pays off when the bundle isn't in the page
+ * cache yet, which is the case on cold starts but not here.
+ */
+static void loadPrefetchedModules(benchmark::State& state) {
+  auto file = BundleFile{};
+  for (auto _ : state) {
+    auto bundle = JSIndexedRAMBundle{file.getPath().c_str()};
+    bundle.prefetchModules(file.getLoadedModules());
+    for (auto id : file.getLoadedModules()) {
+      auto module = bundle.getModuleSource(id);
+      benchmark::DoNotOptimize(module.code->c_str());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kLoadedModuleCount);
+}
+BENCHMARK(loadPrefetchedModules);
+
+/*
+ * The previous way: a seek and a read into a new string per module.
+ */
+static void loadModulesWithStreamReads(benchmark::State& state) {
+  auto file = BundleFile{};
+  for (auto _ : state) {
+    auto stream = std::ifstream(file.getPath(), std::ifstream::binary);
+    uint32_t header[3];
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+    auto table = std::vector<uint32_t>(header[1] * 2);
+    stream.read(
+        reinterpret_cast<char*>(table.data()),
+        static_cast<std::streamsize>(table.size() * sizeof(uint32_t)));
+    auto baseOffset = sizeof(header) + table.size() * sizeof(uint32_t);
+
+    for (auto id : file.getLoadedModules()) {
+      auto code = std::string(table[id * 2 + 1] - 1, '\0');
+      stream.seekg(static_cast<std::streamoff>(baseOffset + table[id * 2]));
+      stream.read(&code.front(), static_cast<std::streamsize>(code.size()));
+      benchmark::DoNotOptimize(code.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kLoadedModuleCount);
+}
+BENCHMARK(loadModulesWithStreamReads);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/MethodCall.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+
+/*
+ * A batch of 100 calls, like the view updates and event listener calls of a
+ * frame. Each call is read the way JSIExecutor and JsToNativeBridge do, up to
+ * the arguments handed to the native module. Encoding the binary queue
+ * happens in JS, which isn't measured here: the binary queue stays behind
+ * `enableBinaryNativeCallQueue` until it is measured end to end.
+ */
+constexpr int kCallCount = 100;
+
+const char* kMakeQueue = R"(
+  (function () {
+    var queue = [[], [], [], 42];
+    for (var i = 0; i < 100; i++) {
+      queue[0].push(i % 7);
+      queue[1].push(i % 3);
+      queue[2].push([
+        i,
+        'RCTView',
+        {
+          opacity: 0.5,
+          backgroundColor: 4278190080,
+          transform: [{scale: 1.5}, {translateX: i}],
+          accessibilityLabel: 'Button ' + i,
+          hidden: false,
+        },
+        i * 2,
+      ]);
+    }
+    return queue;
+  })()
+)";
+
+jsi::Value makeQueue() {
+  return runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(kMakeQueue), "makeQueue.js");
+}
+
+/*
+ * Converts the whole queue to `folly::dynamic`, then splits it into calls.
+ */
+static void jsonQueue(benchmark::State& state) {
+  auto queue = makeQueue();
+  for (auto _ : state) {
+    auto calls = parseMethodCalls(jsi::dynamicFromValue(*runtime, queue));
+    for (auto& call : calls) {
+      auto arguments = std::move(call.arguments);
+      benchmark::DoNotOptimize(arguments);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCallCount);
+}
+BENCHMARK(jsonQueue);
+
+/*
+ * Reads the calls in place, decoding the arguments of each call when it is
+ * dispatched.
+ */
+static void binaryQueue(benchmark::State& state) {
+  auto queue = encodeMethodCalls(jsi::dynamicFromValue(*runtime, makeQueue()));
+  const auto* data = reinterpret_cast<const uint8_t*>(queue.data());
+  for (auto _ : state) {
+    auto calls = parseEncodedMethodCalls(data, queue.size());
+    for (const auto& call : calls) {
+      auto arguments = call.arguments.decode();
+      benchmark::DoNotOptimize(arguments);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCallCount);
+}
+BENCHMARK(binaryQueue);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
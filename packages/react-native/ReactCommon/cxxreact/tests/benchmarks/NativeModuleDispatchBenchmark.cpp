@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/CxxModule.h>
+#include <cxxreact/CxxNativeModule.h>
+#include <cxxreact/MessageQueueThread.h>
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModuleWorkerPool.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A batch of 64 calls spread over 4 modules, each call taking ~50us, like
+ * storage or crypto work. Measures the time until the batch completes, i.e.
+ * until onBatchComplete would be called.
+ */
+constexpr int kModuleCount = 4;
+constexpr int kCallCount = 64;
+constexpr auto kCallDuration = std::chrono::microseconds(50);
+
+/*
+ * The native modules thread.
+ */
+class ThreadMessageQueueThread : public MessageQueueThread {
+ public:
+  ThreadMessageQueueThread() : thread_([this]() { loop(); }) {}
+
+  ~ThreadMessageQueueThread() override {
+    quitSynchronous();
+  }
+
+  void runOnQueue(std::function<void()>&& callback) override {
+    {
+      auto lock = std::lock_guard<std::mutex>(mutex_);
+      callbacks_.push_back(std::move(callback));
+    }
+    condition_.notify_one();
+  }
+
+  void runOnQueueSync(std::function<void()>&& callback) override {
+    auto done = std::promise<void>{};
+    runOnQueue([&]() {
+      callback();
+      done.set_value();
+    });
+    done.get_future().wait();
+  }
+
+  void quitSynchronous() override {
+    {
+      auto lock = std::lock_guard<std::mutex>(mutex_);
+      if (quit_) {
+        return;
+      }
+      quit_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+  }
+
+ private:
+  void loop() {
+    while (true) {
+      auto callback = std::function<void()>{};
+      {
+        auto lock = std::unique_lock<std::mutex>(mutex_);
+        condition_.wait(
+            lock, [this]() { return quit_ || !callbacks_.empty(); });
+        if (callbacks_.empty()) {
+          return;
+        }
+        callback = std::move(callbacks_.front());
+        callbacks_.pop_front();
+      }
+      callback();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> callbacks_;
+  bool quit_{false};
+  std::thread thread_;
+};
+
+class BusyModule : public xplat::module::CxxModule {
+ public:
+  BusyModule(std::string name, bool isThreadSafe)
+      : name_(std::move(name)), isThreadSafe_(isThreadSafe) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::vector<Method> getMethods() override {
+    return {Method("work", []() {
+      auto end = std::chrono::steady_clock::now() + kCallDuration;
+      while (std::chrono::steady_clock::now() < end) {
+      }
+    })};
+  }
+
+  bool isThreadSafe() override {
+    return isThreadSafe_;
+  }
+
+ private:
+  std::string name_;
+  bool isThreadSafe_;
+};
+
+/*
+ * The first `state.range(0)` modules are thread safe, the others run on the
+ * native modules thread.
+ */
+static void completeMixedBatch(benchmark::State& state) {
+  auto nativeModulesThread = std::make_shared<ThreadMessageQueueThread>();
+  auto workerPool = std::make_shared<NativeModuleWorkerPool>();
+  auto modules = std::vector<std::unique_ptr<NativeModule>>{};
+  for (int i = 0; i < kModuleCount; i++) {
+    auto name = "Module" + std::to_string(i);
+    auto isThreadSafe = i < state.range(0);
+    modules.push_back(std::make_unique<CxxNativeModule>(
+        std::weak_ptr<Instance>(),
+        name,
+        [name, isThreadSafe]() {
+          return std::make_unique<BusyModule>(name, isThreadSafe);
+        },
+        nativeModulesThread,
+        workerPool));
+    modules.back()->getMethods();
+  }
+  auto registry = ModuleRegistry(std::move(modules));
+  registry.setWorkerPool(workerPool);
+
+  for (auto _ : state) {
+    for (int i = 0; i < kCallCount; i++) {
+      registry.callNativeMethod(
+          i % kModuleCount, 0, folly::dynamic::array(), i);
+    }
+
+    // Like onBatchComplete, which is queued on the native modules thread once
+    // the calls on the worker pool have run.
+    auto batchComplete = std::promise<void>{};
+    registry.runAfterDispatchedCalls([&]() {
+      nativeModulesThread->runOnQueue([&]() { batchComplete.set_value(); });
+    });
+    batchComplete.get_future().wait();
+  }
+  state.SetItemsProcessed(state.iterations() * kCallCount);
+}
+BENCHMARK(completeMixedBatch)
+    ->Arg(0)
+    ->Arg(kModuleCount / 2)
+    ->Arg(kModuleCount)
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
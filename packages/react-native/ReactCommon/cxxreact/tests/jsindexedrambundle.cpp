@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <ios>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+constexpr uint32_t kMagicNumber = 0xFB0BD1E5;
+
+void appendUInt32(std::string& bundle, uint32_t value) {
+  char bytes[sizeof(value)];
+  std::memcpy(bytes, &value, sizeof(value));
+  bundle.append(bytes, sizeof(bytes));
+}
+
+// Builds an indexed RAM bundle, modules without code have no entry.
+std::string makeBundle(
+    const std::string& startupCode,
+    const std::vector<std::optional<std::string>>& modules) {
+  auto bundle = std::string{};
+  appendUInt32(bundle, kMagicNumber);
+  appendUInt32(bundle, static_cast<uint32_t>(modules.size()));
+  appendUInt32(bundle, static_cast<uint32_t>(startupCode.size() + 1));
+
+  auto code = startupCode + '\0';
+  for (const auto& module : modules) {
+    if (module) {
+      appendUInt32(bundle, static_cast<uint32_t>(code.size()));
+      appendUInt32(bundle, static_cast<uint32_t>(module->size() + 1));
+      code += *module + '\0';
+    } else {
+      appendUInt32(bundle, 0);
+      appendUInt32(bundle, 0);
+    }
+  }
+  return bundle + code;
+}
+
+} // namespace
+
+TEST(JSIndexedRAMBundle, ReadsStartupCodeAndModules) {
+  auto script = std::make_unique<JSBigStdString>(
+      makeBundle("startup();", {"module(0);", std::nullopt, "module(2);"}));
+  const auto* begin = script->c_str();
+  const auto* end = begin + script->size();
+  JSIndexedRAMBundle bundle{std::move(script)};
+
+  auto startupCode = bundle.getStartupCode();
+  EXPECT_STREQ(startupCode->c_str(), "startup();");
+  EXPECT_EQ(startupCode->size(), 10);
+
+  auto module = bundle.getModuleSource(2);
+  EXPECT_EQ(module.name, "2.js");
+  EXPECT_STREQ(module.code->c_str(), "module(2);");
+  EXPECT_EQ(module.code->size(), 10);
+  // Not copied out of the bundle.
+  EXPECT_GE(module.code->c_str(), begin);
+  EXPECT_LT(module.code->c_str(), end);
+
+  EXPECT_EQ(bundle.getModule(0).code, "module(0);");
+}
+
+TEST(JSIndexedRAMBundle, ThrowsForModulesWithoutCode) {
+  JSIndexedRAMBundle bundle{std::make_unique<JSBigStdString>(
+      makeBundle("startup();", {"module(0);", std::nullopt}))};
+
+  EXPECT_THROW(bundle.getModuleSource(1), std::ios_base::failure);
+  EXPECT_THROW(bundle.getModuleSource(2), std::ios_base::failure);
+  EXPECT_THROW(bundle.getModule(2), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, ThrowsForTruncatedBundles) {
+  auto contents = makeBundle("startup();", {"module(0);"});
+
+  EXPECT_THROW(
+      JSIndexedRAMBundle{std::make_unique<JSBigStdString>(
+          contents.substr(0, 16))},
+      std::ios_base::failure);
+
+  JSIndexedRAMBundle bundle{std::make_unique<JSBigStdString>(
+      contents.substr(0, contents.size() - 4))};
+  EXPECT_THROW(bundle.getModuleSource(0), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, RecordsModuleLoadOrder) {
+  JSIndexedRAMBundle bundle{std::make_unique<JSBigStdString>(
+      makeBundle("startup();", {"0", "1", "2", "3"}))};
+
+  bundle.getModuleSource(2);
+  bundle.getModuleSource(0);
+  bundle.getModule(2);
+  bundle.getModule(3);
+
+  EXPECT_EQ(bundle.getModuleLoadOrder(), (std::vector<uint32_t>{2, 0, 3}));
+
+  // Prefetching is a hint, which doesn't count as loading.
+  bundle.prefetchModules({1, 4});
+  EXPECT_EQ(bundle.getModuleLoadOrder(), (std::vector<uint32_t>{2, 0, 3}));
+}
@@ -153,3 +153,69 @@ TEST(parseMethodCalls, ParseTwoCalls) {
   auto returnedCalls = parseMethodCalls(folly::parseJson(jsText));
   EXPECT_EQ(2, returnedCalls.size());
 }
+
+TEST(parseEncodedMethodCalls, RoundTripsCalls) {
+  auto calls = dynamic::array(
+      dynamic::array(7, 2),
+      dynamic::array(3, 0),
+      dynamic::array(
+          dynamic::array("foo", 42.5, 14, nullptr, true),
+          dynamic::array(
+              dynamic::object("nested", dynamic::array(false, "ü€😀")),
+              dynamic::array())),
+      10);
+
+  auto data = encodeMethodCalls(calls);
+  auto returnedCalls = parseEncodedMethodCalls(
+      reinterpret_cast<const uint8_t*>(data.data()), data.size());
+  ASSERT_EQ(2, returnedCalls.size());
+  EXPECT_EQ(7, returnedCalls[0].moduleId);
+  EXPECT_EQ(3, returnedCalls[0].methodId);
+  EXPECT_EQ(10, returnedCalls[0].callId);
+  EXPECT_EQ(2, returnedCalls[1].moduleId);
+  EXPECT_EQ(0, returnedCalls[1].methodId);
+  EXPECT_EQ(11, returnedCalls[1].callId);
+
+  // Numbers come back as doubles, like from JSIDynamic.
+  auto arguments = returnedCalls[0].arguments.decode();
+  EXPECT_EQ(calls[2][0], arguments);
+  EXPECT_EQ(folly::dynamic::DOUBLE, arguments[2].type());
+  EXPECT_EQ(calls[2][1], returnedCalls[1].arguments.decode());
+}
+
+TEST(parseEncodedMethodCalls, NoCallId) {
+  auto data = encodeMethodCalls(dynamic::array(
+      dynamic::array(1),
+      dynamic::array(2),
+      dynamic::array(dynamic::array())));
+  auto returnedCalls = parseEncodedMethodCalls(
+      reinterpret_cast<const uint8_t*>(data.data()), data.size());
+  ASSERT_EQ(1, returnedCalls.size());
+  EXPECT_EQ(-1, returnedCalls[0].callId);
+}
+
+TEST(parseEncodedMethodCalls, InvalidQueues) {
+  auto data = encodeMethodCalls(dynamic::array(
+      dynamic::array(1),
+      dynamic::array(2),
+      dynamic::array(dynamic::array("foo"))));
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+
+  EXPECT_THROW(parseEncodedMethodCalls(bytes, 0), std::invalid_argument);
+  EXPECT_THROW(
+      parseEncodedMethodCalls(bytes, data.size() - 1), std::invalid_argument);
+  auto extra = data + '\0';
+  EXPECT_THROW(
+      parseEncodedMethodCalls(
+          reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+      std::invalid_argument);
+
+  // Arguments are only validated when decoded.
+  auto corrupt = data;
+  // The type of the arguments array, before its count and "foo".
+  corrupt[corrupt.size() - 13] = 9;
+  auto returnedCalls = parseEncodedMethodCalls(
+      reinterpret_cast<const uint8_t*>(corrupt.data()), corrupt.size());
+  ASSERT_EQ(1, returnedCalls.size());
+  EXPECT_THROW(returnedCalls[0].arguments.decode(), std::invalid_argument);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/ModuleLoadTrace.h>
+#include <cxxreact/RAMBundleRegistry.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+class FakeUnbundle : public JSModulesUnbundle {
+ public:
+  explicit FakeUnbundle(std::vector<uint32_t>& prefetchedModules)
+      : prefetchedModules_(prefetchedModules) {}
+
+  Module getModule(uint32_t moduleId) const override {
+    return {
+        std::to_string(moduleId) + ".js",
+        "module(" + std::to_string(moduleId) + ");"};
+  }
+
+  void prefetchModules(const std::vector<uint32_t>& moduleIds) const override {
+    prefetchedModules_.insert(
+        prefetchedModules_.end(), moduleIds.begin(), moduleIds.end());
+  }
+
+ private:
+  std::vector<uint32_t>& prefetchedModules_;
+};
+
+ModuleLoadEvent makeEvent(
+    uint64_t timestamp,
+    uint32_t bundleId,
+    uint32_t moduleId) {
+  return {timestamp, bundleId, moduleId, 10, 0};
+}
+
+} // namespace
+
+TEST(ModuleLoadTrace, RoundTripsThroughSerialization) {
+  ModuleLoadTrace trace;
+  trace.record(0, 42, 100);
+  std::thread([&] { trace.record(1, 7, 200); }).join();
+  trace.record(0, 42, 100);
+
+  auto events = ModuleLoadTrace::deserialize(trace.serialize());
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events[0].bundleId, 0);
+  EXPECT_EQ(events[0].moduleId, 42);
+  EXPECT_EQ(events[0].size, 100);
+  EXPECT_EQ(events[1].bundleId, 1);
+  EXPECT_EQ(events[1].moduleId, 7);
+  EXPECT_EQ(events[1].size, 200);
+  EXPECT_NE(events[1].threadId, events[0].threadId);
+  EXPECT_EQ(events[2].threadId, events[0].threadId);
+  EXPECT_LE(events[0].timestamp, events[2].timestamp);
+
+  auto original = trace.getEvents();
+  for (size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ(events[i].timestamp, original[i].timestamp);
+  }
+}
+
+TEST(ModuleLoadTrace, ThrowsForMalformedTraces) {
+  ModuleLoadTrace trace;
+  trace.record(0, 1, 10);
+  auto data = trace.serialize();
+
+  EXPECT_THROW(ModuleLoadTrace::deserialize(""), std::runtime_error);
+  EXPECT_THROW(
+      ModuleLoadTrace::deserialize(data.substr(0, data.size() - 1)),
+      std::runtime_error);
+  data[0] = 'X';
+  EXPECT_THROW(ModuleLoadTrace::deserialize(data), std::runtime_error);
+}
+
+TEST(ModuleLoadTrace, DerivesPreloadListInFirstLoadOrder) {
+  auto events = std::vector<ModuleLoadEvent>{
+      makeEvent(10, 0, 5),
+      makeEvent(20, 1, 5),
+      makeEvent(15, 0, 3),
+      makeEvent(30, 0, 5),
+      makeEvent(40, 0, 9),
+  };
+
+  EXPECT_EQ(
+      getPreloadList(events),
+      (std::vector<ModulePreload>{{0, 5}, {1, 5}, {0, 3}, {0, 9}}));
+  EXPECT_EQ(
+      getPreloadList(events, std::chrono::nanoseconds{20}),
+      (std::vector<ModulePreload>{{0, 5}, {1, 5}, {0, 3}}));
+}
+
+TEST(ModuleLoadTrace, RoundTripsPreloadLists) {
+  auto preloadList = std::vector<ModulePreload>{{0, 5}, {1, 12}, {0, 3}};
+  auto text = formatPreloadList(preloadList);
+  EXPECT_EQ(text, "0 5\n1 12\n0 3\n");
+  EXPECT_EQ(parsePreloadList(text), preloadList);
+  EXPECT_EQ(
+      parsePreloadList("0 5\nnot a module\n\n1\n1 12"),
+      (std::vector<ModulePreload>{{0, 5}, {1, 12}}));
+}
+
+TEST(RAMBundleRegistry, RecordsModuleLoadsAndPrefetchesModules) {
+  auto prefetchedModules = std::vector<uint32_t>{};
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeUnbundle>(prefetchedModules));
+  auto trace = std::make_shared<ModuleLoadTrace>();
+
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 1);
+  registry->setModuleLoadTrace(trace);
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 2);
+  registry->getModuleSource(RAMBundleRegistry::MAIN_BUNDLE_ID, 3);
+
+  auto events = trace->getEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].moduleId, 2);
+  EXPECT_EQ(events[0].size, std::string("module(2);").size());
+  EXPECT_EQ(events[1].moduleId, 3);
+
+  // Bundles that aren't registered are skipped.
+  registry->prefetchModules(getPreloadList(events));
+  registry->prefetchModules({{1, 4}});
+  EXPECT_EQ(prefetchedModules, (std::vector<uint32_t>{2, 3}));
+}
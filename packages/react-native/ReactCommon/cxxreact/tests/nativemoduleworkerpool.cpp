@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/NativeModuleWorkerPool.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+TEST(NativeModuleWorkerPool, RunsCallsToAModuleInOrder) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(4);
+  auto queue = pool->createQueue();
+
+  std::mutex mutex;
+  std::vector<int> calls;
+  for (int i = 0; i < 1000; i++) {
+    queue->runOnQueue([&, i]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      calls.push_back(i);
+    });
+  }
+  queue->runOnQueueSync([]() {});
+
+  ASSERT_EQ(calls.size(), 1000);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(calls[i], i);
+  }
+}
+
+TEST(NativeModuleWorkerPool, RunsCallsToDifferentModulesInParallel) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(2);
+  auto firstQueue = pool->createQueue();
+  auto secondQueue = pool->createQueue();
+
+  // Would time out if the second call waited for the first one.
+  std::promise<void> secondCallRan;
+  auto secondCallRanFuture = secondCallRan.get_future();
+  std::promise<std::future_status> firstCallStatus;
+  firstQueue->runOnQueue([&]() {
+    firstCallStatus.set_value(secondCallRanFuture.wait_for(5s));
+  });
+  secondQueue->runOnQueue([&]() { secondCallRan.set_value(); });
+
+  EXPECT_EQ(firstCallStatus.get_future().get(), std::future_status::ready);
+}
+
+TEST(NativeModuleWorkerPool, RunsCallbacksOnceEarlierWorkIsDrained) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(2);
+  auto queue = pool->createQueue();
+
+  std::promise<void> unblock;
+  auto unblockFuture = unblock.get_future().share();
+  queue->runOnQueue([unblockFuture]() { unblockFuture.wait(); });
+
+  std::mutex mutex;
+  std::vector<int> callbacks;
+  std::promise<void> secondCallbackRan;
+  pool->runWhenDrained([&]() {
+    std::lock_guard<std::mutex> lock(mutex);
+    callbacks.push_back(1);
+  });
+  pool->runWhenDrained([&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      callbacks.push_back(2);
+    }
+    secondCallbackRan.set_value();
+  });
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_TRUE(callbacks.empty());
+  }
+  unblock.set_value();
+  secondCallbackRan.get_future().wait();
+  EXPECT_EQ(callbacks, (std::vector<int>{1, 2}));
+
+  // Nothing is queued anymore, so this runs right away.
+  bool ranRightAway = false;
+  pool->runWhenDrained([&]() { ranRightAway = true; });
+  EXPECT_TRUE(ranRightAway);
+}
+
+TEST(NativeModuleWorkerPool, DropsCallsAfterQuitting) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(1);
+  auto queue = pool->createQueue();
+
+  std::promise<void> unblock;
+  auto unblockFuture = unblock.get_future().share();
+  bool droppedCallRan = false;
+  queue->runOnQueue([unblockFuture]() { unblockFuture.wait(); });
+  queue->runOnQueue([&]() { droppedCallRan = true; });
+
+  auto quitting = std::async(std::launch::async, [&]() {
+    queue->quitSynchronous();
+  });
+  // Lets quitSynchronous drop the pending call before the running one
+  // returns.
+  std::this_thread::sleep_for(50ms);
+  unblock.set_value();
+  quitting.wait();
+  queue->runOnQueue([&]() { droppedCallRan = true; });
+  queue->runOnQueueSync([&]() { droppedCallRan = true; });
+
+  EXPECT_FALSE(droppedCallRan);
+  bool ranRightAway = false;
+  pool->runWhenDrained([&]() { ranRightAway = true; });
+  EXPECT_TRUE(ranRightAway);
+}
+
+TEST(NativeModuleWorkerPool, ReportsErrorsOfCalls) {
+  std::mutex mutex;
+  std::vector<std::string> errors;
+  auto pool = std::make_shared<NativeModuleWorkerPool>(
+      2, [&](std::exception_ptr error) {
+        try {
+          std::rethrow_exception(error);
+        } catch (const std::exception& ex) {
+          std::lock_guard<std::mutex> lock(mutex);
+          errors.emplace_back(ex.what());
+        }
+      });
+  auto queue = pool->createQueue();
+
+  queue->runOnQueue([]() { throw std::invalid_argument("first"); });
+  queue->runOnQueue([]() { throw std::runtime_error("second"); });
+  bool nextCallRan = false;
+  queue->runOnQueueSync([&]() { nextCallRan = true; });
+
+  EXPECT_TRUE(nextCallRan);
+  EXPECT_EQ(errors, (std::vector<std::string>{"first", "second"}));
+}
+
+TEST(NativeModuleWorkerPool, RunsSyncCallsFromTheQueueInline) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(1);
+  auto queue = pool->createQueue();
+
+  bool innerCallRan = false;
+  queue->runOnQueueSync(
+      [&]() { queue->runOnQueueSync([&]() { innerCallRan = true; }); });
+
+  EXPECT_TRUE(innerCallRan);
+}
+
+TEST(NativeModuleWorkerPool, CanBeReleasedByACall) {
+  auto pool = std::make_shared<NativeModuleWorkerPool>(2);
+  auto queue = pool->createQueue();
+  auto otherQueue = pool->createQueue();
+
+  std::promise<void> released;
+  queue->runOnQueue(
+      [pool = std::move(pool), &released]() mutable {
+        pool = nullptr;
+        released.set_value();
+      });
+  released.get_future().wait();
+
+  // The pool is destroyed once the call returns, and the queues are no-ops.
+  while (true) {
+    bool callRan = false;
+    otherQueue->runOnQueueSync([&]() { callRan = true; });
+    if (!callRan) {
+      break;
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+}
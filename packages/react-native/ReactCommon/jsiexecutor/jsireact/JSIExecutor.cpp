@@ -17,6 +17,7 @@
 #include <glog/logging.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/instrumentation.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
 #include <sstream>
@@ -110,6 +111,12 @@ void JSIExecutor::initializeRuntime() {
             return Value::undefined();
           }));
 
+  if (ReactNativeFeatureFlags::enableBinaryNativeCallQueue()) {
+    // Lets MessageQueue.js hand over calls as ArrayBuffers, which are cheaper
+    // to read than arrays of JS values.
+    runtime_->global().setProperty(*runtime_, "__nativeBinaryCallQueue", true);
+  }
+
   runtime_->global().setProperty(
       *runtime_,
       "nativeCallSyncHook",
@@ -396,6 +403,17 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
+  if (queue.isObject()) {
+    auto queueObject = queue.getObject(*runtime_);
+    if (queueObject.isArrayBuffer(*runtime_)) {
+      // A binary call queue, see __nativeBinaryCallQueue.
+      auto buffer = queueObject.getArrayBuffer(*runtime_);
+      delegate_->callNativeModules(
+          *this, buffer.data(*runtime_), buffer.size(*runtime_), isEndOfBatch);
+      return;
+    }
+  }
+
   delegate_->callNativeModules(
       *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
 }
@@ -438,10 +456,10 @@ Value JSIExecutor::nativeRequire(const Value* args, size_t count) {
 
   uint32_t moduleId = folly::to<uint32_t>(args[0].getNumber());
   uint32_t bundleId = count == 2 ? folly::to<uint32_t>(args[1].getNumber()) : 0;
-  auto module = bundleRegistry_->getModule(bundleId, moduleId);
+  auto module = bundleRegistry_->getModuleSource(bundleId, moduleId);
 
   runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+      std::make_unique<BigStringBuffer>(std::move(module.code)), module.name);
   return facebook::jsi::Value();
 }
 
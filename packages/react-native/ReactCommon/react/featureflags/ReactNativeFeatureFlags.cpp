@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<ef4ef80e1e4f93d3b643034213842676>>
+ * @generated SignedSource<<97a923dbe9caa9d4d2483f7853215be5>>
  */
 
 /**
@@ -54,6 +54,10 @@ bool ReactNativeFeatureFlags::enableAndroidLineHeightCentering() {
   return getAccessor().enableAndroidLineHeightCentering();
 }
 
+bool ReactNativeFeatureFlags::enableBinaryNativeCallQueue() {
+  return getAccessor().enableBinaryNativeCallQueue();
+}
+
 bool ReactNativeFeatureFlags::enableBridgelessArchitecture() {
   return getAccessor().enableBridgelessArchitecture();
 }
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<4a163a2008d8b4258395784286f6ab18>>
+ * @generated SignedSource<<fc59c759ecd24ec8f54ec38230c3d0ba>>
  */
 
 /**
@@ -74,6 +74,11 @@ class ReactNativeFeatureFlags {
    */
   RN_EXPORT static bool enableAndroidLineHeightCentering();
 
+  /**
+   * Enables handing native module calls over from JavaScript to JSIExecutor as ArrayBuffers instead of arrays of JS values.
+   */
+  RN_EXPORT static bool enableBinaryNativeCallQueue();
+
   /**
    * Feature flag to enable the new bridgeless architecture. Note: Enabling this will force enable the following flags: `useTurboModules` & `enableFabricRenderer.
    */
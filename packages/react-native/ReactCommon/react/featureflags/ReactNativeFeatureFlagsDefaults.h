@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<14f964cf6d43943bdeed783d28c231e0>>
+ * @generated SignedSource<<3298a5c2767ff51da20a62aac682a6db>>
  */
 
 /**
@@ -55,6 +55,10 @@ class ReactNativeFeatureFlagsDefaults : public ReactNativeFeatureFlagsProvider {
     return true;
   }
 
+  bool enableBinaryNativeCallQueue() override {
+    return false;
+  }
+
   bool enableBridgelessArchitecture() override {
     return false;
   }
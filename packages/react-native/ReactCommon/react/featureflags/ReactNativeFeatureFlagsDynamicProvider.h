@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<5183851785d301eed7757a67209ebef2>>
+ * @generated SignedSource<<8112c44a661fa181237998e0d3793f1d>>
  */
 
 /**
@@ -108,6 +108,15 @@ class ReactNativeFeatureFlagsDynamicProvider : public ReactNativeFeatureFlagsDef
     return ReactNativeFeatureFlagsDefaults::enableAndroidLineHeightCentering();
   }
 
+  bool enableBinaryNativeCallQueue() override {
+    auto value = values_["enableBinaryNativeCallQueue"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enableBinaryNativeCallQueue();
+  }
+
   bool enableBridgelessArchitecture() override {
     auto value = values_["enableBridgelessArchitecture"];
     if (!value.isNull()) {
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<c242ec280490cd3a44a8f304782e2b37>>
+ * @generated SignedSource<<fe909dd30dcd08bf1eb218a58a062a9d>>
  */
 
 /**
@@ -79,6 +79,11 @@ bool NativeReactNativeFeatureFlags::enableAndroidLineHeightCentering(
   return ReactNativeFeatureFlags::enableAndroidLineHeightCentering();
 }
 
+bool NativeReactNativeFeatureFlags::enableBinaryNativeCallQueue(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enableBinaryNativeCallQueue();
+}
+
 bool NativeReactNativeFeatureFlags::enableBridgelessArchitecture(
     jsi::Runtime& /*runtime*/) {
   return ReactNativeFeatureFlags::enableBridgelessArchitecture();
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<864803698ff070ce22a4b2f121acbbc0>>
+ * @generated SignedSource<<32e2fd7aa644e81ca3b210cab0e1d356>>
  */
 
 /**
@@ -51,6 +51,8 @@ class NativeReactNativeFeatureFlags
 
   bool enableAndroidLineHeightCentering(jsi::Runtime& runtime);
 
+  bool enableBinaryNativeCallQueue(jsi::Runtime& runtime);
+
   bool enableBridgelessArchitecture(jsi::Runtime& runtime);
 
   bool enableCppPropsIteratorSetter(jsi::Runtime& runtime);
@@ -57,10 +57,8 @@ jsi::Function makeTimeRemainingFunction(
             auto now = runtimeScheduler->now();
 
             remainingTime = std::max(
-                static_cast<double>(
-                    std::chrono::duration_cast<std::chrono::milliseconds>(
-                        deadline - now)
-                        .count()),
+                std::chrono::duration<double, std::milli>(deadline - now)
+                    .count(),
                 0.0);
 
             if (remainingTime == 0) {
@@ -103,14 +101,13 @@ CallbackHandle NativeIdleCallbacks::requestIdleCallback(
 
   auto wrappedCallback = [runtimeScheduler, expirationTime, userCallbackShared](
                              jsi::Runtime& runtime) -> void {
-    // This implementation gives each idle callback a 50ms deadline, instead of
-    // being shared by all idle callbacks. This is ok because we don't really
-    // have idle periods, and if a higher priority task comes in while we're
-    // executing an idle callback, we don't execute any more idle callbacks and
-    // we interrupt the current one. The general outcome should be the same.
+    // The deadline is the end of the current idle period: at most 50ms away,
+    // before the rendering of the next frame, and right away if other work is
+    // pending. If a higher priority task comes in while we're executing an
+    // idle callback, the remaining time drops to 0 as well.
 
     auto executionStartTime = runtimeScheduler->now();
-    auto deadline = executionStartTime + std::chrono::milliseconds(50);
+    auto deadline = runtimeScheduler->getIdleDeadline();
     auto didTimeout = expirationTime.has_value()
         ? executionStartTime > expirationTime
         : false;
@@ -10,6 +10,7 @@
 #include <cxxreact/JSExecutor.h>
 #include <jsinspector-modern/tracing/PerformanceTracer.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <algorithm>
 
 namespace facebook::react {
 
@@ -257,4 +258,16 @@ void PerformanceEntryReporter::reportLongTask(
   observerRegistry_->queuePerformanceEntry(entry);
 }
 
+void PerformanceEntryReporter::reportDroppedFrames(uint32_t count) {
+  frameStats_.droppedFrameCount += count;
+}
+
+void PerformanceEntryReporter::reportFrameYield(
+    DOMHighResTimeStamp timeToYield) {
+  frameStats_.frameYieldCount++;
+  frameStats_.totalTimeToYield += timeToYield;
+  frameStats_.maxTimeToYield =
+      std::max(frameStats_.maxTimeToYield, timeToYield);
+}
+
 } // namespace facebook::react
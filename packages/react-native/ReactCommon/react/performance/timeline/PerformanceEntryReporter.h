@@ -28,6 +28,20 @@ constexpr DOMHighResTimeStamp LONG_TASK_DURATION_THRESHOLD_MS = 50.0;
 
 class PerformanceEntryReporter {
  public:
+  /*
+   * Frame statistics of the JavaScript event loop, reported by the runtime
+   * scheduler when the host platform provides frame timing.
+   */
+  struct FrameStats {
+    // Frame deadlines missed by rendering updates.
+    uint32_t droppedFrameCount{0};
+    // Times the event loop yielded to the host before a frame deadline.
+    uint32_t frameYieldCount{0};
+    // How late, after tasks were asked to yield, the event loop yielded.
+    DOMHighResTimeStamp totalTimeToYield{0};
+    DOMHighResTimeStamp maxTimeToYield{0};
+  };
+
   PerformanceEntryReporter();
 
   // NOTE: This class is not thread safe, make sure that the calls are made from
@@ -77,6 +91,10 @@ class PerformanceEntryReporter {
     return eventCounts_;
   }
 
+  const FrameStats& getFrameStats() const {
+    return frameStats_;
+  }
+
   PerformanceEntry reportMark(
       const std::string& name,
       const std::optional<DOMHighResTimeStamp>& startTime = std::nullopt);
@@ -101,6 +119,10 @@ class PerformanceEntryReporter {
 
   void reportLongTask(double startTime, double duration);
 
+  void reportDroppedFrames(uint32_t count);
+
+  void reportFrameYield(double timeToYield);
+
  private:
   std::unique_ptr<PerformanceObserverRegistry> observerRegistry_;
 
@@ -112,6 +134,8 @@ class PerformanceEntryReporter {
 
   std::unordered_map<std::string, uint32_t> eventCounts_;
 
+  FrameStats frameStats_;
+
   std::function<double()> timeStampProvider_ = nullptr;
 
   double getMarkTime(const std::string& markName) const;
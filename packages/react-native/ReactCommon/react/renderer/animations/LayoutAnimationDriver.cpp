@@ -11,6 +11,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animations/utils.h>
 #include <algorithm>
+#include <array>
 
 namespace facebook::react {
 
@@ -26,33 +27,50 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       continue;
     }
 
+    // The plan is compiled when the animation starts; this only recompiles
+    // it if the keyframes were changed without keeping the plan in sync.
+    auto& plan = animation.plan;
+    if (plan.size() != animation.keyFrames.size()) {
+      compileAnimationPlan(animation);
+    }
+
+    // The contract with the "keyframes generation" phase is that any animated
+    // node will have a valid configuration. Progress only depends on the
+    // configuration, so it's calculated once per configuration, not per
+    // keyframe.
+    const auto& layoutAnimationConfig = animation.layoutAnimationConfig;
+    const auto progress = std::array{
+        calculateAnimationProgress(
+            now, animation, layoutAnimationConfig.createConfig),
+        calculateAnimationProgress(
+            now, animation, layoutAnimationConfig.updateConfig),
+        calculateAnimationProgress(
+            now, animation, layoutAnimationConfig.deleteConfig)};
+
+    // Interpolate
+    interpolateLayoutAnimationPlan(
+        plan, {progress[0].second, progress[1].second, progress[2].second});
+
     int incompleteAnimations = 0;
-    for (auto& keyframe : animation.keyFrames) {
+    for (size_t i = 0; i < animation.keyFrames.size(); i++) {
+      auto& keyframe = animation.keyFrames[i];
       if (keyframe.invalidated) {
         continue;
       }
 
-      const auto& baselineShadowView = keyframe.viewStart;
-      const auto& finalShadowView = keyframe.viewEnd;
-
-      // The contract with the "keyframes generation" phase is that any animated
-      // node will have a valid configuration.
-      const auto layoutAnimationConfig = animation.layoutAnimationConfig;
-      const auto& mutationConfig =
-          (keyframe.type == AnimationConfigurationType::Delete
-               ? layoutAnimationConfig.deleteConfig
-               : (keyframe.type == AnimationConfigurationType::Create
-                      ? layoutAnimationConfig.createConfig
-                      : layoutAnimationConfig.updateConfig));
+      auto animationTimeProgressLinear = progress[plan.configIndex[i]].first;
+      if (animationTimeProgressLinear < 1) {
+        incompleteAnimations++;
+      }
 
-      // Interpolate
-      auto progress =
-          calculateAnimationProgress(now, animation, mutationConfig);
-      auto animationTimeProgressLinear = progress.first;
-      auto animationInterpolationFactor = progress.second;
+      auto mutatedShadowView = createPlannedShadowView(plan, i, keyframe);
 
-      auto mutatedShadowView = createInterpolatedShadowView(
-          animationInterpolationFactor, baselineShadowView, finalShadowView);
+      // Views which didn't change since the previous frame (delayed, or
+      // already finished while others in the animation are still running)
+      // don't need to be mounted again.
+      if (mutatedShadowView == keyframe.viewPrev) {
+        continue;
+      }
 
       // Create the mutation instruction
       mutationsList.emplace_back(ShadowViewMutation::UpdateMutation(
@@ -61,10 +79,6 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       PrintMutationInstruction("Animation Progress:", mutationsList.back());
 
       keyframe.viewPrev = std::move(mutatedShadowView);
-
-      if (animationTimeProgressLinear < 1) {
-        incompleteAnimations++;
-      }
     }
 
     // Are there no ongoing mutations left in this animation?
@@ -149,7 +149,17 @@ bool LayoutAnimationKeyFrameManager::shouldAnimateFrame() const {
   return currentAnimation_ || !inflightAnimations_.empty();
 }
 
+bool LayoutAnimationKeyFrameManager::shouldAnimateFrame(
+    SurfaceId surfaceId) const {
+  std::scoped_lock lock(animatedSurfaceIdsMutex_);
+  return animatedSurfaceIds_.find(surfaceId) != animatedSurfaceIds_.end();
+}
+
 void LayoutAnimationKeyFrameManager::stopSurface(SurfaceId surfaceId) {
+  {
+    std::scoped_lock lock(animatedSurfaceIdsMutex_);
+    animatedSurfaceIds_.erase(surfaceId);
+  }
   std::scoped_lock lock(surfaceIdsToStopMutex_);
   surfaceIdsToStop_.insert(surfaceId);
 }
@@ -801,6 +811,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
       handleShouldFirstComeBeforeSecondRemovesOnly(immediateMutations);
 
       animation.keyFrames = keyFramesToAnimate;
+      compileAnimationPlan(animation);
       inflightAnimations_.push_back(std::move(animation));
 
       // At this point, we have the following information and knowledge graph:
@@ -1001,6 +1012,8 @@ LayoutAnimationKeyFrameManager::pullTransaction(
       mutationsForAnimation.begin(),
       mutationsForAnimation.end());
 
+  updateAnimatedSurfaceIds(surfaceId);
+
   // DEBUG ONLY: list existing inflight animations
 #ifdef LAYOUT_ANIMATION_VERBOSE_LOGGING
   LOG(ERROR) << "FINISHING DISPLAYING ONGOING inflightAnimations_!";
@@ -1152,6 +1165,83 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
   return mutatedShadowView;
 }
 
+void LayoutAnimationKeyFrameManager::compileAnimationPlan(
+    LayoutAnimation& animation) const {
+  auto& plan = animation.plan;
+  plan.clear();
+  plan.reserve(animation.keyFrames.size());
+
+  for (const auto& keyframe : animation.keyFrames) {
+    const auto& startingView = keyframe.viewStart;
+    const auto& finalView = keyframe.viewEnd;
+    const auto& finalFrame = finalView.layoutMetrics.frame;
+
+    // Same fallback as `createInterpolatedShadowView`: views which can't be
+    // interpolated jump to their final state.
+    if (!hasComponentDescriptorForShadowView(startingView) ||
+        startingView.props == nullptr || finalView.props == nullptr) {
+      plan.push_back(
+          animationConfigIndex(keyframe.type), finalFrame, finalFrame, false);
+      continue;
+    }
+
+    auto interpolatesProps = false;
+    if (getComponentDescriptorForShadowView(startingView)
+            .getTraits()
+            .check(ShadowNodeTraits::Trait::ViewKind)) {
+      const auto& startingProps =
+          static_cast<const ViewProps&>(*startingView.props);
+      const auto& finalProps = static_cast<const ViewProps&>(*finalView.props);
+      interpolatesProps = startingProps.opacity != finalProps.opacity ||
+          startingProps.transform != finalProps.transform;
+    }
+
+    plan.push_back(
+        animationConfigIndex(keyframe.type),
+        startingView.layoutMetrics.frame,
+        finalFrame,
+        interpolatesProps);
+  }
+}
+
+ShadowView LayoutAnimationKeyFrameManager::createPlannedShadowView(
+    LayoutAnimationPlan& plan,
+    size_t index,
+    const AnimationKeyFrame& keyframe) const {
+  const auto& finalView = keyframe.viewEnd;
+
+  // Based on the final view for the same reasons as in
+  // `createInterpolatedShadowView`.
+  auto mutatedShadowView = ShadowView(finalView);
+
+  auto factor = plan.factor[index];
+  if (plan.interpolatesProps[index] != 0) {
+    if (plan.propsFactor[index] == factor &&
+        keyframe.viewPrev.props != nullptr) {
+      mutatedShadowView.props = keyframe.viewPrev.props;
+    } else {
+      PropsParserContext propsParserContext{
+          finalView.surfaceId, *contextContainer_};
+      mutatedShadowView.props = interpolateProps(
+          getComponentDescriptorForShadowView(keyframe.viewStart),
+          propsParserContext,
+          factor,
+          keyframe.viewStart.props,
+          finalView.props,
+          finalView.layoutMetrics.frame.size);
+      plan.propsFactor[index] = factor;
+    }
+  }
+
+  auto& frame = mutatedShadowView.layoutMetrics.frame;
+  frame.origin.x = plan.x[index];
+  frame.origin.y = plan.y[index];
+  frame.size.width = plan.width[index];
+  frame.size.height = plan.height[index];
+
+  return mutatedShadowView;
+}
+
 void LayoutAnimationKeyFrameManager::callCallback(
     const LayoutAnimationCallbackWrapper& callback) const {
   runtimeExecutor_(
@@ -1556,6 +1646,8 @@ void LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations(
           }
 
           // Delete from existing animation
+          inflightAnimation.plan.erase(
+              static_cast<size_t>(it - inflightAnimation.keyFrames.begin()));
           it = inflightAnimation.keyFrames.erase(it);
         } else {
           it++;
@@ -1572,6 +1664,23 @@ void LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations(
   }
 }
 
+void LayoutAnimationKeyFrameManager::updateAnimatedSurfaceIds(
+    SurfaceId surfaceId) const {
+  auto isAnimated = std::any_of(
+      inflightAnimations_.begin(),
+      inflightAnimations_.end(),
+      [&](const auto& animation) {
+        return animation.surfaceId == surfaceId && !animation.completed;
+      });
+
+  std::scoped_lock lock(animatedSurfaceIdsMutex_);
+  if (isAnimated) {
+    animatedSurfaceIds_.insert(surfaceId);
+  } else {
+    animatedSurfaceIds_.erase(surfaceId);
+  }
+}
+
 void LayoutAnimationKeyFrameManager::deleteAnimationsForStoppedSurfaces()
     const {
   bool inflightAnimationsExistInitially = !inflightAnimations_.empty();
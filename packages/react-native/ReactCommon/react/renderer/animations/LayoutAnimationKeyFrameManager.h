@@ -58,6 +58,8 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
   // TODO: add SurfaceId to this API as well
   bool shouldAnimateFrame() const override;
 
+  bool shouldAnimateFrame(SurfaceId surfaceId) const override;
+
   void stopSurface(SurfaceId surfaceId) override;
 
 #pragma mark - MountingOverrideDelegate methods
@@ -118,6 +120,22 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       const ShadowView& startingView,
       const ShadowView& finalView) const;
 
+  /**
+   * Compiles `animation.plan` from the keyframes of the animation.
+   */
+  void compileAnimationPlan(LayoutAnimation& animation) const;
+
+  /**
+   * Returns the ShadowView of the keyframe at `index` for the frame computed
+   * by the latest `interpolateLayoutAnimationPlan` call. Props are only
+   * interpolated (and allocated) if the keyframe animates them and the
+   * interpolation factor changed since the previous frame.
+   */
+  ShadowView createPlannedShadowView(
+      LayoutAnimationPlan& plan,
+      size_t index,
+      const AnimationKeyFrame& keyframe) const;
+
   void callCallback(const LayoutAnimationCallbackWrapper& callback) const;
 
   virtual void animationMutationsForFrame(
@@ -144,6 +162,13 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
   mutable std::mutex surfaceIdsToStopMutex_;
   mutable std::unordered_set<SurfaceId> surfaceIdsToStop_{};
 
+  /*
+   * Surfaces with in-flight animations, as of their latest `pullTransaction`.
+   * Read from the thread driving `UIManager::animationTick`.
+   */
+  mutable std::mutex animatedSurfaceIdsMutex_;
+  mutable std::unordered_set<SurfaceId> animatedSurfaceIds_{};
+
   // Function that returns current time in milliseconds
   std::function<uint64_t()> now_;
 
@@ -163,6 +188,11 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       const ShadowViewMutationList& mutations,
       std::vector<AnimationKeyFrame>& conflictingAnimations) const;
 
+  /*
+   * Records whether the surface still has in-flight animations.
+   */
+  void updateAnimatedSurfaceIds(SurfaceId surfaceId) const;
+
   /*
    * Removes animations from `inflightAnimations_` for stopped surfaces.
    */
@@ -10,8 +10,11 @@
 #include <react/renderer/animations/LayoutAnimationCallbackWrapper.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Rect.h>
 #include <react/renderer/mounting/ShadowView.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace facebook::react {
@@ -90,6 +93,104 @@ struct AnimationKeyFrame {
   bool generateFinalSyntheticMutations{true};
 };
 
+/*
+ * Per-frame work of a `LayoutAnimation`, compiled once when the animation
+ * starts. Values are stored in parallel arrays indexed like
+ * `LayoutAnimation::keyFrames`, so interpolating the frames of all keyframes
+ * is a single pass over contiguous floats.
+ */
+struct LayoutAnimationPlan {
+  // Index of the configuration driving a keyframe: create, update or delete.
+  std::vector<uint8_t> configIndex;
+
+  // Frame of the view at the start and at the end of the animation.
+  std::vector<Float> startX;
+  std::vector<Float> startY;
+  std::vector<Float> startWidth;
+  std::vector<Float> startHeight;
+  std::vector<Float> endX;
+  std::vector<Float> endY;
+  std::vector<Float> endWidth;
+  std::vector<Float> endHeight;
+
+  // Whether the opacity or the transform of the view change over the
+  // animation. If not, the final props are used as-is for every frame.
+  std::vector<uint8_t> interpolatesProps;
+
+  // Interpolation factor the props of `viewPrev` were computed for; NaN if
+  // they weren't computed yet.
+  std::vector<Float> propsFactor;
+
+  // Results of the latest `interpolateLayoutAnimationPlan` call.
+  std::vector<Float> factor;
+  std::vector<Float> x;
+  std::vector<Float> y;
+  std::vector<Float> width;
+  std::vector<Float> height;
+
+  size_t size() const {
+    return configIndex.size();
+  }
+
+  void clear() {
+    forEachArray([](auto& array) { array.clear(); });
+  }
+
+  void reserve(size_t size) {
+    forEachArray([&](auto& array) { array.reserve(size); });
+  }
+
+  void erase(size_t index) {
+    forEachArray([&](auto& array) {
+      array.erase(array.begin() + static_cast<std::ptrdiff_t>(index));
+    });
+  }
+
+  void push_back(
+      uint8_t keyFrameConfigIndex,
+      const Rect& startFrame,
+      const Rect& endFrame,
+      bool keyFrameInterpolatesProps) {
+    configIndex.push_back(keyFrameConfigIndex);
+    startX.push_back(startFrame.origin.x);
+    startY.push_back(startFrame.origin.y);
+    startWidth.push_back(startFrame.size.width);
+    startHeight.push_back(startFrame.size.height);
+    endX.push_back(endFrame.origin.x);
+    endY.push_back(endFrame.origin.y);
+    endWidth.push_back(endFrame.size.width);
+    endHeight.push_back(endFrame.size.height);
+    interpolatesProps.push_back(keyFrameInterpolatesProps ? 1 : 0);
+    propsFactor.push_back(std::numeric_limits<Float>::quiet_NaN());
+    factor.push_back(0);
+    x.push_back(startFrame.origin.x);
+    y.push_back(startFrame.origin.y);
+    width.push_back(startFrame.size.width);
+    height.push_back(startFrame.size.height);
+  }
+
+ private:
+  template <typename Function>
+  void forEachArray(Function&& function) {
+    function(configIndex);
+    function(startX);
+    function(startY);
+    function(startWidth);
+    function(startHeight);
+    function(endX);
+    function(endY);
+    function(endWidth);
+    function(endHeight);
+    function(interpolatesProps);
+    function(propsFactor);
+    function(factor);
+    function(x);
+    function(y);
+    function(width);
+    function(height);
+  }
+};
+
 struct LayoutAnimation {
   SurfaceId surfaceId;
   uint64_t startTime;
@@ -98,6 +199,7 @@ struct LayoutAnimation {
   LayoutAnimationCallbackWrapper successCallback;
   LayoutAnimationCallbackWrapper failureCallback;
   std::vector<AnimationKeyFrame> keyFrames;
+  LayoutAnimationPlan plan;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <ReactCommon/RuntimeExecutor.h>
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProvider.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Frame time and mutations per frame of layout animations of 500 views
+ * animating at the same time.
+ */
+constexpr auto kViewCount = 500;
+constexpr auto kAnimationDuration = 300;
+constexpr auto kFrameDuration = 16;
+constexpr auto kFrameCount = kAnimationDuration / kFrameDuration;
+constexpr auto kSurfaceId = SurfaceId{1};
+constexpr auto kRootTag = Tag{1};
+
+class LayoutAnimationFrameBenchmark {
+ public:
+  LayoutAnimationFrameBenchmark()
+      : contextContainer_(std::make_shared<const ContextContainer>()),
+        parameters_{EventDispatcher::Shared{}, contextContainer_, nullptr},
+        viewComponentDescriptor_(parameters_),
+        parserContext_{kSurfaceId, *contextContainer_} {
+    auto providerRegistry =
+        std::make_shared<ComponentDescriptorProviderRegistry>();
+    componentDescriptorRegistry_ =
+        providerRegistry->createComponentDescriptorRegistry(parameters_);
+    providerRegistry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    RuntimeExecutor runtimeExecutor =
+        [](const std::function<void(jsi::Runtime&)>& /*unused*/) {};
+    driver_ = std::make_shared<LayoutAnimationDriver>(
+        runtimeExecutor, contextContainer_, nullptr);
+    driver_->setComponentDescriptorRegistry(componentDescriptorRegistry_);
+    driver_->setClockNow([this]() { return now_; });
+
+    for (int i = 0; i < kViewCount; i++) {
+      auto family = viewComponentDescriptor_.createFamily(
+          {kRootTag + 1 + i, kSurfaceId, nullptr});
+      auto shadowNode = viewComponentDescriptor_.createShadowNode(
+          ShadowNodeFragment{
+              makeProps(1), ShadowNodeFragment::childrenPlaceholder()},
+          family);
+      auto shadowView = ShadowView(*shadowNode);
+      shadowView.layoutMetrics.frame = makeFrame(i, 0);
+      views_.push_back(std::move(shadowView));
+    }
+  }
+
+  /*
+   * Starts an animation moving and resizing every view and, if
+   * `animateOpacity` is set, fading it as well. Then runs all its frames and
+   * returns the number of mutations the last frame produced.
+   */
+  size_t animate(bool animateOpacity) {
+    configureNext(/* delay */ 0);
+    auto mutations = makeUpdateMutations(0, 1, animateOpacity);
+
+    auto mutationCount = size_t{0};
+    for (int frame = 0; frame <= kFrameCount + 1; frame++) {
+      mutationCount = pullFrame(
+          frame == 0 ? std::move(mutations) : ShadowViewMutation::List{});
+    }
+    return mutationCount;
+  }
+
+  /*
+   * Heavy `LayoutAnimation.configureNext` usage: every few frames, a new
+   * delayed animation moves a quarter of the views, interrupting their
+   * ongoing animations. Returns the average number of mutations per frame.
+   */
+  double animateRepeatedly() {
+    auto mutationCount = size_t{0};
+    for (int frame = 0; frame < kRepeatedFrameCount; frame++) {
+      auto mutations = ShadowViewMutation::List{};
+      if (frame % kFramesBetweenConfigureNext == 0) {
+        configureNext(/* delay */ kAnimationDuration / 2);
+        auto quarter =
+            static_cast<size_t>(frame / kFramesBetweenConfigureNext % 4);
+        mutations = makeUpdateMutations(
+            quarter, 4, /* animateOpacity */ frame % 3 == 0);
+      }
+      mutationCount += pullFrame(std::move(mutations));
+    }
+    return static_cast<double>(mutationCount) / kRepeatedFrameCount;
+  }
+
+ private:
+  static constexpr auto kFramesBetweenConfigureNext = 4;
+  static constexpr auto kRepeatedFrameCount = 4 * kFrameCount;
+
+  void configureNext(int delay) {
+    driver_->uiManagerDidConfigureNextLayoutAnimation(
+        {kSurfaceId,
+         now_,
+         false,
+         {kAnimationDuration,
+          {AnimationType::Linear,
+           AnimationProperty::Opacity,
+           kAnimationDuration,
+           0,
+           0,
+           0},
+          {AnimationType::EaseInEaseOut,
+           AnimationProperty::NotApplicable,
+           kAnimationDuration,
+           static_cast<double>(delay),
+           0,
+           0},
+          {AnimationType::Linear,
+           AnimationProperty::Opacity,
+           kAnimationDuration,
+           0,
+           0,
+           0}},
+         {},
+         {},
+         {}});
+  }
+
+  /*
+   * Moves every `step`-th view, starting with `first`.
+   */
+  ShadowViewMutation::List
+  makeUpdateMutations(size_t first, size_t step, bool animateOpacity) {
+    auto mutations = ShadowViewMutation::List{};
+    mutations.reserve(views_.size() / step + 1);
+    generation_++;
+    for (size_t i = first; i < views_.size(); i += step) {
+      auto newView = views_[i];
+      newView.layoutMetrics.frame =
+          makeFrame(static_cast<int>(i), generation_);
+      if (animateOpacity) {
+        newView.props = generation_ % 2 == 0 ? opaqueProps_ : translucentProps_;
+      }
+      mutations.push_back(
+          ShadowViewMutation::UpdateMutation(views_[i], newView, kRootTag));
+      views_[i] = std::move(newView);
+    }
+    return mutations;
+  }
+
+  /*
+   * Pulls the transaction of one frame and returns its number of mutations.
+   */
+  size_t pullFrame(ShadowViewMutation::List mutations) {
+    auto transaction = driver_->pullTransaction(
+        kSurfaceId, 0, TransactionTelemetry{}, std::move(mutations));
+    now_ += kFrameDuration;
+    return transaction.has_value() ? transaction->getMutations().size() : 0;
+  }
+
+  Props::Shared makeProps(Float opacity) {
+    auto dynamic = folly::dynamic::object("opacity", opacity);
+    return viewComponentDescriptor_.cloneProps(
+        parserContext_, nullptr, RawProps{dynamic});
+  }
+
+  static Rect makeFrame(int index, int generation) {
+    auto offset = Float(generation % 2 == 0 ? 0 : 50);
+    return {{offset, Float(index * 20)}, {100 + offset, 20}};
+  }
+
+  ContextContainer::Shared contextContainer_;
+  ComponentDescriptorParameters parameters_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  PropsParserContext parserContext_;
+  SharedComponentDescriptorRegistry componentDescriptorRegistry_;
+  std::shared_ptr<LayoutAnimationDriver> driver_;
+  std::vector<ShadowView> views_;
+  Props::Shared opaqueProps_{makeProps(1)};
+  Props::Shared translucentProps_{makeProps(0.5)};
+  uint64_t now_{0};
+  int generation_{0};
+};
+
+static void layoutOnlyAnimationOf500Views(benchmark::State& state) {
+  auto animation = LayoutAnimationFrameBenchmark{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(animation.animate(/* animateOpacity */ false));
+  }
+  state.SetItemsProcessed(state.iterations() * (kFrameCount + 2));
+}
+BENCHMARK(layoutOnlyAnimationOf500Views);
+
+static void layoutAndOpacityAnimationOf500Views(benchmark::State& state) {
+  auto animation = LayoutAnimationFrameBenchmark{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(animation.animate(/* animateOpacity */ true));
+  }
+  state.SetItemsProcessed(state.iterations() * (kFrameCount + 2));
+}
+BENCHMARK(layoutAndOpacityAnimationOf500Views);
+
+static void repeatedConfigureNextOf500Views(benchmark::State& state) {
+  auto animation = LayoutAnimationFrameBenchmark{};
+  auto mutationsPerFrame = 0.0;
+  for (auto _ : state) {
+    mutationsPerFrame = animation.animateRepeatedly();
+  }
+  state.counters["mutationsPerFrame"] = mutationsPerFrame;
+}
+BENCHMARK(repeatedConfigureNextOf500Views);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -66,4 +66,31 @@ std::pair<Float, Float> calculateAnimationProgress(
   }
 }
 
+void interpolateLayoutAnimationPlan(
+    LayoutAnimationPlan& plan,
+    const std::array<Float, 3>& configFactors) {
+  auto size = plan.size();
+  const auto* configIndex = plan.configIndex.data();
+  auto* factor = plan.factor.data();
+  for (size_t i = 0; i < size; i++) {
+    factor[i] = configFactors[configIndex[i]];
+  }
+
+  // Plain loops over separate arrays, so they can be vectorized.
+  auto lerp = [&](const std::vector<Float>& start,
+                  const std::vector<Float>& end,
+                  std::vector<Float>& result) {
+    const auto* startData = start.data();
+    const auto* endData = end.data();
+    auto* resultData = result.data();
+    for (size_t i = 0; i < size; i++) {
+      resultData[i] = startData[i] + (endData[i] - startData[i]) * factor[i];
+    }
+  };
+  lerp(plan.startX, plan.endX, plan.x);
+  lerp(plan.startY, plan.endY, plan.y);
+  lerp(plan.startWidth, plan.endWidth, plan.width);
+  lerp(plan.startHeight, plan.endHeight, plan.height);
+}
+
 } // namespace facebook::react
@@ -10,6 +10,7 @@
 #include <react/renderer/animations/primitives.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <array>
 
 namespace facebook::react {
 
@@ -120,4 +121,29 @@ std::pair<Float, Float> calculateAnimationProgress(
     const LayoutAnimation& animation,
     const AnimationConfig& mutationConfig);
 
+/*
+ * Index of the configuration of `LayoutAnimationConfig` driving keyframes of
+ * the given type, as stored in `LayoutAnimationPlan::configIndex`.
+ */
+static inline uint8_t animationConfigIndex(
+    AnimationConfigurationType type) noexcept {
+  switch (type) {
+    case AnimationConfigurationType::Create:
+      return 0;
+    case AnimationConfigurationType::Delete:
+      return 2;
+    default:
+      return 1;
+  }
+}
+
+/*
+ * Computes the interpolation factor and the interpolated frame of every
+ * keyframe of the plan, given the interpolation factors of the create, update
+ * and delete configurations.
+ */
+void interpolateLayoutAnimationPlan(
+    LayoutAnimationPlan& plan,
+    const std::array<Float, 3>& configFactors);
+
 } // namespace facebook::react
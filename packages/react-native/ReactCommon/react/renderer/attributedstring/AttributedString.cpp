@@ -142,7 +142,7 @@ SharedDebugStringConvertibleList AttributedString::getDebugChildren() const {
 
   for (auto&& fragment : fragments_) {
     auto propsList =
-        fragment.textAttributes.DebugStringConvertible::getDebugProps();
+        fragment.textAttributes->DebugStringConvertible::getDebugProps();
 
     list.push_back(std::make_shared<DebugStringConvertibleItem>(
         "Fragment",
@@ -9,6 +9,7 @@
 
 #include <memory>
 
+#include <react/renderer/attributedstring/InternedTextAttributes.h>
 #include <react/renderer/attributedstring/TextAttributes.h>
 #include <react/renderer/core/Sealable.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -35,7 +36,7 @@ class AttributedString : public Sealable, public DebugStringConvertible {
     static std::string AttachmentCharacter();
 
     std::string string;
-    TextAttributes textAttributes;
+    InternedTextAttributes textAttributes;
     ShadowView parentShadowView;
 
     /*
@@ -0,0 +1,606 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AttributedStringRope.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// Hashes are polynomial (modulo 2^64) over the sequence of (byte, attributes)
+// pairs, so the hash of a concatenation can be computed from the hashes of
+// its parts, and doesn't depend on how the text is split into chunks.
+constexpr uint64_t kBase = 0x100'0000'01b3ULL;
+constexpr uint64_t kByteMultiplier = 0x9E37'79B9'7F4A'7C15ULL;
+
+struct Hashes {
+  // `kBase` to the power of the length of the hashed text.
+  uint64_t power{1};
+  uint64_t hash{0};
+  uint64_t layoutWiseHash{0};
+};
+
+Hashes concatenate(const Hashes& lhs, const Hashes& rhs) {
+  return {
+      lhs.power * rhs.power,
+      lhs.hash * rhs.power + rhs.hash,
+      lhs.layoutWiseHash * rhs.power + rhs.layoutWiseHash};
+}
+
+Hashes hashText(
+    std::string_view text,
+    const InternedTextAttributes& textAttributes) {
+  auto hashes = Hashes{};
+  for (auto character : text) {
+    auto byte = (static_cast<uint8_t>(character) + uint64_t{1}) *
+        kByteMultiplier;
+    hashes.power *= kBase;
+    hashes.hash = hashes.hash * kBase + (byte ^ textAttributes.getHash());
+    hashes.layoutWiseHash = hashes.layoutWiseHash * kBase +
+        (byte ^ textAttributes.getLayoutWiseHash());
+  }
+  return hashes;
+}
+
+uint64_t power(uint64_t base, size_t exponent) {
+  auto result = uint64_t{1};
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result *= base;
+    }
+    base *= base;
+    exponent >>= 1;
+  }
+  return result;
+}
+
+uint32_t makePriority() {
+  thread_local auto generator = std::minstd_rand{};
+  return static_cast<uint32_t>(generator());
+}
+
+struct Chunk {
+  std::string text;
+  InternedTextAttributes textAttributes;
+  Hashes hashes;
+};
+
+using SharedChunk = std::shared_ptr<const Chunk>;
+
+SharedChunk makeChunk(
+    std::string text,
+    const InternedTextAttributes& textAttributes) {
+  auto hashes = hashText(text, textAttributes);
+  return std::make_shared<const Chunk>(
+      Chunk{std::move(text), textAttributes, hashes});
+}
+
+} // namespace
+
+/*
+ * A node of a treap (a binary search tree ordered by text offset and a heap
+ * ordered by random priorities). Nodes are immutable; edits copy the path
+ * from the root to the changed nodes.
+ */
+struct AttributedStringRopeNode {
+  std::shared_ptr<const AttributedStringRopeNode> left;
+  std::shared_ptr<const AttributedStringRopeNode> right;
+  SharedChunk chunk;
+  uint32_t priority;
+
+  // Of the whole subtree.
+  size_t length;
+  Hashes hashes;
+};
+
+namespace {
+
+using Node = AttributedStringRopeNode;
+using NodePtr = std::shared_ptr<const Node>;
+
+size_t lengthOf(const NodePtr& node) {
+  return node ? node->length : 0;
+}
+
+Hashes hashesOf(const NodePtr& node) {
+  return node ? node->hashes : Hashes{};
+}
+
+NodePtr makeNode(
+    NodePtr left,
+    SharedChunk chunk,
+    uint32_t priority,
+    NodePtr right) {
+  auto length = lengthOf(left) + chunk->text.size() + lengthOf(right);
+  auto hashes = concatenate(
+      concatenate(hashesOf(left), chunk->hashes), hashesOf(right));
+  return std::make_shared<const Node>(Node{
+      std::move(left),
+      std::move(right),
+      std::move(chunk),
+      priority,
+      length,
+      hashes});
+}
+
+NodePtr merge(const NodePtr& lhs, const NodePtr& rhs) {
+  if (!lhs) {
+    return rhs;
+  }
+  if (!rhs) {
+    return lhs;
+  }
+
+  if (lhs->priority > rhs->priority) {
+    return makeNode(
+        lhs->left, lhs->chunk, lhs->priority, merge(lhs->right, rhs));
+  }
+  return makeNode(
+      merge(lhs, rhs->left), rhs->chunk, rhs->priority, rhs->right);
+}
+
+/*
+ * Splits the subtree into the first `offset` bytes and the rest. A chunk
+ * containing `offset` is split in two.
+ */
+std::pair<NodePtr, NodePtr> split(const NodePtr& node, size_t offset) {
+  if (!node) {
+    return {};
+  }
+
+  auto leftLength = lengthOf(node->left);
+  auto chunkLength = node->chunk->text.size();
+
+  if (offset <= leftLength) {
+    auto [left, right] = split(node->left, offset);
+    return {
+        left, makeNode(right, node->chunk, node->priority, node->right)};
+  }
+
+  if (offset >= leftLength + chunkLength) {
+    auto [left, right] =
+        split(node->right, offset - leftLength - chunkLength);
+    return {
+        makeNode(node->left, node->chunk, node->priority, left), right};
+  }
+
+  // Both halves of the chunk get new priorities, otherwise repeated splits
+  // would create many nodes with equal priorities and unbalance the tree.
+  auto chunkOffset = offset - leftLength;
+  const auto& chunk = *node->chunk;
+  return {
+      merge(
+          node->left,
+          makeNode(
+              nullptr,
+              makeChunk(
+                  chunk.text.substr(0, chunkOffset), chunk.textAttributes),
+              makePriority(),
+              nullptr)),
+      merge(
+          makeNode(
+              nullptr,
+              makeChunk(chunk.text.substr(chunkOffset), chunk.textAttributes),
+              makePriority(),
+              nullptr),
+          node->right)};
+}
+
+/*
+ * Appends `text` to the last chunk of the subtree if it has the same
+ * attributes and enough room. Returns `nullptr` otherwise.
+ */
+NodePtr appendToLastChunk(
+    const NodePtr& node,
+    std::string_view text,
+    const InternedTextAttributes& textAttributes) {
+  if (!node) {
+    return nullptr;
+  }
+
+  if (node->right) {
+    auto right = appendToLastChunk(node->right, text, textAttributes);
+    return right ? makeNode(node->left, node->chunk, node->priority, right)
+                 : nullptr;
+  }
+
+  const auto& chunk = *node->chunk;
+  if (chunk.textAttributes != textAttributes ||
+      chunk.text.size() + text.size() >
+          AttributedStringRope::kMaxChunkSize) {
+    return nullptr;
+  }
+
+  auto chunkText = chunk.text;
+  chunkText.append(text);
+  return makeNode(
+      node->left,
+      makeChunk(std::move(chunkText), textAttributes),
+      node->priority,
+      nullptr);
+}
+
+NodePtr buildNodes(
+    std::string_view text,
+    const InternedTextAttributes& textAttributes) {
+  auto result = NodePtr{};
+  for (size_t offset = 0; offset < text.size();
+       offset += AttributedStringRope::kMaxChunkSize) {
+    auto chunkText =
+        text.substr(offset, AttributedStringRope::kMaxChunkSize);
+    result = merge(
+        result,
+        makeNode(
+            nullptr,
+            makeChunk(std::string{chunkText}, textAttributes),
+            makePriority(),
+            nullptr));
+  }
+  return result;
+}
+
+/*
+ * Hashes of the first `length` bytes of the subtree.
+ */
+Hashes prefixHashes(const NodePtr& root, size_t length) {
+  auto result = Hashes{};
+  auto node = root.get();
+  while (node != nullptr && length > 0) {
+    auto leftLength = lengthOf(node->left);
+    if (length <= leftLength) {
+      node = node->left.get();
+      continue;
+    }
+
+    result = concatenate(result, hashesOf(node->left));
+    length -= leftLength;
+
+    const auto& chunk = *node->chunk;
+    if (length <= chunk.text.size()) {
+      return concatenate(
+          result,
+          length == chunk.text.size()
+              ? chunk.hashes
+              : hashText(
+                    std::string_view{chunk.text}.substr(0, length),
+                    chunk.textAttributes));
+    }
+
+    result = concatenate(result, chunk.hashes);
+    length -= chunk.text.size();
+    node = node->right.get();
+  }
+  return result;
+}
+
+/*
+ * Hash of the last `length` bytes of the subtree.
+ */
+uint64_t suffixHash(const NodePtr& node, size_t length) {
+  auto prefix = prefixHashes(node, lengthOf(node) - length);
+  return hashesOf(node).hash - prefix.hash * power(kBase, length);
+}
+
+template <typename PredicateT>
+size_t findLongest(size_t maximum, PredicateT&& predicate) {
+  // `predicate` holds for all values up to the result.
+  auto low = size_t{0};
+  auto high = maximum;
+  while (low < high) {
+    auto middle = low + (high - low + 1) / 2;
+    if (predicate(middle)) {
+      low = middle;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return low;
+}
+
+void collectChunks(const NodePtr& node, std::vector<const Chunk*>& chunks) {
+  if (!node) {
+    return;
+  }
+  collectChunks(node->left, chunks);
+  chunks.push_back(node->chunk.get());
+  collectChunks(node->right, chunks);
+}
+
+/*
+ * Walks the content of a subtree from a given offset. The content is split
+ * into pieces: whole subtrees, which can be skipped at once when both
+ * compared ropes share them, and parts of chunks.
+ */
+class ContentCursor {
+ public:
+  struct Piece {
+    // Set for whole subtrees.
+    const Node* node{nullptr};
+    // Set for parts of chunks.
+    const Chunk* chunk{nullptr};
+    size_t chunkOffset{0};
+    size_t length{0};
+  };
+
+  ContentCursor(const NodePtr& root, size_t offset) {
+    auto node = root.get();
+    while (node != nullptr) {
+      auto leftLength = lengthOf(node->left);
+      auto chunkLength = node->chunk->text.size();
+      if (offset < leftLength) {
+        pushNode(node->right.get());
+        pushChunk(node->chunk.get(), 0);
+        node = node->left.get();
+      } else if (offset < leftLength + chunkLength) {
+        pushNode(node->right.get());
+        pushChunk(node->chunk.get(), offset - leftLength);
+        return;
+      } else {
+        offset -= leftLength + chunkLength;
+        node = node->right.get();
+      }
+    }
+  }
+
+  const Piece& front() const {
+    return pieces_.back();
+  }
+
+  /*
+   * Replaces the subtree in front with its left subtree, chunk and right
+   * subtree.
+   */
+  void expand() {
+    auto node = pieces_.back().node;
+    pieces_.pop_back();
+    pushNode(node->right.get());
+    pushChunk(node->chunk.get(), 0);
+    pushNode(node->left.get());
+  }
+
+  void advance(size_t length) {
+    auto& piece = pieces_.back();
+    if (length < piece.length) {
+      piece.chunkOffset += length;
+      piece.length -= length;
+    } else {
+      pieces_.pop_back();
+    }
+  }
+
+ private:
+  void pushNode(const Node* node) {
+    if (node != nullptr) {
+      pieces_.push_back({node, nullptr, 0, node->length});
+    }
+  }
+
+  void pushChunk(const Chunk* chunk, size_t chunkOffset) {
+    pieces_.push_back(
+        {nullptr, chunk, chunkOffset, chunk->text.size() - chunkOffset});
+  }
+
+  // The piece in front is the last one.
+  std::vector<Piece> pieces_;
+};
+
+/*
+ * Length of the longest common run of bytes (with equal attributes) of both
+ * subtrees, starting at `lhsOffset` and `rhsOffset` respectively, up to
+ * `maximum`. Subtrees and chunks shared by both sides aren't compared byte
+ * by byte, so comparing two versions of a rope only visits the nodes copied
+ * by the edits between them.
+ */
+size_t commonLength(
+    const NodePtr& lhsRoot,
+    size_t lhsOffset,
+    const NodePtr& rhsRoot,
+    size_t rhsOffset,
+    size_t maximum) {
+  if (maximum == 0) {
+    return 0;
+  }
+
+  auto lhs = ContentCursor{lhsRoot, lhsOffset};
+  auto rhs = ContentCursor{rhsRoot, rhsOffset};
+  auto length = size_t{0};
+  while (length < maximum) {
+    const auto& lhsPiece = lhs.front();
+    const auto& rhsPiece = rhs.front();
+
+    if (lhsPiece.node != nullptr || rhsPiece.node != nullptr) {
+      if (lhsPiece.node == rhsPiece.node &&
+          length + lhsPiece.length <= maximum) {
+        length += lhsPiece.length;
+        lhs.advance(lhsPiece.length);
+        rhs.advance(rhsPiece.length);
+      } else if (
+          lhsPiece.node != nullptr &&
+          (rhsPiece.node == nullptr || lhsPiece.length >= rhsPiece.length)) {
+        lhs.expand();
+      } else {
+        rhs.expand();
+      }
+      continue;
+    }
+
+    auto segmentLength =
+        std::min({maximum - length, lhsPiece.length, rhsPiece.length});
+    if (lhsPiece.chunk != rhsPiece.chunk ||
+        lhsPiece.chunkOffset != rhsPiece.chunkOffset) {
+      if (lhsPiece.chunk->textAttributes != rhsPiece.chunk->textAttributes) {
+        return length;
+      }
+      auto lhsText = std::string_view{lhsPiece.chunk->text}.substr(
+          lhsPiece.chunkOffset, segmentLength);
+      auto rhsText = std::string_view{rhsPiece.chunk->text}.substr(
+          rhsPiece.chunkOffset, segmentLength);
+      auto mismatch =
+          std::mismatch(lhsText.begin(), lhsText.end(), rhsText.begin());
+      if (mismatch.first != lhsText.end()) {
+        return length +
+            static_cast<size_t>(mismatch.first - lhsText.begin());
+      }
+    }
+
+    length += segmentLength;
+    lhs.advance(segmentLength);
+    rhs.advance(segmentLength);
+  }
+  return length;
+}
+
+} // namespace
+
+AttributedStringRope::AttributedStringRope(
+    const AttributedString& attributedString) {
+  for (const auto& fragment : attributedString.getFragments()) {
+    append(fragment.string, fragment.textAttributes);
+  }
+}
+
+void AttributedStringRope::insert(
+    size_t offset,
+    std::string_view text,
+    const InternedTextAttributes& textAttributes) {
+  if (text.empty()) {
+    return;
+  }
+
+  auto [left, right] = split(root_, std::min(offset, size()));
+  if (auto extendedLeft = appendToLastChunk(left, text, textAttributes)) {
+    left = std::move(extendedLeft);
+  } else {
+    left = merge(left, buildNodes(text, textAttributes));
+  }
+  root_ = merge(left, right);
+}
+
+void AttributedStringRope::erase(size_t offset, size_t length) {
+  offset = std::min(offset, size());
+  length = std::min(length, size() - offset);
+  if (length == 0) {
+    return;
+  }
+
+  auto [left, rest] = split(root_, offset);
+  auto [erased, right] = split(rest, length);
+  root_ = merge(left, right);
+}
+
+void AttributedStringRope::append(
+    std::string_view text,
+    const InternedTextAttributes& textAttributes) {
+  insert(size(), text, textAttributes);
+}
+
+size_t AttributedStringRope::size() const {
+  return lengthOf(root_);
+}
+
+bool AttributedStringRope::isEmpty() const {
+  return size() == 0;
+}
+
+std::string AttributedStringRope::getString() const {
+  auto chunks = std::vector<const Chunk*>{};
+  collectChunks(root_, chunks);
+
+  auto string = std::string{};
+  string.reserve(size());
+  for (auto chunk : chunks) {
+    string += chunk->text;
+  }
+  return string;
+}
+
+AttributedString AttributedStringRope::toAttributedString() const {
+  auto chunks = std::vector<const Chunk*>{};
+  collectChunks(root_, chunks);
+
+  auto attributedString = AttributedString{};
+  auto fragment = AttributedString::Fragment{};
+  for (auto chunk : chunks) {
+    if (!fragment.string.empty() &&
+        fragment.textAttributes != chunk->textAttributes) {
+      attributedString.appendFragment(std::move(fragment));
+      fragment = AttributedString::Fragment{};
+    }
+    fragment.string += chunk->text;
+    fragment.textAttributes = chunk->textAttributes;
+  }
+  attributedString.appendFragment(std::move(fragment));
+
+  return attributedString;
+}
+
+size_t AttributedStringRope::getHash() const {
+  return static_cast<size_t>(hashesOf(root_).hash);
+}
+
+size_t AttributedStringRope::getLayoutWiseHash() const {
+  return static_cast<size_t>(hashesOf(root_).layoutWiseHash);
+}
+
+AttributedStringRope::Change AttributedStringRope::diff(
+    const AttributedStringRope& oldRope,
+    const AttributedStringRope& newRope) {
+  auto oldSize = oldRope.size();
+  auto newSize = newRope.size();
+
+  if (oldRope.root_ == newRope.root_) {
+    return {};
+  }
+
+  // Equal hashes only make ropes candidates for being equal: polynomial
+  // hashes modulo 2^64 collide for some inputs (e.g. a Thue-Morse sequence
+  // and its complement). Every candidate is confirmed by comparing content.
+  auto minSize = std::min(oldSize, newSize);
+
+  if (oldSize == newSize && oldRope.getHash() == newRope.getHash() &&
+      commonLength(oldRope.root_, 0, newRope.root_, 0, oldSize) == oldSize) {
+    return {};
+  }
+
+  auto commonPrefixLength = findLongest(minSize, [&](size_t length) {
+    return prefixHashes(oldRope.root_, length).hash ==
+        prefixHashes(newRope.root_, length).hash;
+  });
+  // Stops at the first differing byte if the hashes collided.
+  commonPrefixLength =
+      commonLength(oldRope.root_, 0, newRope.root_, 0, commonPrefixLength);
+
+  auto isCommonSuffix = [&](size_t length) {
+    return commonLength(
+               oldRope.root_,
+               oldSize - length,
+               newRope.root_,
+               newSize - length,
+               length) == length;
+  };
+  auto commonSuffixLength =
+      findLongest(minSize - commonPrefixLength, [&](size_t length) {
+        return suffixHash(oldRope.root_, length) ==
+            suffixHash(newRope.root_, length);
+      });
+  if (!isCommonSuffix(commonSuffixLength)) {
+    // The hashes collided.
+    commonSuffixLength =
+        findLongest(minSize - commonPrefixLength, isCommonSuffix);
+  }
+
+  return {
+      commonPrefixLength,
+      oldSize - commonPrefixLength - commonSuffixLength,
+      newSize - commonPrefixLength - commonSuffixLength};
+}
+
+} // namespace facebook::react
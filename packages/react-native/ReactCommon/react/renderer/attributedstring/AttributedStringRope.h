@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/InternedTextAttributes.h>
+
+namespace facebook::react {
+
+struct AttributedStringRopeNode;
+
+/*
+ * Attributed string for large editable text (e.g. the content of a
+ * `TextInput`), backed by a persistent balanced tree of text chunks.
+ *
+ * - Inserting and erasing text take O(log n) (plus the size of a chunk),
+ *   regardless of the length of the whole string.
+ * - Copying is O(1); copies share all unchanged chunks.
+ * - Hashes are maintained incrementally and don't depend on how the string
+ *   was edited: ropes with the same text and attributes have the same hashes.
+ * - `diff` finds candidates for the changed range between two versions with
+ *   hashes in O(log^2 n), then confirms them by comparing content. Chunks
+ *   shared by both versions aren't compared byte by byte.
+ *
+ * Offsets and lengths are in bytes of the UTF-8 encoded text. Only text and
+ * attributes are stored; `parentShadowView` of the fragments produced by
+ * `toAttributedString` is empty.
+ */
+class AttributedStringRope final {
+ public:
+  /*
+   * Describes a replacement of `oldLength` bytes at `location` with
+   * `newLength` bytes.
+   */
+  struct Change {
+    size_t location{0};
+    size_t oldLength{0};
+    size_t newLength{0};
+
+    bool isEmpty() const {
+      return oldLength == 0 && newLength == 0;
+    }
+  };
+
+  static constexpr size_t kMaxChunkSize = 256;
+
+  AttributedStringRope() = default;
+  explicit AttributedStringRope(const AttributedString& attributedString);
+
+  /*
+   * Inserts `text` with given attributes at `offset`.
+   */
+  void insert(
+      size_t offset,
+      std::string_view text,
+      const InternedTextAttributes& textAttributes);
+
+  /*
+   * Erases `length` bytes starting at `offset`.
+   */
+  void erase(size_t offset, size_t length);
+
+  /*
+   * Appends `text` with given attributes to the end.
+   */
+  void append(
+      std::string_view text,
+      const InternedTextAttributes& textAttributes);
+
+  /*
+   * Length of the text in bytes.
+   */
+  size_t size() const;
+  bool isEmpty() const;
+
+  std::string getString() const;
+
+  /*
+   * Returns an `AttributedString` with adjacent chunks with the same
+   * attributes merged into one fragment.
+   */
+  AttributedString toAttributedString() const;
+
+  /*
+   * Hash of the text and all of its attributes.
+   */
+  size_t getHash() const;
+
+  /*
+   * Hash of the text and the attributes which affect layout (see
+   * `textAttributesHashLayoutWise`).
+   */
+  size_t getLayoutWiseHash() const;
+
+  /*
+   * Returns the smallest range of `oldRope` which has to be replaced to get
+   * `newRope`. The location is the length of the longest common prefix.
+   */
+  static Change diff(
+      const AttributedStringRope& oldRope,
+      const AttributedStringRope& newRope);
+
+ private:
+  std::shared_ptr<const AttributedStringRopeNode> root_{};
+};
+
+} // namespace facebook::react
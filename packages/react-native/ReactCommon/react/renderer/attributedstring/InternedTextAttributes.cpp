@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "InternedTextAttributes.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kShardCount = 16;
+constexpr size_t kMinSweepThreshold = 256;
+
+template <typename EntryT>
+struct InternTableShard {
+  // Keyed by `std::hash<TextAttributes>`; colliding entries share a key.
+  std::unordered_multimap<size_t, std::weak_ptr<EntryT>> entries;
+  // Expired entries are swept when the shard grows past this size.
+  size_t sweepThreshold{kMinSweepThreshold};
+  std::mutex mutex;
+
+  void sweep() {
+    for (auto iterator = entries.begin(); iterator != entries.end();) {
+      iterator = iterator->second.expired() ? entries.erase(iterator)
+                                            : std::next(iterator);
+    }
+    sweepThreshold = std::max(kMinSweepThreshold, entries.size() * 2);
+  }
+};
+
+template <typename EntryT>
+std::array<InternTableShard<EntryT>, kShardCount>& getInternTable() {
+  // Leaked intentionally: attributes may outlive static destructors.
+  static auto& table = *new std::array<InternTableShard<EntryT>, kShardCount>();
+  return table;
+}
+
+template <typename EntryT>
+InternTableShard<EntryT>& getInternTableShard(size_t hash) {
+  // Mixing the hash so that shards don't correlate with the buckets of the
+  // per-shard hash tables.
+  auto mixedHash = hash * static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+  return getInternTable<EntryT>()[(mixedHash >> 16) % kShardCount];
+}
+
+} // namespace
+
+InternedTextAttributes::InternedTextAttributes() {
+  static const auto defaultEntry = intern(TextAttributes{});
+  entry_ = defaultEntry;
+}
+
+InternedTextAttributes::InternedTextAttributes(
+    const TextAttributes& textAttributes)
+    : entry_(intern(textAttributes)) {}
+
+std::shared_ptr<const InternedTextAttributes::Entry>
+InternedTextAttributes::intern(const TextAttributes& textAttributes) {
+  auto hash = std::hash<TextAttributes>{}(textAttributes);
+  auto& shard = getInternTableShard<const Entry>(hash);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto [iterator, end] = shard.entries.equal_range(hash);
+  while (iterator != end) {
+    auto entry = iterator->second.lock();
+    if (!entry) {
+      iterator = shard.entries.erase(iterator);
+      continue;
+    }
+    if (entry->textAttributes == textAttributes) {
+      return entry;
+    }
+    iterator++;
+  }
+
+  auto entry = std::make_shared<const Entry>(Entry{
+      textAttributes, hash, textAttributesHashLayoutWise(textAttributes)});
+  shard.entries.emplace(hash, entry);
+
+  if (shard.entries.size() > shard.sweepThreshold) {
+    shard.sweep();
+  }
+
+  return entry;
+}
+
+size_t InternedTextAttributes::getInternedCount() {
+  auto count = size_t{0};
+  for (auto& shard : getInternTable<const Entry>()) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    count += std::count_if(
+        shard.entries.begin(), shard.entries.end(), [](const auto& pair) {
+          return !pair.second.expired();
+        });
+  }
+  return count;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <react/renderer/attributedstring/TextAttributes.h>
+
+namespace facebook::react {
+
+/*
+ * Immutable, hash-consed `TextAttributes`.
+ *
+ * All live `InternedTextAttributes` holding identical `TextAttributes` share
+ * the same instance, so copying is a reference count increment and comparing
+ * equal attributes is a pointer comparison. The regular and the layout-wise
+ * hashes are computed once, when the attributes are interned.
+ *
+ * Interning is keyed by the exact hash, while `TextAttributes::operator==`
+ * compares floats with an epsilon. Attributes which only differ within that
+ * epsilon get distinct instances, so comparisons fall back to
+ * `TextAttributes::operator==` when instances differ.
+ *
+ * Instances are kept in a process-wide table which only references them
+ * weakly; attributes are destroyed as soon as the last fragment holding them
+ * is.
+ */
+class InternedTextAttributes final {
+ public:
+  /*
+   * Holds default-constructed (i.e. nulled) `TextAttributes`.
+   */
+  InternedTextAttributes();
+
+  /*
+   * Interns `textAttributes`.
+   * Intentionally implicit, so that `TextAttributes` can be assigned to an
+   * `InternedTextAttributes` field.
+   * Can be called from any thread.
+   */
+  InternedTextAttributes(const TextAttributes& textAttributes);
+
+  const TextAttributes& operator*() const {
+    return entry_->textAttributes;
+  }
+
+  const TextAttributes* operator->() const {
+    return &entry_->textAttributes;
+  }
+
+  operator const TextAttributes&() const {
+    return entry_->textAttributes;
+  }
+
+  /*
+   * Equals `std::hash<TextAttributes>` of the held attributes.
+   */
+  size_t getHash() const {
+    return entry_->hash;
+  }
+
+  /*
+   * Equals `textAttributesHashLayoutWise` of the held attributes.
+   */
+  size_t getLayoutWiseHash() const {
+    return entry_->layoutWiseHash;
+  }
+
+  bool operator==(const InternedTextAttributes& rhs) const {
+    return entry_ == rhs.entry_ ||
+        entry_->textAttributes == rhs.entry_->textAttributes;
+  }
+
+  bool operator!=(const InternedTextAttributes& rhs) const {
+    return !(*this == rhs);
+  }
+
+  /*
+   * Number of distinct `TextAttributes` currently interned.
+   * Can be called from any thread.
+   */
+  static size_t getInternedCount();
+
+ private:
+  struct Entry {
+    TextAttributes textAttributes;
+    size_t hash;
+    size_t layoutWiseHash;
+  };
+
+  static std::shared_ptr<const Entry> intern(
+      const TextAttributes& textAttributes);
+
+  std::shared_ptr<const Entry> entry_;
+};
+
+/*
+ * Same as the overload taking `TextAttributes`, but bails out early when
+ * both hold the same instance.
+ * Layout-wise hashes can't be used to bail out: they differ for attributes
+ * which are only equivalent within the float comparison epsilon.
+ */
+inline bool areTextAttributesEquivalentLayoutWise(
+    const InternedTextAttributes& lhs,
+    const InternedTextAttributes& rhs) {
+  return &*lhs == &*rhs || areTextAttributesEquivalentLayoutWise(*lhs, *rhs);
+}
+
+} // namespace facebook::react
+
+namespace std {
+
+template <>
+struct hash<facebook::react::InternedTextAttributes> {
+  size_t operator()(
+      const facebook::react::InternedTextAttributes& textAttributes) const {
+    return textAttributes.getHash();
+  }
+};
+
+} // namespace std
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <react/renderer/attributedstring/AttributedStringRope.h>
+
+namespace facebook::react {
+
+namespace {
+
+InternedTextAttributes makeTextAttributes(Float fontSize) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = fontSize;
+  return textAttributes;
+}
+
+/*
+ * Prefix of the Thue-Morse sequence, spelled with `zero` and `one`.
+ * Polynomial hashes modulo 2^64 of a 2048 characters long prefix and its
+ * complement are equal for any odd base.
+ */
+std::string makeThueMorseString(char zero, char one) {
+  auto string = std::string(2048, zero);
+  for (size_t i = 0; i < string.size(); i++) {
+    if (__builtin_popcountll(i) % 2 == 1) {
+      string[i] = one;
+    }
+  }
+  return string;
+}
+
+} // namespace
+
+TEST(AttributedStringRopeTest, testInsertAndErase) {
+  auto regular = makeTextAttributes(14);
+  auto rope = AttributedStringRope{};
+
+  rope.append("Hello world", regular);
+  rope.insert(5, ",", regular);
+  rope.insert(rope.size(), "!", regular);
+  EXPECT_EQ(rope.getString(), "Hello, world!");
+
+  rope.erase(5, 7);
+  EXPECT_EQ(rope.getString(), "Hello!");
+  EXPECT_EQ(rope.size(), 6);
+
+  // Out of range edits are clamped.
+  rope.erase(3, 100);
+  rope.insert(100, "p", regular);
+  EXPECT_EQ(rope.getString(), "Help");
+}
+
+TEST(AttributedStringRopeTest, testLargeText) {
+  auto regular = makeTextAttributes(14);
+  auto expected = std::string{};
+  auto rope = AttributedStringRope{};
+
+  for (int i = 0; i < 2000; i++) {
+    auto text = std::to_string(i) + " ";
+    auto offset = static_cast<size_t>(i * 7919) % (expected.size() + 1);
+    expected.insert(offset, text);
+    rope.insert(offset, text, regular);
+  }
+  EXPECT_EQ(rope.getString(), expected);
+
+  for (int i = 0; i < 500; i++) {
+    auto offset = static_cast<size_t>(i * 104729) % expected.size();
+    expected.erase(offset, 3);
+    rope.erase(offset, 3);
+  }
+  EXPECT_EQ(rope.getString(), expected);
+}
+
+TEST(AttributedStringRopeTest, testCopiesAreIndependent) {
+  auto regular = makeTextAttributes(14);
+  auto rope = AttributedStringRope{};
+  rope.append("abc", regular);
+
+  auto copy = rope;
+  copy.insert(1, "X", regular);
+
+  EXPECT_EQ(rope.getString(), "abc");
+  EXPECT_EQ(copy.getString(), "aXbc");
+}
+
+TEST(AttributedStringRopeTest, testToAttributedStringMergesFragments) {
+  auto regular = makeTextAttributes(14);
+  auto large = makeTextAttributes(20);
+  auto rope = AttributedStringRope{};
+  rope.append("Hello", regular);
+  rope.append(" big", large);
+  rope.insert(3, "l", regular);
+  rope.append(" world", large);
+
+  auto attributedString = rope.toAttributedString();
+  const auto& fragments = attributedString.getFragments();
+  ASSERT_EQ(fragments.size(), 2);
+  EXPECT_EQ(fragments[0].string, "Helllo");
+  EXPECT_EQ(fragments[0].textAttributes, regular);
+  EXPECT_EQ(fragments[1].string, " big world");
+  EXPECT_EQ(fragments[1].textAttributes, large);
+
+  EXPECT_EQ(
+      AttributedStringRope{attributedString}.getHash(), rope.getHash());
+}
+
+TEST(AttributedStringRopeTest, testHashesDontDependOnEditHistory) {
+  auto regular = makeTextAttributes(14);
+  auto large = makeTextAttributes(20);
+
+  auto typed = AttributedStringRope{};
+  for (auto character : std::string{"typed one by one"}) {
+    typed.append(std::string{character}, regular);
+  }
+
+  auto pasted = AttributedStringRope{};
+  pasted.append("one by one", regular);
+  pasted.insert(0, "typed ", regular);
+
+  EXPECT_EQ(typed.getHash(), pasted.getHash());
+  EXPECT_EQ(typed.getLayoutWiseHash(), pasted.getLayoutWiseHash());
+
+  auto restyled = AttributedStringRope{};
+  restyled.append("typed one by one", large);
+  EXPECT_NE(restyled.getHash(), typed.getHash());
+  EXPECT_NE(restyled.getLayoutWiseHash(), typed.getLayoutWiseHash());
+
+  // Colors don't affect layout.
+  auto coloredAttributes = TextAttributes{};
+  coloredAttributes.fontSize = 14;
+  coloredAttributes.foregroundColor = colorFromRGBA(255, 0, 0, 255);
+  auto colored = AttributedStringRope{};
+  colored.append("typed one by one", coloredAttributes);
+  EXPECT_NE(colored.getHash(), typed.getHash());
+  EXPECT_EQ(colored.getLayoutWiseHash(), typed.getLayoutWiseHash());
+}
+
+TEST(AttributedStringRopeTest, testDiff) {
+  auto regular = makeTextAttributes(14);
+  auto large = makeTextAttributes(20);
+  auto oldRope = AttributedStringRope{};
+  oldRope.append(
+      std::string(1000, 'a') + "hello" + std::string(1000, 'b'), regular);
+
+  auto unchanged = AttributedStringRope::diff(oldRope, oldRope);
+  EXPECT_TRUE(unchanged.isEmpty());
+
+  auto inserted = oldRope;
+  inserted.insert(1002, "XY", regular);
+  auto change = AttributedStringRope::diff(oldRope, inserted);
+  EXPECT_EQ(change.location, 1002);
+  EXPECT_EQ(change.oldLength, 0);
+  EXPECT_EQ(change.newLength, 2);
+
+  auto erased = oldRope;
+  erased.erase(1001, 3);
+  change = AttributedStringRope::diff(oldRope, erased);
+  EXPECT_EQ(change.location, 1001);
+  EXPECT_EQ(change.oldLength, 3);
+  EXPECT_EQ(change.newLength, 0);
+
+  auto restyled = oldRope;
+  restyled.erase(1000, 5);
+  restyled.insert(1000, "hello", large);
+  change = AttributedStringRope::diff(oldRope, restyled);
+  EXPECT_EQ(change.location, 1000);
+  EXPECT_EQ(change.oldLength, 5);
+  EXPECT_EQ(change.newLength, 5);
+}
+
+TEST(AttributedStringRopeTest, testDiffConfirmsHashesByContent) {
+  auto regular = makeTextAttributes(14);
+  auto oldRope = AttributedStringRope{};
+  oldRope.append(
+      "prefix " + makeThueMorseString('a', 'b') + " suffix", regular);
+  auto newRope = AttributedStringRope{};
+  newRope.append(
+      "prefix " + makeThueMorseString('b', 'a') + " suffix", regular);
+
+  // The hashes collide, the content doesn't.
+  EXPECT_EQ(oldRope.getHash(), newRope.getHash());
+
+  auto change = AttributedStringRope::diff(oldRope, newRope);
+  EXPECT_EQ(change.location, 7);
+  EXPECT_EQ(change.oldLength, 2048);
+  EXPECT_EQ(change.newLength, 2048);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/attributedstring/InternedTextAttributes.h>
+
+namespace facebook::react {
+
+TEST(InternedTextAttributesTest, testEqualAttributesShareInstance) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 14;
+  textAttributes.fontFamily = "Helvetica";
+
+  auto first = InternedTextAttributes{textAttributes};
+  auto second = InternedTextAttributes{textAttributes};
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(&*first, &*second);
+  EXPECT_EQ(first->fontSize, 14);
+  EXPECT_EQ(first.getHash(), std::hash<TextAttributes>{}(textAttributes));
+  EXPECT_EQ(
+      first.getLayoutWiseHash(), textAttributesHashLayoutWise(textAttributes));
+}
+
+TEST(InternedTextAttributesTest, testDifferentAttributesDontShareInstance) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 14;
+  auto first = InternedTextAttributes{textAttributes};
+
+  textAttributes.opacity = 0.5;
+  auto second = InternedTextAttributes{textAttributes};
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(second->opacity, 0.5);
+  // Opacity doesn't affect layout.
+  EXPECT_EQ(first.getLayoutWiseHash(), second.getLayoutWiseHash());
+  EXPECT_TRUE(areTextAttributesEquivalentLayoutWise(first, second));
+}
+
+TEST(InternedTextAttributesTest, testNearlyEqualAttributesAreEqual) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 14;
+  auto first = InternedTextAttributes{textAttributes};
+
+  // Within the epsilon of `floatEquality`, but hashed differently.
+  textAttributes.fontSize = 14.001;
+  auto second = InternedTextAttributes{textAttributes};
+
+  EXPECT_NE(&*first, &*second);
+  EXPECT_EQ(*first, *second);
+  EXPECT_EQ(first, second);
+  EXPECT_TRUE(areTextAttributesEquivalentLayoutWise(first, second));
+}
+
+TEST(InternedTextAttributesTest, testDefaultConstructor) {
+  EXPECT_EQ(InternedTextAttributes{}, InternedTextAttributes{TextAttributes{}});
+  EXPECT_EQ(*InternedTextAttributes{}, TextAttributes{});
+}
+
+TEST(InternedTextAttributesTest, testReleasesUnusedAttributes) {
+  auto initialCount = InternedTextAttributes::getInternedCount();
+  {
+    auto textAttributes = TextAttributes{};
+    textAttributes.fontFamily = "testReleasesUnusedAttributes";
+    auto interned = InternedTextAttributes{textAttributes};
+    auto copy = interned;
+    EXPECT_EQ(InternedTextAttributes::getInternedCount(), initialCount + 1);
+  }
+  EXPECT_EQ(InternedTextAttributes::getInternedCount(), initialCount);
+}
+
+} // namespace facebook::react
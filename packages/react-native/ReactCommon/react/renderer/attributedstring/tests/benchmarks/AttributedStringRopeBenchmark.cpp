@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/attributedstring/AttributedStringRope.h>
+#include <functional>
+#include <string>
+
+namespace facebook::react {
+
+// A ~100 KB document (e.g. a long note) made of paragraphs with some bold
+// words.
+constexpr auto kParagraphCount = 500;
+
+TextAttributes makeTextAttributes(bool bold) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 15;
+  if (bold) {
+    textAttributes.fontWeight = FontWeight::Bold;
+  }
+  return textAttributes;
+}
+
+AttributedString makeDocument() {
+  auto regular = InternedTextAttributes{makeTextAttributes(false)};
+  auto bold = InternedTextAttributes{makeTextAttributes(true)};
+
+  auto document = AttributedString{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    document.appendFragment(
+        {"Paragraph " + std::to_string(i) +
+             " of a long document that is being edited. Every keystroke "
+             "updates the text input state, ",
+         regular});
+    document.appendFragment({"some words are bold", bold});
+    document.appendFragment(
+        {", and the rest of the paragraph is regular text that wraps over "
+         "a few lines on a phone-sized screen.\n",
+         regular});
+  }
+  return document;
+}
+
+auto document = makeDocument();
+
+/*
+ * Every iteration types one character in the middle of the document,
+ * produces the new state value and hashes it.
+ */
+static void typeInAttributedString(benchmark::State& state) {
+  auto current = document;
+  auto& fragments = current.getFragments();
+  auto& fragment = fragments[fragments.size() / 2];
+  auto offset = fragment.string.size() / 2;
+
+  for (auto _ : state) {
+    fragment.string.insert(offset++, 1, 'a');
+    auto next = current;
+    benchmark::DoNotOptimize(std::hash<AttributedString>{}(next));
+  }
+  state.counters["documentSize"] =
+      static_cast<double>(current.getString().size());
+}
+BENCHMARK(typeInAttributedString);
+
+static void typeInAttributedStringRope(benchmark::State& state) {
+  auto current = AttributedStringRope{document};
+  auto textAttributes = InternedTextAttributes{makeTextAttributes(false)};
+  auto offset = current.size() / 2;
+
+  for (auto _ : state) {
+    auto next = current;
+    next.insert(offset++, "a", textAttributes);
+    benchmark::DoNotOptimize(next.getLayoutWiseHash());
+    benchmark::DoNotOptimize(AttributedStringRope::diff(current, next));
+    current = std::move(next);
+  }
+  state.counters["documentSize"] = static_cast<double>(current.size());
+}
+BENCHMARK(typeInAttributedStringRope);
+
+static void buildAttributedStringRope(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(AttributedStringRope{document});
+  }
+}
+BENCHMARK(buildAttributedStringRope);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
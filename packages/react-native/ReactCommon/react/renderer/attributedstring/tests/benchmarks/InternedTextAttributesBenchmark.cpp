@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/attributedstring/InternedTextAttributes.h>
+#include <vector>
+
+namespace facebook::react {
+
+// A rich-text screen: paragraphs mixing a handful of styles (body, bold,
+// links, inline code).
+constexpr auto kParagraphCount = 100;
+constexpr auto kFragmentsPerParagraph = 12;
+
+std::vector<TextAttributes> makeStyles() {
+  auto body = TextAttributes{};
+  body.fontFamily = "System";
+  body.fontSize = 15;
+  body.lineHeight = 22;
+  body.foregroundColor = colorFromRGBA(33, 33, 33, 255);
+
+  auto bold = body;
+  bold.fontWeight = FontWeight::Bold;
+
+  auto link = body;
+  link.foregroundColor = colorFromRGBA(0, 100, 220, 255);
+  link.textDecorationLineType = TextDecorationLineType::Underline;
+  link.isPressable = true;
+  link.accessibilityRole = AccessibilityRole::Link;
+
+  auto code = body;
+  code.fontFamily = "Menlo";
+  code.fontSize = 13;
+  code.backgroundColor = colorFromRGBA(240, 240, 240, 255);
+
+  return {body, bold, body, link, body, code};
+}
+
+auto styles = makeStyles();
+
+std::vector<std::vector<TextAttributes>> makeParagraphsByValue() {
+  auto paragraphs = std::vector<std::vector<TextAttributes>>{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    auto& paragraph = paragraphs.emplace_back();
+    for (int j = 0; j < kFragmentsPerParagraph; j++) {
+      paragraph.push_back(styles[(i + j) % styles.size()]);
+    }
+  }
+  return paragraphs;
+}
+
+std::vector<std::vector<InternedTextAttributes>> makeInternedParagraphs() {
+  auto paragraphs = std::vector<std::vector<InternedTextAttributes>>{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    auto& paragraph = paragraphs.emplace_back();
+    for (int j = 0; j < kFragmentsPerParagraph; j++) {
+      paragraph.emplace_back(styles[(i + j) % styles.size()]);
+    }
+  }
+  return paragraphs;
+}
+
+auto paragraphsByValue = makeParagraphsByValue();
+auto internedParagraphs = makeInternedParagraphs();
+
+/*
+ * Bytes held by the text attributes of one paragraph. Heap allocations of
+ * `TextAttributes` members (e.g. long font family names) are not counted.
+ */
+void reportMemoryPerParagraph(benchmark::State& state, size_t bytes) {
+  state.counters["bytesPerParagraph"] =
+      static_cast<double>(bytes) / kParagraphCount;
+}
+
+static void buildParagraphsByValue(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(makeParagraphsByValue());
+  }
+  reportMemoryPerParagraph(
+      state, kParagraphCount * kFragmentsPerParagraph * sizeof(TextAttributes));
+}
+BENCHMARK(buildParagraphsByValue);
+
+static void buildInternedParagraphs(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(makeInternedParagraphs());
+  }
+  // Distinct attributes are shared by all paragraphs; the interned entry
+  // also holds two hashes and the reference counts.
+  reportMemoryPerParagraph(
+      state,
+      kParagraphCount * kFragmentsPerParagraph *
+              sizeof(InternedTextAttributes) +
+          InternedTextAttributes::getInternedCount() *
+              (sizeof(TextAttributes) + 4 * sizeof(size_t)));
+}
+BENCHMARK(buildInternedParagraphs);
+
+static void copyParagraphsByValue(benchmark::State& state) {
+  for (auto _ : state) {
+    auto copy = paragraphsByValue;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(copyParagraphsByValue);
+
+static void copyInternedParagraphs(benchmark::State& state) {
+  for (auto _ : state) {
+    auto copy = internedParagraphs;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(copyInternedParagraphs);
+
+static void hashParagraphsLayoutWiseByValue(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const auto& paragraph : paragraphsByValue) {
+      auto seed = size_t{0};
+      for (const auto& textAttributes : paragraph) {
+        hash_combine(seed, textAttributesHashLayoutWise(textAttributes));
+      }
+      benchmark::DoNotOptimize(seed);
+    }
+  }
+}
+BENCHMARK(hashParagraphsLayoutWiseByValue);
+
+static void hashInternedParagraphsLayoutWise(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const auto& paragraph : internedParagraphs) {
+      auto seed = size_t{0};
+      for (const auto& textAttributes : paragraph) {
+        hash_combine(seed, textAttributes.getLayoutWiseHash());
+      }
+      benchmark::DoNotOptimize(seed);
+    }
+  }
+}
+BENCHMARK(hashInternedParagraphsLayoutWise);
+
+static void compareParagraphsByValue(benchmark::State& state) {
+  auto copy = paragraphsByValue;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(copy == paragraphsByValue);
+  }
+}
+BENCHMARK(compareParagraphsByValue);
+
+static void compareInternedParagraphs(benchmark::State& state) {
+  auto copy = makeInternedParagraphs();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(copy == internedParagraphs);
+  }
+}
+BENCHMARK(compareInternedParagraphs);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -65,7 +65,8 @@ void ImageShadowNode::updateStateIfNeeded() {
           getTag()
 #endif
               ),
-      newImageRequestParams};
+      newImageRequestParams,
+      imageManager_->getImageMetadata(newImageSource)};
   setStateData(std::move(state));
 }
 
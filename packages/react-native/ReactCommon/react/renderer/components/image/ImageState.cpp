@@ -20,4 +20,8 @@ const ImageRequestParams& ImageState::getImageRequestParams() const {
   return imageRequestParams_;
 }
 
+const std::optional<ImageMetadata>& ImageState::getImageMetadata() const {
+  return imageMetadata_;
+}
+
 } // namespace facebook::react
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <react/renderer/imagemanager/ImageRequest.h>
 #include <react/renderer/imagemanager/ImageRequestParams.h>
 #include <react/renderer/imagemanager/primitives.h>
@@ -27,10 +29,12 @@ class ImageState final {
   ImageState(
       const ImageSource& imageSource,
       ImageRequest imageRequest,
-      const ImageRequestParams& imageRequestParams)
+      const ImageRequestParams& imageRequestParams,
+      std::optional<ImageMetadata> imageMetadata = std::nullopt)
       : imageSource_(imageSource),
         imageRequest_(std::make_shared<ImageRequest>(std::move(imageRequest))),
-        imageRequestParams_(imageRequestParams) {}
+        imageRequestParams_(imageRequestParams),
+        imageMetadata_(std::move(imageMetadata)) {}
 
   /*
    * Returns stored ImageSource object.
@@ -47,6 +51,12 @@ class ImageState final {
    * Returns stored ImageRequestParams object.
    */
   const ImageRequestParams& getImageRequestParams() const;
+
+  /*
+   * Returns metadata of the image if it was already known when the request
+   * was made (e.g. the same image was loaded before).
+   */
+  const std::optional<ImageMetadata>& getImageMetadata() const;
 #ifdef ANDROID
   ImageState(const ImageState& previousState, folly::dynamic data)
       : imageRequestParams_{} {};
@@ -63,6 +73,7 @@ class ImageState final {
   ImageSource imageSource_;
   std::shared_ptr<ImageRequest> imageRequest_;
   ImageRequestParams imageRequestParams_;
+  std::optional<ImageMetadata> imageMetadata_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageVisibilityMountHook.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <react/renderer/components/image/ImageShadowNode.h>
+#include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
+
+namespace facebook::react {
+
+namespace {
+
+using ImagePriorities = std::unordered_map<
+    const ImageResponseObserverCoordinator*,
+    ImageRequestPriority>;
+
+bool overlaps(const Rect& lhs, const Rect& rhs) {
+  return lhs.getMinX() < rhs.getMaxX() && rhs.getMinX() < lhs.getMaxX() &&
+      lhs.getMinY() < rhs.getMaxY() && rhs.getMinY() < lhs.getMaxY();
+}
+
+ImageRequestPriority getPriority(const Rect& frame, const Rect& viewport) {
+  if (overlaps(frame, viewport)) {
+    return ImageRequestPriority::Visible;
+  }
+
+  auto extendedViewport = Rect{
+      {viewport.origin.x - viewport.size.width,
+       viewport.origin.y - viewport.size.height},
+      {viewport.size.width * 3, viewport.size.height * 3}};
+  if (overlaps(frame, extendedViewport)) {
+    return ImageRequestPriority::NearViewport;
+  }
+
+  return ImageRequestPriority::Offscreen;
+}
+
+/*
+ * `contentOrigin` is the origin of the content of `shadowNode`, and
+ * `viewport` is the visible area; both in the coordinates of the root.
+ */
+void collectImagePriorities(
+    const ShadowNode& shadowNode,
+    Point contentOrigin,
+    const Rect& viewport,
+    ImagePriorities& imagePriorities) {
+  for (const auto& childNode : shadowNode.getChildren()) {
+    auto layoutableChildNode =
+        dynamic_cast<const LayoutableShadowNode*>(childNode.get());
+    if (layoutableChildNode == nullptr) {
+      continue;
+    }
+
+    auto layoutMetrics = layoutableChildNode->getLayoutMetrics();
+    if (layoutMetrics.displayType == DisplayType::None) {
+      continue;
+    }
+
+    auto frame = layoutMetrics.frame;
+    frame.origin += contentOrigin;
+
+    if (auto imageShadowNode =
+            dynamic_cast<const ImageShadowNode*>(childNode.get())) {
+      const auto& coordinator = imageShadowNode->getStateData()
+                                    .getImageRequest()
+                                    .getSharedObserverCoordinator();
+      if (coordinator) {
+        auto priority = getPriority(frame, viewport);
+        auto [iterator, inserted] =
+            imagePriorities.emplace(coordinator.get(), priority);
+        if (!inserted) {
+          iterator->second = std::min(iterator->second, priority);
+        }
+      }
+      continue;
+    }
+
+    auto childViewport = viewport;
+    if (dynamic_cast<const ScrollViewShadowNode*>(childNode.get())) {
+      childViewport = Rect::intersect(viewport, frame);
+    }
+
+    collectImagePriorities(
+        *childNode,
+        frame.origin +
+            layoutableChildNode->getContentOriginOffset(
+                /* includeTransform */ false),
+        childViewport,
+        imagePriorities);
+  }
+}
+
+} // namespace
+
+void ImageVisibilityMountHook::shadowTreeDidMount(
+    const RootShadowNode::Shared& rootShadowNode,
+    double /*mountTime*/) noexcept {
+  auto viewport = rootShadowNode->getLayoutMetrics().frame;
+
+  auto imagePriorities = ImagePriorities{};
+  collectImagePriorities(
+      *rootShadowNode, viewport.origin, viewport, imagePriorities);
+
+  for (const auto& [coordinator, priority] : imagePriorities) {
+    coordinator->setPriority(priority);
+  }
+}
+
+} // namespace facebook::react
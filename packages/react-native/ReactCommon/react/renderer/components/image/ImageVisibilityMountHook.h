@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/uimanager/UIManagerMountHook.h>
+
+namespace facebook::react {
+
+/*
+ * Delivers visibility hints for image requests after every mount: each
+ * image of the mounted tree is classified by its distance from the viewport
+ * (`ImageRequestPriority`) and the priority is passed to its request
+ * through `ImageResponseObserverCoordinator::setPriority`.
+ *
+ * The viewport of an image is the frame of the surface, intersected with
+ * the frames of all enclosing scroll views; content of scroll views is
+ * offset by `ScrollViewState::contentOffset`. An image within one viewport
+ * size from its viewport is `NearViewport`. Transforms are ignored.
+ *
+ * An image shown by several nodes gets the highest priority of them.
+ *
+ * To enable it, register it with `UIManager::registerMountHook`.
+ */
+class ImageVisibilityMountHook final : public UIManagerMountHook {
+ public:
+#pragma mark - UIManagerMountHook
+
+  void shadowTreeDidMount(
+      const RootShadowNode::Shared& rootShadowNode,
+      double mountTime) noexcept override;
+};
+
+} // namespace facebook::react
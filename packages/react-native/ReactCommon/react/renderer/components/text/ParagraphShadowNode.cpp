@@ -31,6 +31,8 @@ ParagraphShadowNode::ParagraphShadowNode(
     : ConcreteViewShadowNode(sourceShadowNode, fragment) {
   auto& sourceParagraphShadowNode =
       static_cast<const ParagraphShadowNode&>(sourceShadowNode);
+  measuredLayoutConstraints_ =
+      sourceParagraphShadowNode.measuredLayoutConstraints_;
   if (!fragment.children && !fragment.props &&
       sourceParagraphShadowNode.getIsLayoutClean()) {
     // This ParagraphShadowNode was cloned but did not change
@@ -40,6 +42,22 @@ ParagraphShadowNode::ParagraphShadowNode(
   }
 }
 
+Content ParagraphShadowNode::buildContent(
+    const LayoutContext& layoutContext,
+    LayoutDirection layoutDirection) const {
+  auto textAttributes = TextAttributes::defaultTextAttributes();
+  textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
+  textAttributes.apply(getConcreteProps().textAttributes);
+  textAttributes.layoutDirection = layoutDirection;
+  auto attributedString = AttributedString{};
+  auto attachments = Attachments{};
+  buildAttributedString(textAttributes, *this, attributedString, attachments);
+  attributedString.setBaseTextAttributes(textAttributes);
+
+  return Content{
+      attributedString, getConcreteProps().paragraphAttributes, attachments};
+}
+
 const Content& ParagraphShadowNode::getContent(
     const LayoutContext& layoutContext) const {
   if (content_.has_value()) {
@@ -48,20 +66,17 @@ const Content& ParagraphShadowNode::getContent(
 
   ensureUnsealed();
 
-  auto textAttributes = TextAttributes::defaultTextAttributes();
-  textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
-  textAttributes.apply(getConcreteProps().textAttributes);
-  textAttributes.layoutDirection =
-      YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
+  auto layoutDirection = YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
       ? LayoutDirection::RightToLeft
       : LayoutDirection::LeftToRight;
-  auto attributedString = AttributedString{};
-  auto attachments = Attachments{};
-  buildAttributedString(textAttributes, *this, attributedString, attachments);
-  attributedString.setBaseTextAttributes(textAttributes);
-
-  content_ = Content{
-      attributedString, getConcreteProps().paragraphAttributes, attachments};
+  if (preMeasuredContent_.has_value() &&
+      preMeasuredContent_->attributedString.getBaseTextAttributes()
+              .layoutDirection == layoutDirection) {
+    content_ = std::move(preMeasuredContent_);
+  } else {
+    content_ = buildContent(layoutContext, layoutDirection);
+  }
+  preMeasuredContent_.reset();
 
   return content_.value();
 }
@@ -152,6 +167,8 @@ Size ParagraphShadowNode::measureContent(
     attributedString.appendFragment({string, textAttributes, {}});
   }
 
+  measuredLayoutConstraints_ = layoutConstraints;
+
   TextLayoutContext textLayoutContext{};
   textLayoutContext.pointScaleFactor = layoutContext.pointScaleFactor;
   return textLayoutManager_
@@ -163,6 +180,43 @@ Size ParagraphShadowNode::measureContent(
       .size;
 }
 
+std::optional<TextPreMeasurer::Request>
+ParagraphShadowNode::getPreMeasurementRequest(
+    const LayoutContext& layoutContext,
+    const LayoutConstraints& defaultLayoutConstraints) const {
+  // The layout direction is only resolved during layout. Until then, a node
+  // that hasn't been laid out yet is assumed to inherit it from the root.
+  auto layoutDirection =
+      defaultLayoutConstraints.layoutDirection == LayoutDirection::RightToLeft
+      ? LayoutDirection::RightToLeft
+      : LayoutDirection::LeftToRight;
+  if (measuredLayoutConstraints_.has_value()) {
+    layoutDirection = YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
+        ? LayoutDirection::RightToLeft
+        : LayoutDirection::LeftToRight;
+  }
+
+  // Layout runs right after the commit hooks and reuses this content unless
+  // the guess about the layout direction was wrong.
+  ensureUnsealed();
+  preMeasuredContent_ = buildContent(layoutContext, layoutDirection);
+  const auto& content = preMeasuredContent_.value();
+
+  if (!content.attachments.empty() || content.attributedString.isEmpty()) {
+    // Attachments have to be laid out first, and empty paragraphs are
+    // measured with a placeholder which is cheap to measure anyway.
+    return std::nullopt;
+  }
+
+  TextLayoutContext textLayoutContext{};
+  textLayoutContext.pointScaleFactor = layoutContext.pointScaleFactor;
+  return TextPreMeasurer::Request{
+      content.attributedString,
+      content.paragraphAttributes,
+      textLayoutContext,
+      measuredLayoutConstraints_.value_or(defaultLayoutConstraints)};
+}
+
 Float ParagraphShadowNode::baseline(
     const LayoutContext& layoutContext,
     Size size) const {
@@ -15,6 +15,7 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/renderer/textlayoutmanager/TextPreMeasurer.h>
 
 namespace facebook::react {
 
@@ -72,6 +73,19 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
 
   Float baseline(const LayoutContext& layoutContext, Size size) const override;
 
+  /*
+   * Returns a request to measure the text content of the node ahead of layout.
+   * The node is expected to be measured with the same constraints as during
+   * its previous layout, or with `defaultLayoutConstraints` if it hasn't been
+   * laid out yet. Returns an empty optional if the content can't be measured
+   * before layout (e.g. it has attachments).
+   * The content built for the request is kept for layout, so this must only
+   * be called on unsealed nodes.
+   */
+  std::optional<TextPreMeasurer::Request> getPreMeasurementRequest(
+      const LayoutContext& layoutContext,
+      const LayoutConstraints& defaultLayoutConstraints) const;
+
   /*
    * Internal representation of the nested content of the node in a format
    * suitable for future processing.
@@ -84,6 +98,13 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
   };
 
  private:
+  /*
+   * Builds and returns a `Content` object.
+   */
+  Content buildContent(
+      const LayoutContext& layoutContext,
+      LayoutDirection layoutDirection) const;
+
   /*
    * Builds (if needed) and returns a reference to a `Content` object.
    */
@@ -108,6 +129,17 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
    * Cached content of the subtree started from the node.
    */
   mutable std::optional<Content> content_{};
+
+  /*
+   * Content built by `getPreMeasurementRequest`, adopted by `getContent` if
+   * it was built for the right layout direction.
+   */
+  mutable std::optional<Content> preMeasuredContent_{};
+
+  /*
+   * Constraints of the last measurement, preserved across clones.
+   */
+  mutable std::optional<LayoutConstraints> measuredLayoutConstraints_{};
 };
 
 } // namespace facebook::react
@@ -7,22 +7,55 @@
 
 #include "Touch.h"
 
+#include <react/utils/PropNameIDCache.h>
+
 namespace facebook::react {
 
+namespace {
+
+struct TouchPropNames {
+  explicit TouchPropNames(jsi::Runtime& runtime)
+      : locationX(jsi::PropNameID::forAscii(runtime, "locationX")),
+        locationY(jsi::PropNameID::forAscii(runtime, "locationY")),
+        pageX(jsi::PropNameID::forAscii(runtime, "pageX")),
+        pageY(jsi::PropNameID::forAscii(runtime, "pageY")),
+        screenX(jsi::PropNameID::forAscii(runtime, "screenX")),
+        screenY(jsi::PropNameID::forAscii(runtime, "screenY")),
+        identifier(jsi::PropNameID::forAscii(runtime, "identifier")),
+        target(jsi::PropNameID::forAscii(runtime, "target")),
+        timestamp(jsi::PropNameID::forAscii(runtime, "timestamp")),
+        force(jsi::PropNameID::forAscii(runtime, "force")) {}
+
+  jsi::PropNameID locationX;
+  jsi::PropNameID locationY;
+  jsi::PropNameID pageX;
+  jsi::PropNameID pageY;
+  jsi::PropNameID screenX;
+  jsi::PropNameID screenY;
+  jsi::PropNameID identifier;
+  jsi::PropNameID target;
+  jsi::PropNameID timestamp;
+  jsi::PropNameID force;
+};
+
+} // namespace
+
 void setTouchPayloadOnObject(
     jsi::Object& object,
     jsi::Runtime& runtime,
     const BaseTouch& touch) {
-  object.setProperty(runtime, "locationX", touch.offsetPoint.x);
-  object.setProperty(runtime, "locationY", touch.offsetPoint.y);
-  object.setProperty(runtime, "pageX", touch.pagePoint.x);
-  object.setProperty(runtime, "pageY", touch.pagePoint.y);
-  object.setProperty(runtime, "screenX", touch.screenPoint.x);
-  object.setProperty(runtime, "screenY", touch.screenPoint.y);
-  object.setProperty(runtime, "identifier", touch.identifier);
-  object.setProperty(runtime, "target", touch.target);
-  object.setProperty(runtime, "timestamp", touch.timestamp * 1000);
-  object.setProperty(runtime, "force", touch.force);
+  const auto& names = PropNameIDCache::get<TouchPropNames>(runtime);
+
+  object.setProperty(runtime, names.locationX, touch.offsetPoint.x);
+  object.setProperty(runtime, names.locationY, touch.offsetPoint.y);
+  object.setProperty(runtime, names.pageX, touch.pagePoint.x);
+  object.setProperty(runtime, names.pageY, touch.pagePoint.y);
+  object.setProperty(runtime, names.screenX, touch.screenPoint.x);
+  object.setProperty(runtime, names.screenY, touch.screenPoint.y);
+  object.setProperty(runtime, names.identifier, touch.identifier);
+  object.setProperty(runtime, names.target, touch.target);
+  object.setProperty(runtime, names.timestamp, touch.timestamp * 1000);
+  object.setProperty(runtime, names.force, touch.force);
 }
 
 #if RN_DEBUG_STRING_CONVERTIBLE
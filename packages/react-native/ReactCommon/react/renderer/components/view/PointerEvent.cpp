@@ -7,40 +7,109 @@
 
 #include "PointerEvent.h"
 
+#include <react/utils/PropNameIDCache.h>
+
 namespace facebook::react {
 
+namespace {
+
+struct PointerEventPropNames {
+  explicit PointerEventPropNames(jsi::Runtime& runtime)
+      : pointerId(jsi::PropNameID::forAscii(runtime, "pointerId")),
+        pressure(jsi::PropNameID::forAscii(runtime, "pressure")),
+        pointerType(jsi::PropNameID::forAscii(runtime, "pointerType")),
+        clientX(jsi::PropNameID::forAscii(runtime, "clientX")),
+        clientY(jsi::PropNameID::forAscii(runtime, "clientY")),
+        x(jsi::PropNameID::forAscii(runtime, "x")),
+        y(jsi::PropNameID::forAscii(runtime, "y")),
+        pageX(jsi::PropNameID::forAscii(runtime, "pageX")),
+        pageY(jsi::PropNameID::forAscii(runtime, "pageY")),
+        screenX(jsi::PropNameID::forAscii(runtime, "screenX")),
+        screenY(jsi::PropNameID::forAscii(runtime, "screenY")),
+        offsetX(jsi::PropNameID::forAscii(runtime, "offsetX")),
+        offsetY(jsi::PropNameID::forAscii(runtime, "offsetY")),
+        width(jsi::PropNameID::forAscii(runtime, "width")),
+        height(jsi::PropNameID::forAscii(runtime, "height")),
+        tiltX(jsi::PropNameID::forAscii(runtime, "tiltX")),
+        tiltY(jsi::PropNameID::forAscii(runtime, "tiltY")),
+        detail(jsi::PropNameID::forAscii(runtime, "detail")),
+        buttons(jsi::PropNameID::forAscii(runtime, "buttons")),
+        tangentialPressure(
+            jsi::PropNameID::forAscii(runtime, "tangentialPressure")),
+        twist(jsi::PropNameID::forAscii(runtime, "twist")),
+        ctrlKey(jsi::PropNameID::forAscii(runtime, "ctrlKey")),
+        shiftKey(jsi::PropNameID::forAscii(runtime, "shiftKey")),
+        altKey(jsi::PropNameID::forAscii(runtime, "altKey")),
+        metaKey(jsi::PropNameID::forAscii(runtime, "metaKey")),
+        isPrimary(jsi::PropNameID::forAscii(runtime, "isPrimary")),
+        button(jsi::PropNameID::forAscii(runtime, "button")) {}
+
+  jsi::PropNameID pointerId;
+  jsi::PropNameID pressure;
+  jsi::PropNameID pointerType;
+  jsi::PropNameID clientX;
+  jsi::PropNameID clientY;
+  jsi::PropNameID x;
+  jsi::PropNameID y;
+  jsi::PropNameID pageX;
+  jsi::PropNameID pageY;
+  jsi::PropNameID screenX;
+  jsi::PropNameID screenY;
+  jsi::PropNameID offsetX;
+  jsi::PropNameID offsetY;
+  jsi::PropNameID width;
+  jsi::PropNameID height;
+  jsi::PropNameID tiltX;
+  jsi::PropNameID tiltY;
+  jsi::PropNameID detail;
+  jsi::PropNameID buttons;
+  jsi::PropNameID tangentialPressure;
+  jsi::PropNameID twist;
+  jsi::PropNameID ctrlKey;
+  jsi::PropNameID shiftKey;
+  jsi::PropNameID altKey;
+  jsi::PropNameID metaKey;
+  jsi::PropNameID isPrimary;
+  jsi::PropNameID button;
+};
+
+} // namespace
+
 jsi::Value PointerEvent::asJSIValue(jsi::Runtime& runtime) const {
+  const auto& names = PropNameIDCache::get<PointerEventPropNames>(runtime);
+
   auto object = jsi::Object(runtime);
-  object.setProperty(runtime, "pointerId", this->pointerId);
-  object.setProperty(runtime, "pressure", this->pressure);
-  object.setProperty(runtime, "pointerType", this->pointerType);
-  object.setProperty(runtime, "clientX", this->clientPoint.x);
-  object.setProperty(runtime, "clientY", this->clientPoint.y);
+  object.setProperty(runtime, names.pointerId, this->pointerId);
+  object.setProperty(runtime, names.pressure, this->pressure);
+  object.setProperty(runtime, names.pointerType, this->pointerType);
+  object.setProperty(runtime, names.clientX, this->clientPoint.x);
+  object.setProperty(runtime, names.clientY, this->clientPoint.y);
   // x/y are an alias to clientX/Y
-  object.setProperty(runtime, "x", this->clientPoint.x);
-  object.setProperty(runtime, "y", this->clientPoint.y);
+  object.setProperty(runtime, names.x, this->clientPoint.x);
+  object.setProperty(runtime, names.y, this->clientPoint.y);
   // since RN doesn't have a scrollable root, pageX/Y will always equal
   // clientX/Y
-  object.setProperty(runtime, "pageX", this->clientPoint.x);
-  object.setProperty(runtime, "pageY", this->clientPoint.y);
-  object.setProperty(runtime, "screenX", this->screenPoint.x);
-  object.setProperty(runtime, "screenY", this->screenPoint.y);
-  object.setProperty(runtime, "offsetX", this->offsetPoint.x);
-  object.setProperty(runtime, "offsetY", this->offsetPoint.y);
-  object.setProperty(runtime, "width", this->width);
-  object.setProperty(runtime, "height", this->height);
-  object.setProperty(runtime, "tiltX", this->tiltX);
-  object.setProperty(runtime, "tiltY", this->tiltY);
-  object.setProperty(runtime, "detail", this->detail);
-  object.setProperty(runtime, "buttons", this->buttons);
-  object.setProperty(runtime, "tangentialPressure", this->tangentialPressure);
-  object.setProperty(runtime, "twist", this->twist);
-  object.setProperty(runtime, "ctrlKey", this->ctrlKey);
-  object.setProperty(runtime, "shiftKey", this->shiftKey);
-  object.setProperty(runtime, "altKey", this->altKey);
-  object.setProperty(runtime, "metaKey", this->metaKey);
-  object.setProperty(runtime, "isPrimary", this->isPrimary);
-  object.setProperty(runtime, "button", this->button);
+  object.setProperty(runtime, names.pageX, this->clientPoint.x);
+  object.setProperty(runtime, names.pageY, this->clientPoint.y);
+  object.setProperty(runtime, names.screenX, this->screenPoint.x);
+  object.setProperty(runtime, names.screenY, this->screenPoint.y);
+  object.setProperty(runtime, names.offsetX, this->offsetPoint.x);
+  object.setProperty(runtime, names.offsetY, this->offsetPoint.y);
+  object.setProperty(runtime, names.width, this->width);
+  object.setProperty(runtime, names.height, this->height);
+  object.setProperty(runtime, names.tiltX, this->tiltX);
+  object.setProperty(runtime, names.tiltY, this->tiltY);
+  object.setProperty(runtime, names.detail, this->detail);
+  object.setProperty(runtime, names.buttons, this->buttons);
+  object.setProperty(
+      runtime, names.tangentialPressure, this->tangentialPressure);
+  object.setProperty(runtime, names.twist, this->twist);
+  object.setProperty(runtime, names.ctrlKey, this->ctrlKey);
+  object.setProperty(runtime, names.shiftKey, this->shiftKey);
+  object.setProperty(runtime, names.altKey, this->altKey);
+  object.setProperty(runtime, names.metaKey, this->metaKey);
+  object.setProperty(runtime, names.isPrimary, this->isPrimary);
+  object.setProperty(runtime, names.button, this->button);
   return object;
 }
 
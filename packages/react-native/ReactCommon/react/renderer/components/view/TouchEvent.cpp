@@ -7,8 +7,67 @@
 
 #include "TouchEvent.h"
 
+#include <react/utils/PropNameIDCache.h>
+
 namespace facebook::react {
 
+namespace {
+
+struct TouchEventPropNames {
+  explicit TouchEventPropNames(jsi::Runtime& runtime)
+      : touches(jsi::PropNameID::forAscii(runtime, "touches")),
+        changedTouches(jsi::PropNameID::forAscii(runtime, "changedTouches")),
+        targetTouches(jsi::PropNameID::forAscii(runtime, "targetTouches")) {}
+
+  jsi::PropNameID touches;
+  jsi::PropNameID changedTouches;
+  jsi::PropNameID targetTouches;
+};
+
+} // namespace
+
+static jsi::Value touchesPayload(
+    jsi::Runtime& runtime,
+    const Touches& touches) {
+  auto array = jsi::Array(runtime, touches.size());
+  int i = 0;
+  for (const auto& touch : touches) {
+    auto object = jsi::Object(runtime);
+    setTouchPayloadOnObject(object, runtime, touch);
+    array.setValueAtIndex(runtime, i++, object);
+  }
+  return array;
+}
+
+TouchEventPayload::TouchEventPayload(TouchEvent event)
+    : event(std::move(event)) {}
+
+jsi::Value TouchEventPayload::asJSIValue(jsi::Runtime& runtime) const {
+  const auto& names = PropNameIDCache::get<TouchEventPropNames>(runtime);
+
+  auto object = jsi::Object(runtime);
+  object.setProperty(
+      runtime, names.touches, touchesPayload(runtime, event.touches));
+  object.setProperty(
+      runtime,
+      names.changedTouches,
+      touchesPayload(runtime, event.changedTouches));
+  object.setProperty(
+      runtime,
+      names.targetTouches,
+      touchesPayload(runtime, event.targetTouches));
+
+  if (!event.changedTouches.empty()) {
+    const auto& firstChangedTouch = *event.changedTouches.begin();
+    setTouchPayloadOnObject(object, runtime, firstChangedTouch);
+  }
+  return object;
+}
+
+EventPayloadType TouchEventPayload::getType() const {
+  return EventPayloadType::TouchEvent;
+}
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const TouchEvent& /*touchEvent*/) {
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <react/renderer/core/EventPayload.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 
 #include <unordered_set>
@@ -39,6 +40,23 @@ struct TouchEvent {
   Touches targetTouches;
 };
 
+/*
+ * Typed event payload for `TouchEvent`. The event is stored as is and
+ * converted to a JSI object only when it's dispatched on the JavaScript
+ * thread.
+ */
+struct TouchEventPayload : public EventPayload {
+  explicit TouchEventPayload(TouchEvent event);
+
+  TouchEvent event;
+
+  /*
+   * EventPayload implementations
+   */
+  jsi::Value asJSIValue(jsi::Runtime& runtime) const override;
+  EventPayloadType getType() const override;
+};
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const TouchEvent& touchEvent);
@@ -9,48 +9,13 @@
 
 namespace facebook::react {
 
-#pragma mark - Touches
-
-static jsi::Value touchesPayload(
-    jsi::Runtime& runtime,
-    const Touches& touches) {
-  auto array = jsi::Array(runtime, touches.size());
-  int i = 0;
-  for (const auto& touch : touches) {
-    auto object = jsi::Object(runtime);
-    setTouchPayloadOnObject(object, runtime, touch);
-    array.setValueAtIndex(runtime, i++, object);
-  }
-  return array;
-}
-
-static jsi::Value touchEventPayload(
-    jsi::Runtime& runtime,
-    const TouchEvent& event) {
-  auto object = jsi::Object(runtime);
-  object.setProperty(
-      runtime, "touches", touchesPayload(runtime, event.touches));
-  object.setProperty(
-      runtime, "changedTouches", touchesPayload(runtime, event.changedTouches));
-  object.setProperty(
-      runtime, "targetTouches", touchesPayload(runtime, event.targetTouches));
-
-  if (!event.changedTouches.empty()) {
-    const auto& firstChangedTouch = *event.changedTouches.begin();
-    setTouchPayloadOnObject(object, runtime, firstChangedTouch);
-  }
-  return object;
-}
-
 void TouchEventEmitter::dispatchTouchEvent(
     std::string type,
     TouchEvent event,
     RawEvent::Category category) const {
   dispatchEvent(
       std::move(type),
-      [event = std::move(event)](jsi::Runtime& runtime) {
-        return touchEventPayload(runtime, event);
-      },
+      std::make_shared<TouchEventPayload>(std::move(event)),
       category);
 }
 
@@ -71,9 +36,7 @@ void TouchEventEmitter::onTouchStart(TouchEvent event) const {
 
 void TouchEventEmitter::onTouchMove(TouchEvent event) const {
   dispatchUniqueEvent(
-      "touchMove", [event = std::move(event)](jsi::Runtime& runtime) {
-        return touchEventPayload(runtime, event);
-      });
+      "touchMove", std::make_shared<TouchEventPayload>(std::move(event)));
 }
 
 void TouchEventEmitter::onTouchEnd(TouchEvent event) const {
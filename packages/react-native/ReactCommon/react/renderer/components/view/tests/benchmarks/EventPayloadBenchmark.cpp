@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/components/view/PointerEvent.h>
+#include <react/renderer/components/view/TouchEvent.h>
+#include <memory>
+
+namespace facebook::react {
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+
+PointerEvent makePointerEvent(int index) {
+  auto event = PointerEvent{};
+  event.pointerId = 1;
+  event.pressure = 0.5;
+  event.pointerType = "touch";
+  event.clientPoint = {Float(index), Float(index)};
+  event.screenPoint = {Float(index), Float(index)};
+  event.offsetPoint = {Float(index), Float(index)};
+  event.isPrimary = true;
+  return event;
+}
+
+/*
+ * Converts a `PointerEvent` the way it was done before property names were
+ * cached per runtime. Kept as a baseline.
+ */
+jsi::Value pointerEventAsJSIValueUncached(
+    jsi::Runtime& runtime,
+    const PointerEvent& event) {
+  auto object = jsi::Object(runtime);
+  object.setProperty(runtime, "pointerId", event.pointerId);
+  object.setProperty(runtime, "pressure", event.pressure);
+  object.setProperty(runtime, "pointerType", event.pointerType);
+  object.setProperty(runtime, "clientX", event.clientPoint.x);
+  object.setProperty(runtime, "clientY", event.clientPoint.y);
+  object.setProperty(runtime, "x", event.clientPoint.x);
+  object.setProperty(runtime, "y", event.clientPoint.y);
+  object.setProperty(runtime, "pageX", event.clientPoint.x);
+  object.setProperty(runtime, "pageY", event.clientPoint.y);
+  object.setProperty(runtime, "screenX", event.screenPoint.x);
+  object.setProperty(runtime, "screenY", event.screenPoint.y);
+  object.setProperty(runtime, "offsetX", event.offsetPoint.x);
+  object.setProperty(runtime, "offsetY", event.offsetPoint.y);
+  object.setProperty(runtime, "width", event.width);
+  object.setProperty(runtime, "height", event.height);
+  object.setProperty(runtime, "tiltX", event.tiltX);
+  object.setProperty(runtime, "tiltY", event.tiltY);
+  object.setProperty(runtime, "detail", event.detail);
+  object.setProperty(runtime, "buttons", event.buttons);
+  object.setProperty(runtime, "tangentialPressure", event.tangentialPressure);
+  object.setProperty(runtime, "twist", event.twist);
+  object.setProperty(runtime, "ctrlKey", event.ctrlKey);
+  object.setProperty(runtime, "shiftKey", event.shiftKey);
+  object.setProperty(runtime, "altKey", event.altKey);
+  object.setProperty(runtime, "metaKey", event.metaKey);
+  object.setProperty(runtime, "isPrimary", event.isPrimary);
+  object.setProperty(runtime, "button", event.button);
+  return object;
+}
+
+/*
+ * JavaScript-thread cost of converting 1,000 `pointermove` payloads.
+ */
+static void pointerMoveUncached(benchmark::State& state) {
+  auto events = std::vector<PointerEvent>{};
+  for (int i = 0; i < 1000; i++) {
+    events.push_back(makePointerEvent(i));
+  }
+
+  for (auto _ : state) {
+    for (const auto& event : events) {
+      benchmark::DoNotOptimize(
+          pointerEventAsJSIValueUncached(*runtime, event));
+    }
+  }
+}
+BENCHMARK(pointerMoveUncached);
+
+static void pointerMoveCachedPropNames(benchmark::State& state) {
+  auto events = std::vector<PointerEvent>{};
+  for (int i = 0; i < 1000; i++) {
+    events.push_back(makePointerEvent(i));
+  }
+
+  for (auto _ : state) {
+    for (const auto& event : events) {
+      benchmark::DoNotOptimize(event.asJSIValue(*runtime));
+    }
+  }
+}
+BENCHMARK(pointerMoveCachedPropNames);
+
+static void touchMoveTypedPayload(benchmark::State& state) {
+  auto touch = Touch{};
+  touch.identifier = 1;
+  auto event = TouchEvent{};
+  event.touches.insert(touch);
+  event.changedTouches.insert(touch);
+  event.targetTouches.insert(touch);
+  auto payload = TouchEventPayload{std::move(event)};
+
+  for (auto _ : state) {
+    for (int i = 0; i < 1000; i++) {
+      benchmark::DoNotOptimize(payload.asJSIValue(*runtime));
+    }
+  }
+}
+BENCHMARK(touchMoveTypedPayload);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -9,6 +9,11 @@
 
 namespace facebook::react {
 
-enum class EventPayloadType { ValueFactory, PointerEvent, ScrollEvent };
+enum class EventPayloadType {
+  ValueFactory,
+  PointerEvent,
+  ScrollEvent,
+  TouchEvent
+};
 
 }
@@ -7,6 +7,8 @@
 
 #include "EventQueue.h"
 
+#include <algorithm>
+
 #include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
@@ -21,58 +23,77 @@ EventQueue::EventQueue(
       [this](jsi::Runtime& runtime) { onBeat(runtime); });
 }
 
-void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
-  {
-    std::scoped_lock lock(queueMutex_);
-    eventQueue_.push_back(std::move(rawEvent));
-  }
+void EventQueue::updateQueueDepth() const {
+  metrics_.queueDepth = eventQueue_.size();
+  metrics_.peakQueueDepth =
+      std::max(metrics_.peakQueueDepth, metrics_.queueDepth);
+}
 
+void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
+  pendingEvents_.push({std::move(rawEvent), /* isUnique */ false});
   onEnqueue();
 }
 
 void EventQueue::enqueueUniqueEvent(RawEvent&& rawEvent) const {
-  {
-    std::scoped_lock lock(queueMutex_);
+  pendingEvents_.push({std::move(rawEvent), /* isUnique */ true});
+  onEnqueue();
+}
+
+void EventQueue::enqueueStateUpdate(StateUpdate&& stateUpdate) const {
+  pendingStateUpdates_.push(std::move(stateUpdate));
+  onEnqueue();
+}
+
+void EventQueue::drainPendingEvents() const {
+  std::vector<PendingEvent> pendingEvents;
+  if (pendingEvents_.drain(pendingEvents) == 0) {
+    return;
+  }
 
-    auto repeatedEvent = eventQueue_.rend();
-
-    for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-      if (it->type == rawEvent.type &&
-          it->eventTarget == rawEvent.eventTarget) {
-        repeatedEvent = it;
-        break;
-      } else if (it->eventTarget == rawEvent.eventTarget) {
-        // It is necessary to maintain order of different event types
-        // for the same target. If the same target has event types A1, B1
-        // in the event queue and event A2 occurs. A1 has to stay in the
-        // queue.
-        break;
+  for (auto& [rawEvent, isUnique] : pendingEvents) {
+    metrics_.enqueuedEventCount++;
+
+    if (isUnique) {
+      // Only the last event for the same target can be replaced. It is
+      // necessary to maintain order of different event types for the same
+      // target. If the same target has event types A1, B1 in the event queue
+      // and event A2 occurs, A1 has to stay in the queue.
+      auto lastEventIndex =
+          lastEventIndexByTarget_.find(rawEvent.eventTarget.get());
+
+      if (lastEventIndex != lastEventIndexByTarget_.end() &&
+          eventQueue_[lastEventIndex->second].type == rawEvent.type) {
+        eventQueue_[lastEventIndex->second] = std::move(rawEvent);
+        metrics_.coalescedEventCount++;
+        continue;
       }
     }
 
-    if (repeatedEvent == eventQueue_.rend()) {
-      eventQueue_.push_back(std::move(rawEvent));
-    } else {
-      *repeatedEvent = std::move(rawEvent);
-    }
+    lastEventIndexByTarget_[rawEvent.eventTarget.get()] = eventQueue_.size();
+    eventQueue_.push_back(std::move(rawEvent));
+    updateQueueDepth();
   }
-
-  onEnqueue();
 }
 
-void EventQueue::enqueueStateUpdate(StateUpdate&& stateUpdate) const {
-  {
-    std::scoped_lock lock(queueMutex_);
-    if (!stateUpdateQueue_.empty()) {
-      const auto position = stateUpdateQueue_.back();
-      if (stateUpdate.family == position.family) {
-        stateUpdateQueue_.pop_back();
-      }
+void EventQueue::drainPendingStateUpdates() const {
+  std::vector<StateUpdate> pendingStateUpdates;
+  if (pendingStateUpdates_.drain(pendingStateUpdates) == 0) {
+    return;
+  }
+
+  for (auto& stateUpdate : pendingStateUpdates) {
+    if (!stateUpdateQueue_.empty() &&
+        stateUpdateQueue_.back().family == stateUpdate.family) {
+      stateUpdateQueue_.pop_back();
     }
     stateUpdateQueue_.push_back(std::move(stateUpdate));
   }
+}
 
-  onEnqueue();
+EventQueue::Metrics EventQueue::getMetrics() const {
+  std::scoped_lock lock(queueMutex_);
+  drainPendingEvents();
+  return metrics_;
 }
 
 void EventQueue::onEnqueue() const {
@@ -93,6 +114,7 @@ void EventQueue::flushEvents(jsi::Runtime& runtime) const {
 
   {
     std::scoped_lock lock(queueMutex_);
+    drainPendingEvents();
 
     if (eventQueue_.empty()) {
       return;
@@ -100,6 +122,8 @@ void EventQueue::flushEvents(jsi::Runtime& runtime) const {
 
     queue = std::move(eventQueue_);
     eventQueue_.clear();
+    lastEventIndexByTarget_.clear();
+    metrics_.queueDepth = 0;
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
@@ -110,6 +134,7 @@ void EventQueue::flushStateUpdates() const {
 
   {
     std::scoped_lock lock(queueMutex_);
+    drainPendingStateUpdates();
 
     if (stateUpdateQueue_.empty()) {
       return;
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <jsi/jsi.h>
@@ -16,12 +17,17 @@
 #include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/StateUpdate.h>
+#include <react/utils/LockFreeMPSCQueue.h>
 
 namespace facebook::react {
 
 /*
  * Event Queue synchronized with given Event Beat and dispatching event
  * using given Event Pipe.
+ * Enqueueing is lock-free: producers only push onto multi-producer queues.
+ * Coalescing happens when the consumer drains them.
+ * Events are dispatched in the order in which their enqueue calls happened,
+ * not sorted by `RawEvent::eventStartTimeStamp`.
  */
 class EventQueue {
  public:
@@ -37,7 +43,10 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * Replaces last RawEvent from the queue if it has the same type and target.
+   * The lookup is O(1): the queue keeps an index of the last event enqueued
+   * for every target. The replacement happens when pending events are
+   * drained.
    * Can be called on any thread.
    */
   void enqueueUniqueEvent(RawEvent&& rawEvent) const;
@@ -53,6 +62,51 @@ class EventQueue {
    */
   void experimental_flushSync() const;
 
+  /*
+   * Snapshot of the queue counters, useful for tracing event storms (e.g.
+   * scroll or pointer-move) and evaluating how effective coalescing is.
+   */
+  struct Metrics {
+    /*
+     * Number of events currently waiting to be flushed.
+     */
+    size_t queueDepth{0};
+
+    /*
+     * Largest `queueDepth` observed since the queue was created.
+     */
+    size_t peakQueueDepth{0};
+
+    /*
+     * Total number of events passed to `enqueueEvent` and
+     * `enqueueUniqueEvent`.
+     */
+    uint64_t enqueuedEventCount{0};
+
+    /*
+     * Number of events that replaced an already enqueued event instead of
+     * growing the queue.
+     */
+    uint64_t coalescedEventCount{0};
+
+    /*
+     * Ratio of coalesced events to all enqueued events, in [0, 1].
+     */
+    double coalescingRatio() const {
+      return enqueuedEventCount == 0
+          ? 0.0
+          : static_cast<double>(coalescedEventCount) /
+              static_cast<double>(enqueuedEventCount);
+    }
+  };
+
+  /*
+   * Returns current queue metrics.
+   * Drains pending events first, so the values account for coalescing.
+   * Can be called on any thread.
+   */
+  Metrics getMetrics() const;
+
  protected:
   /*
    * Called on any enqueue operation.
@@ -68,9 +122,37 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
-  // Thread-safe, protected by `queueMutex_`.
+
+  struct PendingEvent {
+    RawEvent rawEvent;
+    bool isUnique;
+  };
+
+  /*
+   * Moves pending events and state updates from the lock-free queues into
+   * `eventQueue_` (and `stateUpdateQueue_`), applying coalescing rules in the
+   * order the events were enqueued.
+   * Must be called with `queueMutex_` locked.
+   */
+  void drainPendingEvents() const;
+  void drainPendingStateUpdates() const;
+
+  void updateQueueDepth() const;
+
+  // Thread-safe, lock-free. Written by producers, drained by consumers.
+  mutable LockFreeMPSCQueue<PendingEvent> pendingEvents_;
+  mutable LockFreeMPSCQueue<StateUpdate> pendingStateUpdates_;
+
+  // Protected by `queueMutex_`, which is only taken by consumers.
+  // Events are dispatched in the order they were enqueued, whatever their
+  // category: the processor derives priorities from that order.
   mutable std::vector<RawEvent> eventQueue_;
+  // Index (in `eventQueue_`) of the last event enqueued for a given target.
+  // Used by `enqueueUniqueEvent` to coalesce without scanning.
+  mutable std::unordered_map<const EventTarget*, size_t>
+      lastEventIndexByTarget_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
+  mutable Metrics metrics_;
   mutable std::mutex queueMutex_;
 };
 
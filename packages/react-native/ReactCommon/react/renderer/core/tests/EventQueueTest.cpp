@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueue.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+class ManualEventBeat : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void request() const override {}
+};
+
+class TestableEventQueue : public EventQueue {
+ public:
+  using EventQueue::EventQueue;
+  using EventQueue::flushEvents;
+};
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    runtimeScheduler_ = std::make_unique<RuntimeScheduler>(
+        [](std::function<void(jsi::Runtime&)>&& /*callback*/) {});
+
+    auto eventPipe = [this](
+                         jsi::Runtime& /*runtime*/,
+                         const EventTarget* /*eventTarget*/,
+                         const std::string& type,
+                         ReactEventPriority /*priority*/,
+                         const EventPayload& /*payload*/) {
+      eventTypes_.push_back(type);
+    };
+
+    auto dummyEventPipeConclusion = [](jsi::Runtime& /*runtime*/) {};
+    auto dummyStatePipe = [](const StateUpdate& /*stateUpdate*/) {};
+
+    eventQueue_ = std::make_unique<TestableEventQueue>(
+        EventQueueProcessor(
+            eventPipe, dummyEventPipeConclusion, dummyStatePipe, {}),
+        std::make_unique<ManualEventBeat>(
+            std::make_shared<EventBeat::OwnerBox>(), *runtimeScheduler_));
+
+    targetA_ = std::make_shared<const EventTarget>(nullptr, 1);
+    targetB_ = std::make_shared<const EventTarget>(nullptr, 1);
+  }
+
+  RawEvent makeEvent(
+      std::string type,
+      SharedEventTarget target,
+      RawEvent::Category category = RawEvent::Category::Unspecified) {
+    return RawEvent(
+        std::move(type),
+        std::make_shared<ValueFactoryEventPayload>(dummyValueFactory_),
+        std::move(target),
+        category);
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::unique_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::unique_ptr<TestableEventQueue> eventQueue_;
+  std::vector<std::string> eventTypes_;
+  ValueFactory dummyValueFactory_;
+  SharedEventTarget targetA_;
+  SharedEventTarget targetB_;
+};
+
+TEST_F(EventQueueTest, uniqueEventReplacesLastEventOfSameTypeAndTarget) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetB_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_));
+
+  auto metrics = eventQueue_->getMetrics();
+  EXPECT_EQ(metrics.queueDepth, 2);
+  EXPECT_EQ(metrics.enqueuedEventCount, 3);
+  EXPECT_EQ(metrics.coalescedEventCount, 1);
+
+  eventQueue_->flushEvents(*runtime_);
+
+  EXPECT_EQ(eventTypes_.size(), 2);
+  EXPECT_EQ(eventQueue_->getMetrics().queueDepth, 0);
+}
+
+TEST_F(EventQueueTest, uniqueEventKeepsOrderOfDifferentTypesForSameTarget) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_));
+  eventQueue_->enqueueEvent(makeEvent("press", targetA_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_));
+
+  EXPECT_EQ(eventQueue_->getMetrics().coalescedEventCount, 0);
+
+  eventQueue_->flushEvents(*runtime_);
+
+  EXPECT_EQ(eventTypes_.size(), 3);
+  EXPECT_EQ(eventTypes_[0], "scroll");
+  EXPECT_EQ(eventTypes_[1], "press");
+  EXPECT_EQ(eventTypes_[2], "scroll");
+}
+
+TEST_F(EventQueueTest, eventsOfDifferentCategoriesKeepTheirOrder) {
+  auto move = [&]() {
+    return makeEvent("touchMove", targetA_, RawEvent::Category::Continuous);
+  };
+  eventQueue_->enqueueEvent(
+      makeEvent("touchStart", targetA_, RawEvent::Category::ContinuousStart));
+  eventQueue_->enqueueUniqueEvent(move());
+  eventQueue_->enqueueUniqueEvent(move());
+  eventQueue_->enqueueEvent(
+      makeEvent("touchEnd", targetA_, RawEvent::Category::ContinuousEnd));
+  // Doesn't coalesce with the earlier moves, `touchEnd` is in between.
+  eventQueue_->enqueueUniqueEvent(move());
+
+  auto metrics = eventQueue_->getMetrics();
+  EXPECT_EQ(metrics.queueDepth, 4);
+  EXPECT_EQ(metrics.peakQueueDepth, 4);
+  EXPECT_DOUBLE_EQ(metrics.coalescingRatio(), 1.0 / 5.0);
+
+  eventQueue_->flushEvents(*runtime_);
+
+  EXPECT_EQ(
+      eventTypes_,
+      (std::vector<std::string>{
+          "touchStart", "touchMove", "touchEnd", "touchMove"}));
+}
+
+} // namespace facebook::react
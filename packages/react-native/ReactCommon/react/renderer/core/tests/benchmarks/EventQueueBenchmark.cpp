@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueue.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <memory>
+
+namespace facebook::react {
+
+class NoopEventBeat : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void request() const override {}
+};
+
+auto runtimeScheduler = RuntimeScheduler{
+    [](std::function<void(jsi::Runtime&)>&& /*callback*/) {}};
+
+std::unique_ptr<EventQueue> makeEventQueue() {
+  return std::make_unique<EventQueue>(
+      EventQueueProcessor(
+          [](jsi::Runtime& /*runtime*/,
+             const EventTarget* /*eventTarget*/,
+             const std::string& /*type*/,
+             ReactEventPriority /*priority*/,
+             const EventPayload& /*payload*/) {},
+          [](jsi::Runtime& /*runtime*/) {},
+          [](const StateUpdate& /*stateUpdate*/) {},
+          {}),
+      std::make_unique<NoopEventBeat>(
+          std::make_shared<EventBeat::OwnerBox>(), runtimeScheduler));
+}
+
+std::unique_ptr<EventQueue> eventQueue;
+auto eventPayload =
+    std::make_shared<ValueFactoryEventPayload>(ValueFactory{});
+
+/*
+ * Measures `enqueueEvent` throughput with several producer threads
+ * (UI thread, animation thread, image decode callbacks, etc.) hitting the
+ * same queue. Pending events are drained by thread 0 every 1000 iterations,
+ * mirroring a consumer that runs concurrently with producers.
+ */
+static void enqueueEventWithContention(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    eventQueue = makeEventQueue();
+  }
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    eventQueue->enqueueEvent(RawEvent("pointerMove", eventPayload, nullptr));
+    if (state.thread_index() == 0 && ++iteration % 1000 == 0) {
+      benchmark::DoNotOptimize(eventQueue->getMetrics());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) {
+    eventQueue.reset();
+  }
+}
+BENCHMARK(enqueueEventWithContention)->ThreadRange(1, 8)->UseRealTime();
+
+static void enqueueUniqueEventWithContention(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    eventQueue = makeEventQueue();
+  }
+
+  auto eventTarget = std::make_shared<const EventTarget>(
+      nullptr, /* surfaceId */ state.thread_index());
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    eventQueue->enqueueUniqueEvent(
+        RawEvent("scroll", eventPayload, eventTarget));
+    if (state.thread_index() == 0 && ++iteration % 1000 == 0) {
+      benchmark::DoNotOptimize(eventQueue->getMetrics());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) {
+    eventQueue.reset();
+  }
+}
+BENCHMARK(enqueueUniqueEventWithContention)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
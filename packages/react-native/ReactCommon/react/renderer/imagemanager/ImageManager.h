@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/imagemanager/ImageRequest.h>
@@ -40,6 +41,13 @@ class ImageManager {
       const ImageRequestParams& imageRequestParams,
       Tag tag) const;
 
+  /*
+   * Returns metadata of a previously loaded image with given source, if it's
+   * known without loading the image again.
+   */
+  virtual std::optional<ImageMetadata> getImageMetadata(
+      const ImageSource& imageSource) const;
+
  private:
   void* self_{};
 };
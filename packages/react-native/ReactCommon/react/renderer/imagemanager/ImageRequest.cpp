@@ -13,12 +13,23 @@ ImageRequest::ImageRequest(
     ImageSource imageSource,
     std::shared_ptr<const ImageTelemetry> telemetry,
     SharedFunction<> resumeFunction,
-    SharedFunction<> cancelationFunction)
+    SharedFunction<> cancelationFunction,
+    SharedFunction<ImageRequestPriority> priorityChangeFunction)
     : imageSource_(std::move(imageSource)), telemetry_(std::move(telemetry)) {
   coordinator_ = std::make_shared<ImageResponseObserverCoordinator>(
-      std::move(resumeFunction), std::move(cancelationFunction));
+      std::move(resumeFunction),
+      std::move(cancelationFunction),
+      std::move(priorityChangeFunction));
 }
 
+ImageRequest::ImageRequest(
+    ImageSource imageSource,
+    std::shared_ptr<const ImageTelemetry> telemetry,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator)
+    : imageSource_(std::move(imageSource)),
+      telemetry_(std::move(telemetry)),
+      coordinator_(std::move(coordinator)) {}
+
 const ImageSource& ImageRequest::getImageSource() const {
   return imageSource_;
 }
@@ -32,7 +32,17 @@ class ImageRequest final {
       ImageSource imageSource,
       std::shared_ptr<const ImageTelemetry> telemetry,
       SharedFunction<> resumeFunction = {},
-      SharedFunction<> cancelationFunction = {});
+      SharedFunction<> cancelationFunction = {},
+      SharedFunction<ImageRequestPriority> priorityChangeFunction = {});
+
+  /*
+   * Creates a request sharing the observer coordinator (and therefore the
+   * underlying load) of another request.
+   */
+  ImageRequest(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator);
 
   /*
    * The move constructor.
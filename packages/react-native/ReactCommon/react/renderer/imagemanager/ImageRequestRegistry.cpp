@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageRequestRegistry.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kMinSweepThreshold = 256;
+
+Float getPixelDimension(const ImageSource& imageSource) {
+  auto scale = imageSource.scale > 0 ? imageSource.scale : Float{1};
+  return std::max(imageSource.size.width, imageSource.size.height) * scale;
+}
+
+/*
+ * Returns the source with its size enlarged to the upper bound of its size
+ * bucket, keeping the aspect ratio.
+ */
+ImageSource normalizeImageSource(
+    const ImageSource& imageSource,
+    int sizeBucket) {
+  auto normalizedImageSource = imageSource;
+  if (sizeBucket > 0) {
+    auto factor = std::ldexp(Float{1}, sizeBucket - 1) /
+        getPixelDimension(imageSource);
+    normalizedImageSource.size.width *= factor;
+    normalizedImageSource.size.height *= factor;
+  }
+  return normalizedImageSource;
+}
+
+} // namespace
+
+ImageRequestRegistry::ImageRequestRegistry(size_t metadataCacheSize)
+    : sweepThreshold_{kMinSweepThreshold},
+      metadataCache_{metadataCacheSize} {}
+
+ImageRequest ImageRequestRegistry::requestImage(
+    const ImageSource& imageSource,
+    const std::shared_ptr<const ImageTelemetry>& telemetry,
+    const StartRequestFunction& startRequest) {
+  requestCount_++;
+
+  auto sizeBucket = getSizeBucket(imageSource);
+  auto key = makeKey(imageSource, sizeBucket);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = coordinators_.find(key);
+    if (iterator != coordinators_.end()) {
+      auto coordinator = iterator->second.lock();
+      if (coordinator &&
+          coordinator->getStatus() != ImageResponse::Status::Failed) {
+        coalescedRequestCount_++;
+        return {imageSource, telemetry, std::move(coordinator)};
+      }
+    }
+  }
+
+  // Starting a request may take a while, so it's done outside of the lock.
+  // If an equivalent request is started concurrently, the most recent one is
+  // shared from now on.
+  auto imageRequest =
+      startRequest(normalizeImageSource(imageSource, sizeBucket));
+  auto coordinator = imageRequest.getSharedObserverCoordinator();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    coordinators_.insert_or_assign(std::move(key), coordinator);
+    if (coordinators_.size() > sweepThreshold_) {
+      sweep();
+    }
+  }
+
+  return {
+      imageSource,
+      telemetry ? telemetry : imageRequest.getSharedTelemetry(),
+      std::move(coordinator)};
+}
+
+void ImageRequestRegistry::recordImageMetadata(
+    const ImageSource& imageSource,
+    const ImageMetadata& imageMetadata) {
+  metadataCache_.set(makeKey(imageSource, 0), imageMetadata);
+}
+
+std::optional<ImageMetadata> ImageRequestRegistry::getImageMetadata(
+    const ImageSource& imageSource) const {
+  return metadataCache_.get(makeKey(imageSource, 0));
+}
+
+ImageRequestRegistry::Metrics ImageRequestRegistry::getMetrics() const {
+  return {requestCount_, coalescedRequestCount_};
+}
+
+int ImageRequestRegistry::getSizeBucket(const ImageSource& imageSource) {
+  auto pixelDimension = getPixelDimension(imageSource);
+  if (!(pixelDimension > 0)) {
+    return 0;
+  }
+  auto exponent = std::ceil(std::log2(std::max(pixelDimension, Float{1})));
+  return 1 + static_cast<int>(exponent);
+}
+
+ImageRequestRegistry::Key ImageRequestRegistry::makeKey(
+    const ImageSource& imageSource,
+    int sizeBucket) {
+  auto headers = imageSource.headers;
+  std::sort(headers.begin(), headers.end());
+  return {
+      imageSource.type,
+      imageSource.uri,
+      imageSource.bundle,
+      imageSource.method,
+      imageSource.body,
+      imageSource.cache,
+      std::move(headers),
+      sizeBucket};
+}
+
+size_t ImageRequestRegistry::KeyHash::operator()(const Key& key) const {
+  auto seed = hash_combine(
+      key.type,
+      key.uri,
+      key.bundle,
+      key.method,
+      key.body,
+      key.cache,
+      key.sizeBucket);
+  for (const auto& [name, value] : key.headers) {
+    hash_combine(seed, name, value);
+  }
+  return seed;
+}
+
+void ImageRequestRegistry::sweep() {
+  for (auto iterator = coordinators_.begin();
+       iterator != coordinators_.end();) {
+    iterator = iterator->second.expired() ? coordinators_.erase(iterator)
+                                          : std::next(iterator);
+  }
+  sweepThreshold_ = std::max(kMinSweepThreshold, coordinators_.size() * 2);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/primitives.h>
+#include <react/utils/ConcurrentLRUCache.h>
+
+namespace facebook::react {
+
+/*
+ * Coalesces requests for the same image coming from different shadow nodes
+ * (e.g. the same avatar in every row of a list) into one load, and remembers
+ * metadata of loaded images.
+ *
+ * Requests are keyed by the normalized image source and a size bucket: sizes
+ * are rounded up to the next power of two (in pixels), and the shared load is
+ * started for the upper bound of the bucket, so that it's good enough for
+ * every request in the bucket.
+ *
+ * In-flight and completed loads are only referenced weakly; a load is shared
+ * as long as some `ImageRequest` for it is alive. Failed loads are never
+ * shared, so a new request retries.
+ *
+ * All methods can be called from any thread.
+ */
+class ImageRequestRegistry final {
+ public:
+  /*
+   * Starts a platform load for given (normalized) image source.
+   */
+  using StartRequestFunction =
+      std::function<ImageRequest(const ImageSource& imageSource)>;
+
+  struct Metrics {
+    // Number of `requestImage` calls.
+    size_t requestCount{0};
+    // Number of requests which joined an existing load.
+    size_t coalescedRequestCount{0};
+  };
+
+  static constexpr size_t kDefaultMetadataCacheSize = 512;
+
+  explicit ImageRequestRegistry(
+      size_t metadataCacheSize = kDefaultMetadataCacheSize);
+
+  /*
+   * Returns a request sharing the load of an equivalent live request if there
+   * is one, otherwise calls `startRequest` with the normalized image source.
+   */
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      const std::shared_ptr<const ImageTelemetry>& telemetry,
+      const StartRequestFunction& startRequest);
+
+  /*
+   * Platform image loaders call this once an image is loaded.
+   */
+  void recordImageMetadata(
+      const ImageSource& imageSource,
+      const ImageMetadata& imageMetadata);
+
+  /*
+   * Returns metadata of a previously loaded image with given source (of any
+   * size), if it's still in the cache.
+   */
+  std::optional<ImageMetadata> getImageMetadata(
+      const ImageSource& imageSource) const;
+
+  Metrics getMetrics() const;
+
+  /*
+   * Index of the power of two size bucket of the given image source; `0` for
+   * empty sizes.
+   */
+  static int getSizeBucket(const ImageSource& imageSource);
+
+ private:
+  struct Key {
+    ImageSource::Type type;
+    std::string uri;
+    std::string bundle;
+    std::string method;
+    std::string body;
+    ImageSource::CacheStategy cache;
+    // Sorted, the order of headers doesn't matter.
+    std::vector<std::pair<std::string, std::string>> headers;
+    int sizeBucket;
+
+    bool operator==(const Key& rhs) const = default;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static Key makeKey(const ImageSource& imageSource, int sizeBucket);
+
+  /*
+   * Removes entries of requests which aren't alive anymore.
+   * Must be called with `mutex_` held.
+   */
+  void sweep();
+
+  std::unordered_map<
+      Key,
+      std::weak_ptr<const ImageResponseObserverCoordinator>,
+      KeyHash>
+      coordinators_;
+  // Expired entries are swept when the registry grows past this size.
+  size_t sweepThreshold_;
+  mutable std::mutex mutex_;
+
+  ConcurrentLRUCache<Key, ImageMetadata, KeyHash> metadataCache_;
+
+  std::atomic<size_t> requestCount_{0};
+  std::atomic<size_t> coalescedRequestCount_{0};
+};
+
+} // namespace facebook::react
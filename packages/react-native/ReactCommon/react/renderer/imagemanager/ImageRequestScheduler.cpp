@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageRequestScheduler.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * State of a single request. Observes the coordinator while its load is
+ * running, to learn when the load finishes.
+ */
+class ImageRequestScheduler::Entry final : public ImageResponseObserver {
+ public:
+  enum class State {
+    // Waiting for its turn.
+    Queued,
+    // Loading.
+    Running,
+    // Finished, or cancelled because nobody observes the request.
+    Idle,
+  };
+
+  Entry(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::weak_ptr<ImageRequestScheduler> scheduler)
+      : imageSource(std::move(imageSource)),
+        telemetry(std::move(telemetry)),
+        scheduler(std::move(scheduler)) {}
+
+  const ImageSource imageSource;
+  const std::shared_ptr<const ImageTelemetry> telemetry;
+  const std::weak_ptr<ImageRequestScheduler> scheduler;
+  std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+
+  // Mutable: protected by the scheduler's `mutex_`.
+  ImageRequestPriority priority{ImageRequestPriority::Default};
+  uint64_t sequenceNumber{0};
+  State state{State::Idle};
+  // Incremented whenever a load starts or is cancelled, so that a load
+  // which is cancelled while it's being started can be told apart.
+  uint64_t loadNumber{0};
+  // Cancels the running platform load. Empty while the load is being
+  // started, and after it was cancelled or finished.
+  std::function<void()> cancelLoad;
+
+#pragma mark - ImageResponseObserver
+
+  void didReceiveProgress(float /*progress*/, int64_t /*loaded*/, int64_t)
+      const override {}
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    if (auto sharedScheduler = scheduler.lock()) {
+      sharedScheduler->loadDidFinish(*this);
+    }
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {
+    if (auto sharedScheduler = scheduler.lock()) {
+      sharedScheduler->loadDidFinish(*this);
+    }
+  }
+};
+
+ImageRequestScheduler::ImageRequestScheduler(
+    StartLoadFunction startLoad,
+    size_t maxConcurrentLoadCount)
+    : startLoad_(std::move(startLoad)),
+      maxConcurrentLoadCount_(maxConcurrentLoadCount) {}
+
+ImageRequest ImageRequestScheduler::requestImage(
+    const ImageSource& imageSource,
+    std::shared_ptr<const ImageTelemetry> telemetry) {
+  auto weakScheduler = weak_from_this();
+  auto entry = std::make_shared<Entry>(imageSource, telemetry, weakScheduler);
+
+  // The coordinator retains the entry through these functions; the entry
+  // only references the coordinator weakly.
+  auto imageRequest = ImageRequest{
+      imageSource,
+      std::move(telemetry),
+      SharedFunction<>{[weakScheduler, entry]() {
+        if (auto scheduler = weakScheduler.lock()) {
+          scheduler->resume(entry);
+        }
+      }},
+      SharedFunction<>{[weakScheduler, entry]() {
+        if (auto scheduler = weakScheduler.lock()) {
+          scheduler->cancel(entry);
+        }
+      }},
+      SharedFunction<ImageRequestPriority>{
+          [weakScheduler, entry](ImageRequestPriority priority) {
+            if (auto scheduler = weakScheduler.lock()) {
+              scheduler->setPriority(entry, priority);
+            }
+          }}};
+  entry->coordinator = imageRequest.getSharedObserverCoordinator();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry->state = Entry::State::Queued;
+    entry->sequenceNumber = nextSequenceNumber_++;
+    entries_.push_back(entry);
+  }
+  dispatch();
+
+  return imageRequest;
+}
+
+ImageRequestScheduler::Metrics ImageRequestScheduler::getMetrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {
+      entries_.size() - runningLoadCount_,
+      runningLoadCount_,
+      startedLoadCount_,
+      cancelledLoadCount_};
+}
+
+void ImageRequestScheduler::setPriority(
+    const std::shared_ptr<Entry>& entry,
+    ImageRequestPriority priority) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entry->priority == priority) {
+      return;
+    }
+    entry->priority = priority;
+  }
+  dispatch();
+}
+
+void ImageRequestScheduler::resume(const std::shared_ptr<Entry>& entry) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entry->state != Entry::State::Idle) {
+      return;
+    }
+    entry->state = Entry::State::Queued;
+    entries_.push_back(entry);
+  }
+  dispatch();
+}
+
+void ImageRequestScheduler::cancel(const std::shared_ptr<Entry>& entry) {
+  // Called by the coordinator while it's locked, so this must not call back
+  // into any coordinator. Only queued requests can be cancelled this way:
+  // while a load is running, the entry itself observes the coordinator.
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entry->state != Entry::State::Queued) {
+    return;
+  }
+  entry->state = Entry::State::Idle;
+  entries_.erase(std::find(entries_.begin(), entries_.end(), entry));
+}
+
+void ImageRequestScheduler::loadDidFinish(const Entry& entry) {
+  auto coordinator = std::shared_ptr<const ImageResponseObserverCoordinator>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = std::find_if(
+        entries_.begin(), entries_.end(), [&](const auto& candidate) {
+          return candidate.get() == &entry;
+        });
+    if (iterator == entries_.end()) {
+      return;
+    }
+
+    if ((*iterator)->state == Entry::State::Running) {
+      runningLoadCount_--;
+    }
+    (*iterator)->state = Entry::State::Idle;
+    (*iterator)->cancelLoad = nullptr;
+    coordinator = (*iterator)->coordinator.lock();
+    entries_.erase(iterator);
+  }
+
+  if (coordinator) {
+    coordinator->removeObserver(entry);
+  }
+  dispatch();
+}
+
+void ImageRequestScheduler::dispatch() {
+  struct LoadToCancel {
+    std::shared_ptr<Entry> entry;
+    std::function<void()> cancelLoad;
+  };
+  struct LoadToStart {
+    std::shared_ptr<Entry> entry;
+    uint64_t loadNumber;
+  };
+  auto loadsToCancel = std::vector<LoadToCancel>{};
+  auto loadsToStart = std::vector<LoadToStart>{};
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A load which is still being started has no cancel function yet; the
+    // incremented `loadNumber` tells the `dispatch` starting it to cancel it
+    // once it has started.
+    auto cancelRunningLoad = [&](const std::shared_ptr<Entry>& entry) {
+      runningLoadCount_--;
+      cancelledLoadCount_++;
+      entry->loadNumber++;
+      loadsToCancel.push_back({entry, std::exchange(entry->cancelLoad, {})});
+    };
+
+    // Requests which aren't retained by anyone anymore.
+    std::erase_if(entries_, [&](const auto& entry) {
+      if (!entry->coordinator.expired()) {
+        return false;
+      }
+      if (entry->state == Entry::State::Running) {
+        cancelRunningLoad(entry);
+      }
+      entry->state = Entry::State::Idle;
+      return true;
+    });
+
+    for (const auto& entry : entries_) {
+      if (entry->state == Entry::State::Running &&
+          entry->priority == ImageRequestPriority::Offscreen) {
+        cancelRunningLoad(entry);
+        entry->state = Entry::State::Queued;
+      }
+    }
+
+    while (runningLoadCount_ < maxConcurrentLoadCount_) {
+      auto bestEntry = std::shared_ptr<Entry>{};
+      for (const auto& entry : entries_) {
+        if (entry->state != Entry::State::Queued ||
+            entry->priority == ImageRequestPriority::Offscreen) {
+          continue;
+        }
+        if (!bestEntry ||
+            std::tie(entry->priority, entry->sequenceNumber) <
+                std::tie(bestEntry->priority, bestEntry->sequenceNumber)) {
+          bestEntry = entry;
+        }
+      }
+      if (!bestEntry) {
+        break;
+      }
+
+      bestEntry->state = Entry::State::Running;
+      bestEntry->loadNumber++;
+      runningLoadCount_++;
+      startedLoadCount_++;
+      loadsToStart.push_back({bestEntry, bestEntry->loadNumber});
+    }
+  }
+
+  // Coordinators and platform loaders may call back into the scheduler, so
+  // they are called without holding the lock.
+  for (const auto& [entry, cancelLoad] : loadsToCancel) {
+    if (!cancelLoad) {
+      // Still being started; cancelled by the `dispatch` starting it.
+      continue;
+    }
+    cancelLoad();
+    if (auto coordinator = entry->coordinator.lock()) {
+      coordinator->removeObserver(*entry);
+    }
+  }
+
+  auto hasReleasedEntries = false;
+  for (const auto& [entry, loadNumber] : loadsToStart) {
+    auto coordinator = entry->coordinator.lock();
+    if (!coordinator) {
+      // Released in the meantime; removed by the next `dispatch`.
+      hasReleasedEntries = true;
+      continue;
+    }
+
+    if (entry->telemetry) {
+      entry->telemetry->willStartLoad();
+    }
+    // Observing before starting, in case the load finishes synchronously.
+    coordinator->addObserver(*entry);
+    auto cancelLoad =
+        std::function<void()>{startLoad_(entry->imageSource, coordinator)};
+
+    auto wasCancelled = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (entry->loadNumber != loadNumber) {
+        wasCancelled = true;
+      } else if (entry->state == Entry::State::Running) {
+        // Otherwise the load has already finished.
+        entry->cancelLoad = std::move(cancelLoad);
+      }
+    }
+    if (wasCancelled) {
+      // Cancelled by another `dispatch` while it was being started.
+      cancelLoad();
+      coordinator->removeObserver(*entry);
+    }
+  }
+
+  if (hasReleasedEntries) {
+    dispatch();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/primitives.h>
+#include <react/utils/SharedFunction.h>
+
+namespace facebook::react {
+
+/*
+ * Decides when image loads start, based on visibility hints delivered
+ * through `ImageResponseObserverCoordinator::setPriority` (see
+ * `ImageVisibilityMountHook`).
+ *
+ * - Order: queued requests start in the order of their priority, and in the
+ *   order of requesting within the same priority.
+ * - Throttle: at most `maxConcurrentLoadCount` loads run at the same time;
+ *   requests with `Offscreen` priority don't start at all.
+ * - Pre-cancel: a running load whose image moves far away from the viewport
+ *   is cancelled and queued again, instead of waiting for the node to be
+ *   destroyed.
+ *
+ * The time a request spent in the queue is recorded in its `ImageTelemetry`.
+ *
+ * Must be owned by a `std::shared_ptr`. All methods can be called from any
+ * thread.
+ */
+class ImageRequestScheduler final
+    : public std::enable_shared_from_this<ImageRequestScheduler> {
+ public:
+  /*
+   * Starts a platform load of the image, which reports its progress and
+   * result to the coordinator (if it's still alive). Returns a function
+   * cancelling the load.
+   */
+  using StartLoadFunction = std::function<SharedFunction<>(
+      const ImageSource& imageSource,
+      const std::weak_ptr<const ImageResponseObserverCoordinator>&
+          coordinator)>;
+
+  struct Metrics {
+    size_t queuedRequestCount{0};
+    size_t runningLoadCount{0};
+    // Totals since the scheduler was created.
+    size_t startedLoadCount{0};
+    size_t cancelledLoadCount{0};
+  };
+
+  static constexpr size_t kDefaultMaxConcurrentLoadCount = 6;
+
+  explicit ImageRequestScheduler(
+      StartLoadFunction startLoad,
+      size_t maxConcurrentLoadCount = kDefaultMaxConcurrentLoadCount);
+
+  /*
+   * Returns a request which starts loading once the scheduler picks it.
+   * New requests have `Default` priority.
+   */
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry);
+
+  Metrics getMetrics() const;
+
+ private:
+  class Entry;
+
+  void setPriority(
+      const std::shared_ptr<Entry>& entry,
+      ImageRequestPriority priority);
+  void resume(const std::shared_ptr<Entry>& entry);
+  void cancel(const std::shared_ptr<Entry>& entry);
+  void loadDidFinish(const Entry& entry);
+
+  /*
+   * Starts and cancels loads to satisfy the current priorities.
+   */
+  void dispatch();
+
+  const StartLoadFunction startLoad_;
+  const size_t maxConcurrentLoadCount_;
+
+  // Queued and running requests.
+  std::vector<std::shared_ptr<Entry>> entries_;
+  size_t runningLoadCount_{0};
+  size_t startedLoadCount_{0};
+  size_t cancelledLoadCount_{0};
+  uint64_t nextSequenceNumber_{0};
+  mutable std::mutex mutex_;
+};
+
+} // namespace facebook::react
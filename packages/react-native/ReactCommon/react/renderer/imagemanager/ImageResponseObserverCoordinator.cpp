@@ -15,9 +15,11 @@ namespace facebook::react {
 
 ImageResponseObserverCoordinator::ImageResponseObserverCoordinator(
     SharedFunction<> resumeFunction,
-    SharedFunction<> cancelationFunction)
+    SharedFunction<> cancelationFunction,
+    SharedFunction<ImageRequestPriority> priorityChangeFunction)
     : resumeRequest_(std::move(resumeFunction)),
-      cancelRequest_(std::move(cancelationFunction)) {}
+      cancelRequest_(std::move(cancelationFunction)),
+      changeRequestPriority_(std::move(priorityChangeFunction)) {}
 
 void ImageResponseObserverCoordinator::addObserver(
     const ImageResponseObserver& observer) const {
@@ -58,7 +60,7 @@ void ImageResponseObserverCoordinator::removeObserver(
   // We remove only one element to maintain a balance between add/remove calls.
   auto position = std::find(observers_.begin(), observers_.end(), &observer);
   if (position != observers_.end()) {
-    observers_.erase(position, observers_.end());
+    observers_.erase(position);
 
     if (observers_.empty() && status_ == ImageResponse::Status::Loading) {
       status_ = ImageResponse::Status::Cancelled;
@@ -95,7 +97,7 @@ void ImageResponseObserverCoordinator::nativeImageResponseComplete(
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers_) {
+  for (auto observer : observers) {
     observer->didReceiveImage(imageResponse);
   }
 }
@@ -116,4 +118,14 @@ void ImageResponseObserverCoordinator::nativeImageResponseFailed(
   }
 }
 
+void ImageResponseObserverCoordinator::setPriority(
+    ImageRequestPriority priority) const {
+  changeRequestPriority_(priority);
+}
+
+ImageResponse::Status ImageResponseObserverCoordinator::getStatus() const {
+  std::scoped_lock lock(mutex_);
+  return status_;
+}
+
 } // namespace facebook::react
@@ -9,6 +9,7 @@
 
 #include <react/renderer/imagemanager/ImageResponse.h>
 #include <react/renderer/imagemanager/ImageResponseObserver.h>
+#include <react/renderer/imagemanager/primitives.h>
 #include <react/utils/SharedFunction.h>
 
 #include <mutex>
@@ -26,7 +27,8 @@ class ImageResponseObserverCoordinator {
  public:
   ImageResponseObserverCoordinator(
       SharedFunction<> resumeFunction,
-      SharedFunction<> cancelationFunction);
+      SharedFunction<> cancelationFunction,
+      SharedFunction<ImageRequestPriority> priorityChangeFunction = {});
 
   /*
    * Interested parties may observe the image response.
@@ -60,6 +62,17 @@ class ImageResponseObserverCoordinator {
    */
   void nativeImageResponseFailed(const ImageLoadError& loadError) const;
 
+  /*
+   * Layout-driven visibility hints call this when the image moves relative to
+   * the viewport. Loaders which don't prioritize requests ignore it.
+   */
+  void setPriority(ImageRequestPriority priority) const;
+
+  /*
+   * Returns the current status of image loading.
+   */
+  ImageResponse::Status getStatus() const;
+
  private:
   /*
    * List of observers.
@@ -105,6 +118,11 @@ class ImageResponseObserverCoordinator {
    * Function we can call to cancel image request.
    */
   SharedFunction<> cancelRequest_;
+
+  /*
+   * Function we can call to change the priority of image request.
+   */
+  SharedFunction<ImageRequestPriority> changeRequestPriority_;
 };
 
 } // namespace facebook::react
@@ -17,4 +17,22 @@ TelemetryTimePoint ImageTelemetry::getWillRequestUrlTime() const {
   return willRequestUrlTime_;
 }
 
+void ImageTelemetry::willStartLoad() const {
+  auto expected = kTelemetryUndefinedTimePoint;
+  willStartLoadTime_.compare_exchange_strong(
+      expected, telemetryTimePointNow());
+}
+
+TelemetryTimePoint ImageTelemetry::getWillStartLoadTime() const {
+  return willStartLoadTime_;
+}
+
+TelemetryDuration ImageTelemetry::getQueueWaitDuration() const {
+  auto willStartLoadTime = getWillStartLoadTime();
+  if (willStartLoadTime == kTelemetryUndefinedTimePoint) {
+    return {};
+  }
+  return willStartLoadTime - willRequestUrlTime_;
+}
+
 } // namespace facebook::react
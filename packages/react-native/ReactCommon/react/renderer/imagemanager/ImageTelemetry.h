@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/utils/Telemetry.h>
 
@@ -24,11 +26,31 @@ class ImageTelemetry final {
 
   TelemetryTimePoint getWillRequestUrlTime() const;
 
+  /*
+   * Called when loading of the image actually starts, which may be later than
+   * the request if requests are queued. Only the first call is recorded.
+   * Can be called from any thread.
+   */
+  void willStartLoad() const;
+
+  /*
+   * Returns `kTelemetryUndefinedTimePoint` if loading hasn't started yet.
+   */
+  TelemetryTimePoint getWillStartLoadTime() const;
+
+  /*
+   * Time the request spent waiting in a queue before loading started.
+   */
+  TelemetryDuration getQueueWaitDuration() const;
+
   SurfaceId getSurfaceId() const;
 
  private:
   TelemetryTimePoint willRequestUrlTime_;
 
+  mutable std::atomic<TelemetryTimePoint> willStartLoadTime_{
+      kTelemetryUndefinedTimePoint};
+
   const SurfaceId surfaceId_;
 };
 
@@ -36,8 +36,13 @@ ImageRequest ImageManager::requestImage(
     return ((ImageFetcher*)self_)
         ->requestImage(imageSource, imageRequestParams, surfaceId, tag);
   } else {
-    return {imageSource, nullptr, {}};
+    return {imageSource, nullptr};
   }
 }
 
+std::optional<ImageMetadata> ImageManager::getImageMetadata(
+    const ImageSource& /*imageSource*/) const {
+  return std::nullopt;
+}
+
 } // namespace facebook::react
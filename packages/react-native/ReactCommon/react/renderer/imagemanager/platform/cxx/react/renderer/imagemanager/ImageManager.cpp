@@ -7,17 +7,33 @@
 
 #include "ImageManager.h"
 
+#include <react/renderer/imagemanager/ImageRequestRegistry.h>
+#include <react/renderer/imagemanager/ImageRequestScheduler.h>
+
 namespace facebook::react {
 
+namespace {
+
+struct ImageManagerState {
+  ImageRequestRegistry registry{};
+  std::shared_ptr<ImageRequestScheduler> scheduler =
+      std::make_shared<ImageRequestScheduler>(
+          [](const ImageSource& /*imageSource*/,
+             const std::weak_ptr<const ImageResponseObserverCoordinator>&
+             /*coordinator*/) {
+            // Loading is not implemented.
+            return SharedFunction<>{};
+          });
+};
+
+} // namespace
+
 ImageManager::ImageManager(
-    const ContextContainer::Shared& /*contextContainer*/) {
-  // Silence unused-private-field warning.
-  (void)self_;
-  // Not implemented.
-}
+    const ContextContainer::Shared& /*contextContainer*/)
+    : self_(new ImageManagerState()) {}
 
 ImageManager::~ImageManager() {
-  // Not implemented.
+  delete static_cast<ImageManagerState*>(self_);
 }
 
 ImageRequest ImageManager::requestImage(
@@ -28,11 +44,21 @@ ImageRequest ImageManager::requestImage(
 
 ImageRequest ImageManager::requestImage(
     const ImageSource& imageSource,
-    SurfaceId /*surfaceId*/,
+    SurfaceId surfaceId,
     const ImageRequestParams& /*imageRequestParams*/,
     Tag /*tag*/) const {
-  // Not implemented.
-  return {imageSource, nullptr, {}};
+  auto& state = *static_cast<ImageManagerState*>(self_);
+  auto telemetry = std::make_shared<const ImageTelemetry>(surfaceId);
+  return state.registry.requestImage(
+      imageSource, telemetry, [&](const ImageSource& normalizedImageSource) {
+        return state.scheduler->requestImage(normalizedImageSource, telemetry);
+      });
+}
+
+std::optional<ImageMetadata> ImageManager::getImageMetadata(
+    const ImageSource& imageSource) const {
+  return static_cast<ImageManagerState*>(self_)->registry.getImageMetadata(
+      imageSource);
 }
 
 } // namespace facebook::react
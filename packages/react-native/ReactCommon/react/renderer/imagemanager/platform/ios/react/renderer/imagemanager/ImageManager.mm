@@ -49,4 +49,9 @@ ImageRequest ImageManager::requestImage(
   return [imageManager requestImage:imageSource surfaceId:surfaceId];
 }
 
+std::optional<ImageMetadata> ImageManager::getImageMetadata(const ImageSource & /*imageSource*/) const
+{
+  return std::nullopt;
+}
+
 } // namespace facebook::react
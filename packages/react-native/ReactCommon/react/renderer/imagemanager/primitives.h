@@ -57,4 +57,46 @@ class ImageErrorInfo {
   std::vector<std::pair<std::string, std::string>> httpResponseHeaders{};
 };
 
+/*
+ * How urgently an image is needed, based on where it is relative to the
+ * viewport. Ordered from the most to the least urgent.
+ */
+enum class ImageRequestPriority {
+  // The image intersects the viewport.
+  Visible,
+  // No visibility information is known yet (e.g. the image was just laid
+  // out for the first time).
+  Default,
+  // The image is outside of the viewport, but close enough to become visible
+  // soon.
+  NearViewport,
+  // The image is far from the viewport; it's not worth loading it now.
+  Offscreen,
+};
+
+/*
+ * Information about a loaded image which doesn't require the image itself.
+ */
+class ImageMetadata {
+ public:
+  /*
+   * Size of the image, in points.
+   */
+  Size intrinsicSize{};
+
+  /*
+   * Key of the decoded image in the platform image cache.
+   */
+  std::string cacheKey{};
+
+  bool operator==(const ImageMetadata& rhs) const {
+    return std::tie(this->intrinsicSize, this->cacheKey) ==
+        std::tie(rhs.intrinsicSize, rhs.cacheKey);
+  }
+
+  bool operator!=(const ImageMetadata& rhs) const {
+    return !(*this == rhs);
+  }
+};
+
 } // namespace facebook::react
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImageRequestRegistry.h>
+
+using namespace facebook::react;
+
+namespace {
+
+ImageSource makeImageSource(const std::string& uri, Float size) {
+  auto imageSource = ImageSource{ImageSource::Type::Remote, uri};
+  imageSource.size = {size, size};
+  imageSource.scale = 2;
+  return imageSource;
+}
+
+class CountingLoader {
+ public:
+  ImageRequestRegistry::StartRequestFunction startRequestFunction() {
+    return [this](const ImageSource& imageSource) {
+      startedImageSources.push_back(imageSource);
+      return ImageRequest{imageSource, nullptr};
+    };
+  }
+
+  std::vector<ImageSource> startedImageSources;
+};
+
+} // namespace
+
+TEST(ImageRequestRegistryTest, testCoalescesEquivalentRequests) {
+  auto registry = ImageRequestRegistry{};
+  auto loader = CountingLoader{};
+
+  auto first = registry.requestImage(
+      makeImageSource("https://reactnative.dev/a.png", 40),
+      nullptr,
+      loader.startRequestFunction());
+  auto second = registry.requestImage(
+      makeImageSource("https://reactnative.dev/a.png", 50),
+      nullptr,
+      loader.startRequestFunction());
+  auto other = registry.requestImage(
+      makeImageSource("https://reactnative.dev/b.png", 40),
+      nullptr,
+      loader.startRequestFunction());
+
+  EXPECT_EQ(loader.startedImageSources.size(), 2);
+  EXPECT_EQ(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  EXPECT_NE(
+      first.getSharedObserverCoordinator(),
+      other.getSharedObserverCoordinator());
+  EXPECT_EQ(second.getImageSource().size, (Size{50, 50}));
+
+  // The load is started for the upper bound of the size bucket.
+  EXPECT_EQ(loader.startedImageSources[0].size, (Size{64, 64}));
+
+  auto metrics = registry.getMetrics();
+  EXPECT_EQ(metrics.requestCount, 3);
+  EXPECT_EQ(metrics.coalescedRequestCount, 1);
+}
+
+TEST(ImageRequestRegistryTest, testDoesNotCoalesceDifferentSizeBuckets) {
+  auto registry = ImageRequestRegistry{};
+  auto loader = CountingLoader{};
+
+  auto small = registry.requestImage(
+      makeImageSource("https://reactnative.dev/a.png", 40),
+      nullptr,
+      loader.startRequestFunction());
+  auto large = registry.requestImage(
+      makeImageSource("https://reactnative.dev/a.png", 200),
+      nullptr,
+      loader.startRequestFunction());
+
+  EXPECT_EQ(loader.startedImageSources.size(), 2);
+  EXPECT_NE(
+      ImageRequestRegistry::getSizeBucket(small.getImageSource()),
+      ImageRequestRegistry::getSizeBucket(large.getImageSource()));
+}
+
+TEST(ImageRequestRegistryTest, testRestartsReleasedAndFailedRequests) {
+  auto registry = ImageRequestRegistry{};
+  auto loader = CountingLoader{};
+  auto imageSource = makeImageSource("https://reactnative.dev/a.png", 40);
+
+  {
+    auto released = registry.requestImage(
+        imageSource, nullptr, loader.startRequestFunction());
+  }
+  auto failed = registry.requestImage(
+      imageSource, nullptr, loader.startRequestFunction());
+  failed.getObserverCoordinator().nativeImageResponseFailed(
+      ImageLoadError{nullptr});
+  auto retried = registry.requestImage(
+      imageSource, nullptr, loader.startRequestFunction());
+
+  EXPECT_EQ(loader.startedImageSources.size(), 3);
+  EXPECT_EQ(registry.getMetrics().coalescedRequestCount, 0);
+}
+
+TEST(ImageRequestRegistryTest, testSharedRequestNotifiesAllObservers) {
+  class Observer : public ImageResponseObserver {
+   public:
+    void didReceiveProgress(float, int64_t, int64_t) const override {}
+    void didReceiveImage(const ImageResponse&) const override {
+      imageCount++;
+    }
+    void didReceiveFailure(const ImageLoadError&) const override {}
+
+    mutable int imageCount{0};
+  };
+
+  auto registry = ImageRequestRegistry{};
+  auto loader = CountingLoader{};
+  auto imageSource = makeImageSource("https://reactnative.dev/a.png", 40);
+
+  auto first = registry.requestImage(
+      imageSource, nullptr, loader.startRequestFunction());
+  auto second = registry.requestImage(
+      imageSource, nullptr, loader.startRequestFunction());
+
+  auto firstObserver = Observer{};
+  auto secondObserver = Observer{};
+  auto thirdObserver = Observer{};
+  first.getObserverCoordinator().addObserver(firstObserver);
+  second.getObserverCoordinator().addObserver(secondObserver);
+  second.getObserverCoordinator().addObserver(thirdObserver);
+  // Removing one observer keeps the others subscribed.
+  first.getObserverCoordinator().removeObserver(firstObserver);
+
+  first.getObserverCoordinator().nativeImageResponseComplete(
+      ImageResponse{nullptr, nullptr});
+
+  EXPECT_EQ(firstObserver.imageCount, 0);
+  EXPECT_EQ(secondObserver.imageCount, 1);
+  EXPECT_EQ(thirdObserver.imageCount, 1);
+}
+
+TEST(ImageRequestRegistryTest, testImageMetadata) {
+  auto registry = ImageRequestRegistry{};
+  auto a = makeImageSource("https://reactnative.dev/a.png", 40);
+  auto b = makeImageSource("https://reactnative.dev/b.png", 40);
+
+  EXPECT_FALSE(registry.getImageMetadata(a).has_value());
+
+  registry.recordImageMetadata(a, {{120, 80}, "a@240x160"});
+
+  // Metadata doesn't depend on the requested size.
+  auto resized = makeImageSource("https://reactnative.dev/a.png", 400);
+  EXPECT_EQ(
+      registry.getImageMetadata(resized),
+      (ImageMetadata{{120, 80}, "a@240x160"}));
+  EXPECT_FALSE(registry.getImageMetadata(b).has_value());
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImageRequestScheduler.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class FakeLoader {
+ public:
+  struct Load {
+    std::string uri;
+    std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+    std::shared_ptr<bool> cancelled;
+  };
+
+  ImageRequestScheduler::StartLoadFunction startLoadFunction() {
+    return [this](
+               const ImageSource& imageSource,
+               const std::weak_ptr<const ImageResponseObserverCoordinator>&
+                   coordinator) {
+      auto cancelled = std::make_shared<bool>(false);
+      loads.push_back({imageSource.uri, coordinator, cancelled});
+      return SharedFunction<>{[cancelled]() { *cancelled = true; }};
+    };
+  }
+
+  std::vector<std::string> getStartedUris() const {
+    auto uris = std::vector<std::string>{};
+    for (const auto& load : loads) {
+      uris.push_back(load.uri);
+    }
+    return uris;
+  }
+
+  void complete(size_t index) {
+    if (auto coordinator = loads[index].coordinator.lock()) {
+      coordinator->nativeImageResponseComplete(ImageResponse{nullptr, nullptr});
+    }
+  }
+
+  std::vector<Load> loads;
+};
+
+ImageSource makeImageSource(const std::string& uri) {
+  return ImageSource{ImageSource::Type::Remote, uri};
+}
+
+} // namespace
+
+TEST(ImageRequestSchedulerTest, testThrottlesAndOrdersByPriority) {
+  auto loader = FakeLoader{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      loader.startLoadFunction(), /* maxConcurrentLoadCount */ 2);
+
+  auto a = scheduler->requestImage(makeImageSource("a"), nullptr);
+  auto b = scheduler->requestImage(makeImageSource("b"), nullptr);
+  auto c = scheduler->requestImage(makeImageSource("c"), nullptr);
+  auto d = scheduler->requestImage(makeImageSource("d"), nullptr);
+
+  EXPECT_EQ(loader.getStartedUris(), (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(scheduler->getMetrics().queuedRequestCount, 2);
+
+  d.getObserverCoordinator().setPriority(ImageRequestPriority::Visible);
+  loader.complete(0);
+
+  EXPECT_EQ(
+      loader.getStartedUris(), (std::vector<std::string>{"a", "b", "d"}));
+
+  loader.complete(1);
+  loader.complete(2);
+
+  EXPECT_EQ(
+      loader.getStartedUris(),
+      (std::vector<std::string>{"a", "b", "d", "c"}));
+  EXPECT_EQ(scheduler->getMetrics().runningLoadCount, 1);
+}
+
+TEST(ImageRequestSchedulerTest, testPreCancelsOffscreenRequests) {
+  auto loader = FakeLoader{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      loader.startLoadFunction(), /* maxConcurrentLoadCount */ 1);
+
+  auto a = scheduler->requestImage(makeImageSource("a"), nullptr);
+  auto b = scheduler->requestImage(makeImageSource("b"), nullptr);
+  b.getObserverCoordinator().setPriority(ImageRequestPriority::Offscreen);
+
+  // `a` scrolls away; `b` is far away as well, so nothing starts.
+  a.getObserverCoordinator().setPriority(ImageRequestPriority::Offscreen);
+
+  EXPECT_TRUE(*loader.loads[0].cancelled);
+  EXPECT_EQ(loader.getStartedUris(), (std::vector<std::string>{"a"}));
+  EXPECT_EQ(scheduler->getMetrics().runningLoadCount, 0);
+  EXPECT_EQ(scheduler->getMetrics().cancelledLoadCount, 1);
+
+  // `b` scrolls in.
+  b.getObserverCoordinator().setPriority(ImageRequestPriority::NearViewport);
+
+  EXPECT_EQ(loader.getStartedUris(), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(ImageRequestSchedulerTest, testCancelsLoadsCancelledWhileStarting) {
+  auto cancelledUris = std::make_shared<std::vector<std::string>>();
+  auto a = std::optional<ImageRequest>{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      [&a, cancelledUris](
+          const ImageSource& imageSource,
+          const std::weak_ptr<const ImageResponseObserverCoordinator>&
+          /*coordinator*/) {
+        if (imageSource.uri == "a") {
+          // Like another thread moving the image off-screen while its load
+          // is being started.
+          a->getObserverCoordinator().setPriority(
+              ImageRequestPriority::Offscreen);
+        }
+        return SharedFunction<>{[cancelledUris, uri = imageSource.uri]() {
+          cancelledUris->push_back(uri);
+        }};
+      },
+      /* maxConcurrentLoadCount */ 1);
+
+  auto blocker = std::optional<ImageRequest>{
+      scheduler->requestImage(makeImageSource("blocker"), nullptr)};
+  a.emplace(scheduler->requestImage(makeImageSource("a"), nullptr));
+  blocker.reset();
+  // Starts `a` in place of the released request.
+  a->getObserverCoordinator().setPriority(ImageRequestPriority::Visible);
+
+  EXPECT_EQ(*cancelledUris, (std::vector<std::string>{"blocker", "a"}));
+  EXPECT_EQ(scheduler->getMetrics().runningLoadCount, 0);
+
+  // Releasing the request doesn't cancel its load again.
+  a.reset();
+  auto b = scheduler->requestImage(makeImageSource("b"), nullptr);
+
+  EXPECT_EQ(*cancelledUris, (std::vector<std::string>{"blocker", "a"}));
+}
+
+TEST(ImageRequestSchedulerTest, testReleasedRequestsFreeTheirSlots) {
+  auto loader = FakeLoader{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      loader.startLoadFunction(), /* maxConcurrentLoadCount */ 1);
+
+  {
+    auto a = scheduler->requestImage(makeImageSource("a"), nullptr);
+  }
+  auto b = scheduler->requestImage(makeImageSource("b"), nullptr);
+
+  EXPECT_TRUE(*loader.loads[0].cancelled);
+  EXPECT_EQ(loader.getStartedUris(), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(ImageRequestSchedulerTest, testRecordsQueueWaitTime) {
+  auto loader = FakeLoader{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      loader.startLoadFunction(), /* maxConcurrentLoadCount */ 1);
+
+  auto a = scheduler->requestImage(
+      makeImageSource("a"), std::make_shared<const ImageTelemetry>(1));
+  auto b = scheduler->requestImage(
+      makeImageSource("b"), std::make_shared<const ImageTelemetry>(1));
+
+  EXPECT_NE(
+      a.getSharedTelemetry()->getWillStartLoadTime(),
+      kTelemetryUndefinedTimePoint);
+  EXPECT_EQ(
+      b.getSharedTelemetry()->getWillStartLoadTime(),
+      kTelemetryUndefinedTimePoint);
+
+  loader.complete(0);
+
+  EXPECT_GE(
+      b.getSharedTelemetry()->getWillStartLoadTime(),
+      b.getSharedTelemetry()->getWillRequestUrlTime());
+  EXPECT_GE(
+      b.getSharedTelemetry()->getQueueWaitDuration(), TelemetryDuration{0});
+}
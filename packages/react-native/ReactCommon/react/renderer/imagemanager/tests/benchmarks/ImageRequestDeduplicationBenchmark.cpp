@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/imagemanager/ImageRequestRegistry.h>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// A feed where every row shows the avatar of its author and a photo.
+constexpr auto kRowCount = 1000;
+constexpr auto kAuthorCount = 50;
+
+std::vector<ImageSource> makeFeedImageSources() {
+  auto imageSources = std::vector<ImageSource>{};
+  for (int i = 0; i < kRowCount; i++) {
+    auto avatar = ImageSource{
+        ImageSource::Type::Remote,
+        "https://reactnative.dev/avatars/" +
+            std::to_string(i * i % kAuthorCount) + ".png"};
+    // Avatars have slightly different sizes in different row layouts.
+    avatar.size = {static_cast<Float>(32 + i % 3 * 4), 40};
+    imageSources.push_back(avatar);
+
+    auto photo = ImageSource{
+        ImageSource::Type::Remote,
+        "https://reactnative.dev/photos/" + std::to_string(i) + ".jpg"};
+    photo.size = {320, 240};
+    imageSources.push_back(photo);
+  }
+  return imageSources;
+}
+
+auto feedImageSources = makeFeedImageSources();
+
+/*
+ * Every request starts its own load, as the platform image managers do.
+ */
+static void requestFeedImagesWithoutRegistry(benchmark::State& state) {
+  auto loadCount = size_t{0};
+  for (auto _ : state) {
+    auto imageRequests = std::vector<ImageRequest>{};
+    for (const auto& imageSource : feedImageSources) {
+      loadCount++;
+      imageRequests.push_back(ImageRequest{imageSource, nullptr});
+    }
+    benchmark::DoNotOptimize(imageRequests);
+  }
+  state.counters["loadsPerFeed"] =
+      static_cast<double>(loadCount) / state.iterations();
+}
+BENCHMARK(requestFeedImagesWithoutRegistry);
+
+static void requestFeedImagesWithRegistry(benchmark::State& state) {
+  auto loadCount = size_t{0};
+  auto startRequest = [&](const ImageSource& imageSource) {
+    loadCount++;
+    return ImageRequest{imageSource, nullptr};
+  };
+
+  auto metrics = ImageRequestRegistry::Metrics{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto registry = ImageRequestRegistry{};
+    state.ResumeTiming();
+
+    auto imageRequests = std::vector<ImageRequest>{};
+    for (const auto& imageSource : feedImageSources) {
+      imageRequests.push_back(
+          registry.requestImage(imageSource, nullptr, startRequest));
+    }
+    benchmark::DoNotOptimize(imageRequests);
+
+    metrics = registry.getMetrics();
+  }
+  state.counters["loadsPerFeed"] =
+      static_cast<double>(loadCount) / state.iterations();
+  state.counters["duplicateRate"] =
+      static_cast<double>(metrics.coalescedRequestCount) /
+      metrics.requestCount;
+}
+BENCHMARK(requestFeedImagesWithRegistry);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/imagemanager/ImageRequestScheduler.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Simulates a fast fling through a list with an image in every row, frame
+ * by frame. Every load takes the same number of frames once started.
+ */
+constexpr auto kRowCount = 300;
+constexpr auto kRowHeight = 100;
+constexpr auto kViewportHeight = 800;
+constexpr auto kScrollDistance = 100 * kRowHeight;
+constexpr auto kScrollSpeedPerFrame = 300;
+constexpr auto kLoadDurationInFrames = 6;
+constexpr auto kMaxFrameCount = 1000;
+
+struct Load {
+  std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+  int finishFrame;
+  std::shared_ptr<bool> cancelled;
+};
+
+/*
+ * Stands for the view showing the image.
+ */
+class ImageView : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(float, int64_t, int64_t) const override {}
+  void didReceiveImage(const ImageResponse&) const override {
+    loaded = true;
+  }
+  void didReceiveFailure(const ImageLoadError&) const override {}
+
+  mutable bool loaded{false};
+};
+
+struct SimulationResult {
+  double averageTimeToVisibleImage;
+  size_t startedLoadCount;
+};
+
+SimulationResult simulateFling(bool deliverVisibilityHints) {
+  auto frame = 0;
+  auto loads = std::vector<Load>{};
+  auto scheduler = std::make_shared<ImageRequestScheduler>(
+      [&](const ImageSource& /*imageSource*/,
+          const std::weak_ptr<const ImageResponseObserverCoordinator>&
+              coordinator) {
+        auto cancelled = std::make_shared<bool>(false);
+        loads.push_back(
+            {coordinator, frame + kLoadDurationInFrames, cancelled});
+        return SharedFunction<>{[cancelled]() { *cancelled = true; }};
+      });
+
+  auto imageRequests = std::vector<ImageRequest>{};
+  auto imageViews = std::vector<ImageView>(kRowCount);
+  for (int i = 0; i < kRowCount; i++) {
+    imageRequests.push_back(scheduler->requestImage(
+        {ImageSource::Type::Remote,
+         "https://reactnative.dev/photos/" + std::to_string(i) + ".jpg"},
+        nullptr));
+    imageRequests.back().getObserverCoordinator().addObserver(imageViews[i]);
+  }
+
+  // Frame at which every row became visible for the last time, or `-1` if
+  // the row isn't visible or its image was already counted.
+  auto visibleSinceFrame = std::vector<int>(kRowCount, -1);
+  auto wasVisible = std::vector<bool>(kRowCount, false);
+  auto timeToVisibleImageSum = 0;
+  auto visibleImageCount = 0;
+  auto scrollOffset = 0;
+
+  for (; frame < kMaxFrameCount; frame++) {
+    scrollOffset =
+        std::min(scrollOffset + kScrollSpeedPerFrame, kScrollDistance);
+
+    auto pendingLoads = std::vector<Load>{};
+    std::swap(pendingLoads, loads);
+    for (auto& load : pendingLoads) {
+      if (*load.cancelled) {
+        continue;
+      }
+      if (load.finishFrame > frame) {
+        loads.push_back(std::move(load));
+        continue;
+      }
+      if (auto coordinator = load.coordinator.lock()) {
+        coordinator->nativeImageResponseComplete({nullptr, nullptr});
+      }
+    }
+
+    auto allVisibleImagesLoaded = scrollOffset == kScrollDistance;
+    for (int i = 0; i < kRowCount; i++) {
+      auto top = i * kRowHeight - scrollOffset;
+      auto visible = top < kViewportHeight && top + kRowHeight > 0;
+      if (visible && !wasVisible[i]) {
+        visibleSinceFrame[i] = frame;
+      } else if (!visible) {
+        visibleSinceFrame[i] = -1;
+      }
+      wasVisible[i] = visible;
+
+      if (visibleSinceFrame[i] >= 0 && imageViews[i].loaded) {
+        timeToVisibleImageSum += frame - visibleSinceFrame[i];
+        visibleImageCount++;
+        visibleSinceFrame[i] = -1;
+      }
+      if (visible && !imageViews[i].loaded) {
+        allVisibleImagesLoaded = false;
+      }
+
+      if (deliverVisibilityHints) {
+        // What `ImageVisibilityMountHook` reports after every frame.
+        auto priority = ImageRequestPriority::Visible;
+        if (!visible) {
+          auto distance = top >= kViewportHeight ? top - kViewportHeight
+                                                 : -(top + kRowHeight);
+          priority = distance < kViewportHeight
+              ? ImageRequestPriority::NearViewport
+              : ImageRequestPriority::Offscreen;
+        }
+        imageRequests[i].getObserverCoordinator().setPriority(priority);
+      }
+    }
+
+    if (allVisibleImagesLoaded) {
+      break;
+    }
+  }
+
+  return {
+      static_cast<double>(timeToVisibleImageSum) /
+          std::max(visibleImageCount, 1),
+      scheduler->getMetrics().startedLoadCount};
+}
+
+static void flingWithoutVisibilityHints(benchmark::State& state) {
+  auto result = SimulationResult{};
+  for (auto _ : state) {
+    result = simulateFling(/* deliverVisibilityHints */ false);
+  }
+  state.counters["timeToVisibleImageInFrames"] =
+      result.averageTimeToVisibleImage;
+  state.counters["startedLoads"] = static_cast<double>(result.startedLoadCount);
+}
+BENCHMARK(flingWithoutVisibilityHints);
+
+static void flingWithVisibilityHints(benchmark::State& state) {
+  auto result = SimulationResult{};
+  for (auto _ : state) {
+    result = simulateFling(/* deliverVisibilityHints */ true);
+  }
+  state.counters["timeToVisibleImageInFrames"] =
+      result.averageTimeToVisibleImage;
+  state.counters["startedLoads"] = static_cast<double>(result.startedLoadCount);
+}
+BENCHMARK(flingWithVisibilityHints);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
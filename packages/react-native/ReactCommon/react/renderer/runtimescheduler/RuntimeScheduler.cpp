@@ -126,4 +126,18 @@ void RuntimeScheduler::setEventTimingDelegate(
   return runtimeSchedulerImpl_->setEventTimingDelegate(eventTimingDelegate);
 }
 
+void RuntimeScheduler::setFrameYieldBudget(RuntimeSchedulerDuration budget) {
+  return runtimeSchedulerImpl_->setFrameYieldBudget(budget);
+}
+
+void RuntimeScheduler::didReceiveVsync(
+    RuntimeSchedulerTimePoint vsyncTime,
+    RuntimeSchedulerDuration frameInterval) noexcept {
+  return runtimeSchedulerImpl_->didReceiveVsync(vsyncTime, frameInterval);
+}
+
+RuntimeSchedulerTimePoint RuntimeScheduler::getIdleDeadline() noexcept {
+  return runtimeSchedulerImpl_->getIdleDeadline();
+}
+
 } // namespace facebook::react
@@ -28,6 +28,12 @@ using RuntimeSchedulerTaskErrorHandler =
 // (and use them interchangeably).
 class RuntimeSchedulerBase {
  public:
+  /*
+   * Longest idle period, as recommended by the `requestIdleCallback` spec to
+   * keep the app responsive to user input arriving while idle.
+   */
+  static constexpr auto kMaxIdlePeriod = std::chrono::milliseconds(50);
+
   virtual ~RuntimeSchedulerBase() = default;
   virtual void scheduleWork(RawCallback&& callback) noexcept = 0;
   virtual void executeNowOnTheSameThread(RawCallback&& callback) = 0;
@@ -59,6 +65,11 @@ class RuntimeSchedulerBase {
       PerformanceEntryReporter* reporter) = 0;
   virtual void setEventTimingDelegate(
       RuntimeSchedulerEventTimingDelegate* eventTimingDelegate) = 0;
+  virtual void setFrameYieldBudget(RuntimeSchedulerDuration budget) = 0;
+  virtual void didReceiveVsync(
+      RuntimeSchedulerTimePoint vsyncTime,
+      RuntimeSchedulerDuration frameInterval) noexcept = 0;
+  virtual RuntimeSchedulerTimePoint getIdleDeadline() noexcept = 0;
 };
 
 // This is a proxy for RuntimeScheduler implementation, which will be selected
@@ -172,6 +183,30 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
   void setEventTimingDelegate(
       RuntimeSchedulerEventTimingDelegate* eventTimingDelegate) override;
 
+  /*
+   * Sets how long before the next frame deadline tasks are asked to yield,
+   * leaving that time to update the rendering.
+   */
+  void setFrameYieldBudget(RuntimeSchedulerDuration budget) override;
+
+  /*
+   * Tells the scheduler that the host platform started a frame at
+   * `vsyncTime`, and expects the next one `frameInterval` later.
+   *
+   * Can be called from any thread.
+   */
+  void didReceiveVsync(
+      RuntimeSchedulerTimePoint vsyncTime,
+      RuntimeSchedulerDuration frameInterval) noexcept override;
+
+  /*
+   * Returns the end of the current idle period, or the current time if the
+   * runtime isn't idle. Designed to be called from idle tasks.
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  RuntimeSchedulerTimePoint getIdleDeadline() noexcept override;
+
  private:
   // Actual implementation, stored as a unique pointer to simplify memory
   // management.
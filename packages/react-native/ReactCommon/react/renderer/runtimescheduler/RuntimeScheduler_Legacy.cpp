@@ -204,6 +204,21 @@ void RuntimeScheduler_Legacy::setEventTimingDelegate(
   // No-op in the legacy scheduler
 }
 
+void RuntimeScheduler_Legacy::setFrameYieldBudget(
+    RuntimeSchedulerDuration /*budget*/) {
+  // No-op in the legacy scheduler
+}
+
+void RuntimeScheduler_Legacy::didReceiveVsync(
+    RuntimeSchedulerTimePoint /*vsyncTime*/,
+    RuntimeSchedulerDuration /*frameInterval*/) noexcept {
+  // No-op in the legacy scheduler
+}
+
+RuntimeSchedulerTimePoint RuntimeScheduler_Legacy::getIdleDeadline() noexcept {
+  return now_() + kMaxIdlePeriod;
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Legacy::scheduleWorkLoopIfNecessary() {
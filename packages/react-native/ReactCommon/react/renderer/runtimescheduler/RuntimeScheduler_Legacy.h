@@ -135,6 +135,18 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
   void setEventTimingDelegate(
       RuntimeSchedulerEventTimingDelegate* eventTimingDelegate) override;
 
+  void setFrameYieldBudget(RuntimeSchedulerDuration budget) override;
+
+  void didReceiveVsync(
+      RuntimeSchedulerTimePoint vsyncTime,
+      RuntimeSchedulerDuration frameInterval) noexcept override;
+
+  /*
+   * The legacy scheduler doesn't track idleness, so every idle period lasts
+   * `kMaxIdlePeriod`.
+   */
+  RuntimeSchedulerTimePoint getIdleDeadline() noexcept override;
+
  private:
   std::priority_queue<
       std::shared_ptr<Task>,
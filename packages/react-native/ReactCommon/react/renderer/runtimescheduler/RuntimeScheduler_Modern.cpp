@@ -13,6 +13,7 @@
 #include <react/renderer/consistency/ScopedShadowTreeRevisionLock.h>
 #include <react/timing/primitives.h>
 #include <react/utils/OnScopeExit.h>
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
@@ -128,11 +129,21 @@ bool RuntimeScheduler_Modern::getShouldYield() noexcept {
   }
 
   return syncTaskRequests_ > 0 ||
-      (!taskQueue_.empty() && taskQueue_.top().get() != currentTask_);
+      (!taskQueue_.empty() && taskQueue_.top().get() != currentTask_) ||
+      (frameInterval_ != RuntimeSchedulerDuration::zero() &&
+       isFrameYieldDue(now_()));
 }
 
 void RuntimeScheduler_Modern::cancelTask(Task& task) noexcept {
   task.callback.reset();
+
+  // Removed right away, so cancelled tasks don't accumulate in the queue.
+  // This may release the last reference to the task. The selected task is
+  // removed by `selectTask` once it ran, unless it returned a continuation.
+  std::unique_lock lock(schedulingMutex_);
+  if (&task != selectedTask_) {
+    taskQueue_.remove(task);
+  }
 }
 
 SchedulerPriority RuntimeScheduler_Modern::getCurrentPriorityLevel()
@@ -223,6 +234,39 @@ void RuntimeScheduler_Modern::setEventTimingDelegate(
   eventTimingDelegate_ = eventTimingDelegate;
 }
 
+void RuntimeScheduler_Modern::setFrameYieldBudget(
+    RuntimeSchedulerDuration budget) {
+  std::unique_lock lock(schedulingMutex_);
+  frameYieldBudget_ = budget;
+}
+
+void RuntimeScheduler_Modern::didReceiveVsync(
+    RuntimeSchedulerTimePoint vsyncTime,
+    RuntimeSchedulerDuration frameInterval) noexcept {
+  std::unique_lock lock(schedulingMutex_);
+  lastVsyncTime_ = vsyncTime;
+  frameInterval_ = frameInterval;
+}
+
+RuntimeSchedulerTimePoint RuntimeScheduler_Modern::getIdleDeadline() noexcept {
+  std::shared_lock lock(schedulingMutex_);
+
+  auto currentTime = now_();
+  if (syncTaskRequests_ > 0 ||
+      (currentTask_ != nullptr &&
+       currentTask_->priority != SchedulerPriority::IdlePriority) ||
+      taskQueue_.size() > taskQueue_.getIdleTaskCount()) {
+    return currentTime;
+  }
+
+  auto deadline = currentTime + kMaxIdlePeriod;
+  if (frameInterval_ != RuntimeSchedulerDuration::zero()) {
+    deadline =
+        std::min(deadline, getFrameDeadline(currentTime) - frameYieldBudget_);
+  }
+  return std::max(deadline, currentTime);
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
@@ -271,7 +315,20 @@ void RuntimeScheduler_Modern::runEventLoop(
     runEventLoopTick(runtime, *topPriorityTask, currentTime);
 
     currentTime = now_();
-    topPriorityTask = selectTask(currentTime, onlyExpired);
+    topPriorityTask =
+        selectTask(currentTime, onlyExpired, topPriorityTask.get());
+
+    // Expired tasks don't wait for the next frame.
+    if (topPriorityTask && topPriorityTask->expirationTime > currentTime &&
+        yieldForFrameIfNeeded(currentTime)) {
+      break;
+    }
+  }
+
+  if (topPriorityTask) {
+    // Selected, but not executed.
+    std::unique_lock lock(schedulingMutex_);
+    selectedTask_ = nullptr;
   }
 
   currentPriority_ = previousPriority;
@@ -279,24 +336,28 @@ void RuntimeScheduler_Modern::runEventLoop(
 
 std::shared_ptr<Task> RuntimeScheduler_Modern::selectTask(
     RuntimeSchedulerTimePoint currentTime,
-    bool onlyExpired) {
+    bool onlyExpired,
+    const Task* executedTask) {
   // We need a unique lock here because we'll also remove executed tasks from
-  // the top of the queue.
+  // the queue.
   std::unique_lock lock(schedulingMutex_);
 
   // It's safe to reset the flag here, as its access is also synchronized with
   // the access to the task queue.
   isEventLoopScheduled_ = false;
 
-  // Skip executed tasks
-  while (!taskQueue_.empty() && !taskQueue_.top()->callback) {
-    taskQueue_.pop();
+  // Tasks which returned a continuation stay in the queue.
+  if (executedTask != nullptr && !executedTask->callback) {
+    taskQueue_.remove(*executedTask);
   }
 
+  selectedTask_ = nullptr;
+
   if (!taskQueue_.empty()) {
     auto task = taskQueue_.top();
     auto didUserCallbackTimeout = task->expirationTime <= currentTime;
     if (!onlyExpired || didUserCallbackTimeout) {
+      selectedTask_ = task.get();
       return task;
     }
   }
@@ -316,6 +377,15 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   currentTask_ = &task;
   currentPriority_ = task.priority;
 
+  // Deadline of the frame the rendering updates of this task are meant for.
+  auto frameDeadline = RuntimeSchedulerTimePoint::max();
+  auto frameInterval = RuntimeSchedulerDuration::zero();
+  if (performanceEntryReporter_ != nullptr) {
+    std::shared_lock lock(schedulingMutex_);
+    frameDeadline = getFrameDeadline(taskStartTime);
+    frameInterval = frameInterval_;
+  }
+
   if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
     lastYieldingOpportunity_ = taskStartTime;
     longestPeriodWithoutYieldingOpportunity_ =
@@ -335,8 +405,13 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   }
 
   // "Update the rendering" step.
+  auto hasPendingRenderingUpdates = !pendingRenderingUpdates_.empty();
   updateRendering();
 
+  if (hasPendingRenderingUpdates) {
+    reportDroppedFrames(frameDeadline, frameInterval, now_());
+  }
+
   currentTask_ = nullptr;
 }
 
@@ -463,4 +538,79 @@ void RuntimeScheduler_Modern::markYieldingOpportunity(
   lastYieldingOpportunity_ = currentTime;
 }
 
+RuntimeSchedulerTimePoint RuntimeScheduler_Modern::getFrameDeadline(
+    RuntimeSchedulerTimePoint currentTime) const {
+  if (frameInterval_ == RuntimeSchedulerDuration::zero()) {
+    return RuntimeSchedulerTimePoint::max();
+  }
+
+  auto frameDeadline = lastVsyncTime_ + frameInterval_;
+  if (currentTime >= frameDeadline) {
+    // The next vsync wasn't received yet, so frames are assumed to continue
+    // at the same rate.
+    auto elapsedFrameCount = (currentTime - frameDeadline) / frameInterval_;
+    frameDeadline += (elapsedFrameCount + 1) * frameInterval_;
+  }
+  return frameDeadline;
+}
+
+bool RuntimeScheduler_Modern::isFrameYieldDue(
+    RuntimeSchedulerTimePoint currentTime) const {
+  auto frameDeadline = getFrameDeadline(currentTime);
+  return frameDeadline != RuntimeSchedulerTimePoint::max() &&
+      frameDeadline != yieldedFrameDeadline_ &&
+      currentTime >= frameDeadline - frameYieldBudget_;
+}
+
+bool RuntimeScheduler_Modern::yieldForFrameIfNeeded(
+    RuntimeSchedulerTimePoint currentTime) {
+  bool shouldScheduleEventLoop = false;
+  auto yieldDueTime = RuntimeSchedulerTimePoint{};
+
+  {
+    std::unique_lock lock(schedulingMutex_);
+
+    if (!isFrameYieldDue(currentTime)) {
+      return false;
+    }
+
+    yieldedFrameDeadline_ = getFrameDeadline(currentTime);
+    yieldDueTime = yieldedFrameDeadline_ - frameYieldBudget_;
+
+    // The remaining tasks run after the host had the chance to handle the
+    // frame, unless the event loop was scheduled already.
+    if (!isEventLoopScheduled_) {
+      isEventLoopScheduled_ = true;
+      shouldScheduleEventLoop = true;
+    }
+  }
+
+  if (performanceEntryReporter_ != nullptr) {
+    performanceEntryReporter_->reportFrameYield(
+        chronoToDOMHighResTimeStamp(currentTime - yieldDueTime));
+  }
+
+  if (shouldScheduleEventLoop) {
+    scheduleEventLoop();
+  }
+
+  return true;
+}
+
+void RuntimeScheduler_Modern::reportDroppedFrames(
+    RuntimeSchedulerTimePoint frameDeadline,
+    RuntimeSchedulerDuration frameInterval,
+    RuntimeSchedulerTimePoint renderingTime) {
+  auto reporter = performanceEntryReporter_;
+  if (reporter == nullptr || renderingTime <= frameDeadline) {
+    return;
+  }
+
+  // Every frame deadline passed before the rendering was updated.
+  auto lateness = renderingTime - frameDeadline;
+  auto droppedFrameCount =
+      (lateness + frameInterval - RuntimeSchedulerDuration{1}) / frameInterval;
+  reporter->reportDroppedFrames(static_cast<uint32_t>(droppedFrameCount));
+}
+
 } // namespace facebook::react
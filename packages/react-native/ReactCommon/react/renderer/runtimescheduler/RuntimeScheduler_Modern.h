@@ -12,15 +12,24 @@
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 #include <react/renderer/runtimescheduler/Task.h>
+#include <react/renderer/runtimescheduler/TaskQueue.h>
 #include <atomic>
 #include <memory>
 #include <queue>
 #include <shared_mutex>
+#include <vector>
 
 namespace facebook::react {
 
 class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
  public:
+  /*
+   * Time left before a frame deadline to update the rendering, unless
+   * changed with `setFrameYieldBudget`.
+   */
+  static constexpr auto kDefaultFrameYieldBudget =
+      std::chrono::milliseconds(4);
+
   explicit RuntimeScheduler_Modern(
       RuntimeExecutor runtimeExecutor,
       std::function<RuntimeSchedulerTimePoint()> now,
@@ -152,23 +161,97 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void setEventTimingDelegate(
       RuntimeSchedulerEventTimingDelegate* eventTimingDelegate) override;
 
+  /*
+   * Once the next frame deadline is closer than `budget`, `getShouldYield`
+   * returns true and the event loop yields to the host after the current
+   * task, so the rendering is updated in time for the frame.
+   *
+   * Can be called from any thread.
+   */
+  void setFrameYieldBudget(RuntimeSchedulerDuration budget) override;
+
+  /*
+   * Provides the frame timing of the host platform, usually on every vsync.
+   * Frame deadlines are extrapolated from the last vsync until the next one
+   * is received. Without it, the scheduler doesn't yield for frames.
+   *
+   * Can be called from any thread.
+   */
+  void didReceiveVsync(
+      RuntimeSchedulerTimePoint vsyncTime,
+      RuntimeSchedulerDuration frameInterval) noexcept override;
+
+  /*
+   * The runtime is idle when no task other than idle ones is running or
+   * pending. Idle periods last up to `kMaxIdlePeriod`, and end when the
+   * rendering of the next frame has to start (see `setFrameYieldBudget`).
+   *
+   * Must be called on the JavaScript thread.
+   */
+  RuntimeSchedulerTimePoint getIdleDeadline() noexcept override;
+
  private:
   std::atomic<uint_fast8_t> syncTaskRequests_{0};
 
-  std::priority_queue<
-      std::shared_ptr<Task>,
-      std::vector<std::shared_ptr<Task>>,
-      TaskPriorityComparer>
-      taskQueue_;
+  TaskQueue taskQueue_;
 
   Task* currentTask_{};
+
+  /*
+   * The task selected to run next by the event loop. Cancelling it only
+   * resets its callback and leaves it in the queue, so that it can still
+   * return a continuation if it cancels itself while running, as in the JS
+   * Scheduler. Protected by `schedulingMutex_`.
+   */
+  const Task* selectedTask_{};
   RuntimeSchedulerTimePoint lastYieldingOpportunity_;
   RuntimeSchedulerDuration longestPeriodWithoutYieldingOpportunity_{};
 
   void markYieldingOpportunity(RuntimeSchedulerTimePoint currentTime);
 
+  /*
+   * Frame timing provided by the host platform. `frameInterval_` is zero
+   * until the first vsync is received.
+   */
+  RuntimeSchedulerTimePoint lastVsyncTime_;
+  RuntimeSchedulerDuration frameInterval_{};
+  RuntimeSchedulerDuration frameYieldBudget_{kDefaultFrameYieldBudget};
+
+  /*
+   * Deadline of the last frame the event loop yielded for. Yielding happens
+   * once per frame, so tasks aren't interrupted again right after resuming.
+   */
+  RuntimeSchedulerTimePoint yieldedFrameDeadline_;
+
+  /*
+   * Returns the deadline of the frame in progress at `currentTime`, or the
+   * maximum time point without frame timing.
+   * Must be called with `schedulingMutex_` held.
+   */
+  RuntimeSchedulerTimePoint getFrameDeadline(
+      RuntimeSchedulerTimePoint currentTime) const;
+
+  /*
+   * Returns true if the frame deadline is closer than the yield budget and
+   * the event loop didn't yield for this frame yet.
+   * Must be called with `schedulingMutex_` held.
+   */
+  bool isFrameYieldDue(RuntimeSchedulerTimePoint currentTime) const;
+
+  /*
+   * Lets the host run until the event loop is scheduled again, if
+   * `isFrameYieldDue`. Returns true if the event loop has to stop.
+   */
+  bool yieldForFrameIfNeeded(RuntimeSchedulerTimePoint currentTime);
+
+  void reportDroppedFrames(
+      RuntimeSchedulerTimePoint frameDeadline,
+      RuntimeSchedulerDuration frameInterval,
+      RuntimeSchedulerTimePoint renderingTime);
+
   /**
-   * This protects the access to `taskQueue_` and `isevent loopScheduled_`.
+   * This protects the access to `taskQueue_`, `selectedTask_`,
+   * `isEventLoopScheduled_` and the frame timing.
    */
   mutable std::shared_mutex schedulingMutex_;
 
@@ -178,9 +261,14 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void scheduleEventLoop();
   void runEventLoop(jsi::Runtime& runtime, bool onlyExpired);
 
+  /*
+   * Returns the next task to execute. Removes `executedTask` from the queue
+   * first, unless it returned a continuation.
+   */
   std::shared_ptr<Task> selectTask(
       RuntimeSchedulerTimePoint currentTime,
-      bool onlyExpired);
+      bool onlyExpired,
+      const Task* executedTask = nullptr);
 
   void scheduleTask(std::shared_ptr<Task> task);
 
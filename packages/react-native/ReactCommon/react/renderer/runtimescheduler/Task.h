@@ -11,6 +11,8 @@
 #include <jsi/jsi.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <variant>
 
@@ -19,6 +21,7 @@ namespace facebook::react {
 class RuntimeScheduler_Legacy;
 class RuntimeScheduler_Modern;
 class TaskPriorityComparer;
+class TaskQueue;
 
 using RawCallback = std::function<void(jsi::Runtime&)>;
 
@@ -37,11 +40,19 @@ struct Task final : public jsi::NativeState {
   friend RuntimeScheduler_Legacy;
   friend RuntimeScheduler_Modern;
   friend TaskPriorityComparer;
+  friend TaskQueue;
+
+  static constexpr size_t kNotQueued = std::numeric_limits<size_t>::max();
 
   SchedulerPriority priority;
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   RuntimeSchedulerClock::time_point expirationTime;
 
+  // Position in the `TaskQueue` holding the task, and the order in which it
+  // was pushed there (to keep tasks expiring at the same time in FIFO order).
+  size_t queueIndex{kNotQueued};
+  uint64_t sequenceNumber{0};
+
   jsi::Value execute(jsi::Runtime& runtime, bool didUserCallbackTimeout);
 };
 
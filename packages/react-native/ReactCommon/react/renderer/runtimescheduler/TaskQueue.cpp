@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskQueue.h"
+
+#include <react/debug/react_native_assert.h>
+#include <algorithm>
+#include <tuple>
+
+namespace facebook::react {
+
+bool TaskQueue::empty() const noexcept {
+  return heap_.empty();
+}
+
+size_t TaskQueue::size() const noexcept {
+  return heap_.size();
+}
+
+size_t TaskQueue::getIdleTaskCount() const noexcept {
+  return idleTaskCount_;
+}
+
+const std::shared_ptr<Task>& TaskQueue::top() const noexcept {
+  react_native_assert(!heap_.empty());
+  return heap_.front();
+}
+
+void TaskQueue::push(std::shared_ptr<Task> task) {
+  react_native_assert(task->queueIndex == Task::kNotQueued);
+  task->sequenceNumber = nextSequenceNumber_++;
+  if (task->priority == SchedulerPriority::IdlePriority) {
+    idleTaskCount_++;
+  }
+
+  auto index = heap_.size();
+  heap_.emplace_back();
+  place(index, std::move(task));
+  siftUp(index);
+}
+
+void TaskQueue::pop() {
+  react_native_assert(!heap_.empty());
+  removeAt(0);
+}
+
+bool TaskQueue::remove(const Task& task) {
+  auto index = task.queueIndex;
+  if (index >= heap_.size() || heap_[index].get() != &task) {
+    return false;
+  }
+  removeAt(index);
+  return true;
+}
+
+bool TaskQueue::isBefore(const Task& lhs, const Task& rhs) noexcept {
+  return std::tie(lhs.expirationTime, lhs.sequenceNumber) <
+      std::tie(rhs.expirationTime, rhs.sequenceNumber);
+}
+
+void TaskQueue::place(size_t index, std::shared_ptr<Task> task) noexcept {
+  task->queueIndex = index;
+  heap_[index] = std::move(task);
+}
+
+void TaskQueue::siftUp(size_t index) noexcept {
+  auto task = std::move(heap_[index]);
+  while (index > 0) {
+    auto parentIndex = (index - 1) / kArity;
+    if (!isBefore(*task, *heap_[parentIndex])) {
+      break;
+    }
+    place(index, std::move(heap_[parentIndex]));
+    index = parentIndex;
+  }
+  place(index, std::move(task));
+}
+
+void TaskQueue::siftDown(size_t index) noexcept {
+  auto size = heap_.size();
+  auto task = std::move(heap_[index]);
+  while (true) {
+    auto firstChildIndex = index * kArity + 1;
+    if (firstChildIndex >= size) {
+      break;
+    }
+
+    auto bestChildIndex = firstChildIndex;
+    auto lastChildIndex = std::min(firstChildIndex + kArity, size);
+    for (auto childIndex = firstChildIndex + 1; childIndex < lastChildIndex;
+         childIndex++) {
+      if (isBefore(*heap_[childIndex], *heap_[bestChildIndex])) {
+        bestChildIndex = childIndex;
+      }
+    }
+
+    if (!isBefore(*heap_[bestChildIndex], *task)) {
+      break;
+    }
+    place(index, std::move(heap_[bestChildIndex]));
+    index = bestChildIndex;
+  }
+  place(index, std::move(task));
+}
+
+void TaskQueue::removeAt(size_t index) {
+  heap_[index]->queueIndex = Task::kNotQueued;
+  if (heap_[index]->priority == SchedulerPriority::IdlePriority) {
+    idleTaskCount_--;
+  }
+
+  auto lastIndex = heap_.size() - 1;
+  if (index != lastIndex) {
+    place(index, std::move(heap_[lastIndex]));
+  }
+  heap_.pop_back();
+
+  if (index < heap_.size()) {
+    // The moved task may belong above or below its new position.
+    if (index > 0 && isBefore(*heap_[index], *heap_[(index - 1) / kArity])) {
+      siftUp(index);
+    } else {
+      siftDown(index);
+    }
+  }
+}
+
+} // namespace facebook::react
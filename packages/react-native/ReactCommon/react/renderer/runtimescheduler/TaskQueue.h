@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Priority queue of tasks ordered by expiration time, and by scheduling order
+ * for tasks expiring at the same time.
+ *
+ * Implemented as an indexed 4-ary min-heap: every task knows its position in
+ * the heap, so any task (e.g. a cancelled one) can be removed in O(log n)
+ * instead of lingering in the queue until it reaches the top.
+ *
+ * Not thread-safe.
+ */
+class TaskQueue final {
+ public:
+  bool empty() const noexcept;
+  size_t size() const noexcept;
+
+  /*
+   * Number of queued tasks with idle priority.
+   */
+  size_t getIdleTaskCount() const noexcept;
+
+  /*
+   * The task expiring first. The queue must not be empty.
+   */
+  const std::shared_ptr<Task>& top() const noexcept;
+
+  void push(std::shared_ptr<Task> task);
+
+  /*
+   * Removes the task expiring first. The queue must not be empty.
+   */
+  void pop();
+
+  /*
+   * Removes the given task. Returns `false` if it's not in this queue.
+   */
+  bool remove(const Task& task);
+
+ private:
+  static constexpr size_t kArity = 4;
+
+  static bool isBefore(const Task& lhs, const Task& rhs) noexcept;
+
+  /*
+   * Stores the task at the given position, updating its index.
+   */
+  void place(size_t index, std::shared_ptr<Task> task) noexcept;
+
+  void siftUp(size_t index) noexcept;
+  void siftDown(size_t index) noexcept;
+
+  /*
+   * Removes the task at the given position.
+   */
+  void removeAt(size_t index);
+
+  std::vector<std::shared_ptr<Task>> heap_;
+  uint64_t nextSequenceNumber_{0};
+  size_t idleTaskCount_{0};
+};
+
+} // namespace facebook::react
@@ -14,6 +14,7 @@
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <memory>
 #include <semaphore>
+#include <vector>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -442,6 +443,36 @@ TEST_P(RuntimeSchedulerTest, continuationTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, taskCancellingItselfKeepsItsContinuation) {
+  bool didContinuationTask = false;
+  std::shared_ptr<Task> task;
+
+  // Like in the JS Scheduler, cancelling a running task doesn't prevent the
+  // continuation it returns from running.
+  auto callback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    runtimeScheduler_->cancelTask(*task);
+    return jsi::Function::createFromHostFunction(
+        *runtime_,
+        jsi::PropNameID::forUtf8(*runtime_, ""),
+        1,
+        [&](jsi::Runtime& /*runtime*/,
+            const jsi::Value& /*unused*/,
+            const jsi::Value* /*arguments*/,
+            size_t /*unused*/) noexcept -> jsi::Value {
+          didContinuationTask = true;
+          return jsi::Value::undefined();
+        });
+  });
+
+  task = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didContinuationTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_P(RuntimeSchedulerTest, getCurrentPriorityLevel) {
   auto callback =
       createHostFunctionFromLambda([this](bool /*didUserCallbackTimeout*/) {
@@ -1331,6 +1362,223 @@ TEST_P(RuntimeSchedulerTest, reportsLongTasksWithYielding) {
   EXPECT_EQ(pendingEntries[0].duration, 120);
 }
 
+TEST_P(RuntimeSchedulerTest, yieldsBeforeFrameDeadline) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->didReceiveVsync(stubClock_->getNow(), 16ms);
+  runtimeScheduler_->setFrameYieldBudget(4ms);
+
+  bool didRunTask1 = false;
+  bool didRunTask2 = false;
+
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    didRunTask1 = true;
+
+    stubClock_->advanceTimeBy(10ms);
+    EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+
+    // Less than 4ms left before the frame deadline.
+    stubClock_->advanceTimeBy(3ms);
+    EXPECT_TRUE(runtimeScheduler_->getShouldYield());
+
+    return jsi::Value::undefined();
+  });
+
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    didRunTask2 = true;
+
+    // The event loop already yielded for this frame.
+    EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback1));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback2));
+
+  stubQueue_->tick();
+
+  // The event loop yielded to the host before running the second task.
+  EXPECT_TRUE(didRunTask1);
+  EXPECT_FALSE(didRunTask2);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  auto frameStats = performanceEntryReporter_->getFrameStats();
+  EXPECT_EQ(frameStats.frameYieldCount, 1);
+  EXPECT_EQ(frameStats.totalTimeToYield, 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunTask2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+  EXPECT_EQ(performanceEntryReporter_->getFrameStats().frameYieldCount, 1);
+}
+
+TEST_P(RuntimeSchedulerTest, expiredTaskDoesntYieldForFrame) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->didReceiveVsync(stubClock_->getNow(), 16ms);
+
+  bool didRunTask2 = false;
+
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    stubClock_->advanceTimeBy(6s);
+    return jsi::Value::undefined();
+  });
+
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    didRunTask2 = true;
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback1));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback2));
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunTask2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+  EXPECT_EQ(performanceEntryReporter_->getFrameStats().frameYieldCount, 0);
+}
+
+TEST_P(RuntimeSchedulerTest, reportsDroppedFrames) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->didReceiveVsync(stubClock_->getNow(), 16ms);
+
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    runtimeScheduler_->scheduleRenderingUpdate(0, []() {});
+    stubClock_->advanceTimeBy(5ms);
+    return jsi::Value::undefined();
+  });
+
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    runtimeScheduler_->scheduleRenderingUpdate(0, []() {});
+    stubClock_->advanceTimeBy(40ms);
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback1));
+
+  stubQueue_->tick();
+
+  // Rendered in time for the first frame.
+  EXPECT_EQ(performanceEntryReporter_->getFrameStats().droppedFrameCount, 0);
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback2));
+
+  stubQueue_->tick();
+
+  // Started at 5ms and rendered at 45ms, missing the deadlines at 16ms and
+  // 32ms.
+  EXPECT_EQ(performanceEntryReporter_->getFrameStats().droppedFrameCount, 2);
+}
+
+TEST_P(RuntimeSchedulerTest, idleDeadlineIsLimitedToMaxIdlePeriod) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  stubClock_->setTimePoint(10ms);
+
+  auto idleDeadline = RuntimeSchedulerTimePoint{};
+  auto callback = createHostFunctionFromLambda([&](bool /* unused */) {
+    idleDeadline = runtimeScheduler_->getIdleDeadline();
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleIdleTask(std::move(callback));
+  stubQueue_->tick();
+
+  EXPECT_EQ(idleDeadline, RuntimeSchedulerTimePoint(60ms));
+}
+
+TEST_P(RuntimeSchedulerTest, legacyIdleDeadlineIsMaxIdlePeriod) {
+  // Only for legacy runtime scheduler
+  if (GetParam()) {
+    return;
+  }
+
+  stubClock_->setTimePoint(10ms);
+
+  EXPECT_EQ(
+      runtimeScheduler_->getIdleDeadline(), RuntimeSchedulerTimePoint(60ms));
+}
+
+TEST_P(RuntimeSchedulerTest, idleDeadlineEndsBeforeNextFrame) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->didReceiveVsync(stubClock_->getNow(), 16ms);
+  runtimeScheduler_->setFrameYieldBudget(4ms);
+  stubClock_->advanceTimeBy(2ms);
+
+  auto idleDeadlines = std::vector<RuntimeSchedulerTimePoint>{};
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    idleDeadlines.push_back(runtimeScheduler_->getIdleDeadline());
+    stubClock_->advanceTimeBy(18ms);
+    return jsi::Value::undefined();
+  });
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    idleDeadlines.push_back(runtimeScheduler_->getIdleDeadline());
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleIdleTask(std::move(callback1));
+  runtimeScheduler_->scheduleIdleTask(std::move(callback2));
+  stubQueue_->tick();
+
+  // 4ms before the frames ending at 16ms and 32ms.
+  EXPECT_EQ(
+      idleDeadlines,
+      (std::vector<RuntimeSchedulerTimePoint>{
+          RuntimeSchedulerTimePoint(12ms), RuntimeSchedulerTimePoint(28ms)}));
+}
+
+TEST_P(RuntimeSchedulerTest, noIdleTimeWithPendingWork) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  auto idleDeadlineBefore = RuntimeSchedulerTimePoint{};
+  auto idleDeadlineAfter = RuntimeSchedulerTimePoint{};
+  auto idleCallback = createHostFunctionFromLambda([&](bool /* unused */) {
+    idleDeadlineBefore = runtimeScheduler_->getIdleDeadline();
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::LowPriority,
+        createHostFunctionFromLambda(
+            [](bool /* unused */) { return jsi::Value::undefined(); }));
+    idleDeadlineAfter = runtimeScheduler_->getIdleDeadline();
+    return jsi::Value::undefined();
+  });
+
+  stubClock_->setTimePoint(10ms);
+  runtimeScheduler_->scheduleIdleTask(std::move(idleCallback));
+  stubQueue_->tick();
+
+  EXPECT_EQ(idleDeadlineBefore, RuntimeSchedulerTimePoint(60ms));
+  EXPECT_EQ(idleDeadlineAfter, RuntimeSchedulerTimePoint(10ms));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     UseModernRuntimeScheduler,
     RuntimeSchedulerTest,
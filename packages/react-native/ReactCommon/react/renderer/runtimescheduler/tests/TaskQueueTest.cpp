@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/TaskQueue.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::shared_ptr<Task> makeTask(RuntimeSchedulerDuration expiration) {
+  return std::make_shared<Task>(
+      SchedulerPriority::NormalPriority,
+      [](facebook::jsi::Runtime& /*runtime*/) {},
+      RuntimeSchedulerTimePoint(expiration));
+}
+
+std::vector<Task*> popAll(TaskQueue& queue) {
+  auto tasks = std::vector<Task*>{};
+  while (!queue.empty()) {
+    tasks.push_back(queue.top().get());
+    queue.pop();
+  }
+  return tasks;
+}
+
+} // namespace
+
+TEST(TaskQueueTest, ordersByExpirationTime) {
+  auto queue = TaskQueue{};
+  auto late = makeTask(30ms);
+  auto early = makeTask(10ms);
+  auto middle = makeTask(20ms);
+
+  queue.push(late);
+  queue.push(early);
+  queue.push(middle);
+
+  EXPECT_EQ(queue.size(), 3);
+  EXPECT_EQ(
+      popAll(queue),
+      (std::vector<Task*>{early.get(), middle.get(), late.get()}));
+}
+
+TEST(TaskQueueTest, keepsTasksExpiringAtTheSameTimeInOrder) {
+  auto queue = TaskQueue{};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  auto expected = std::vector<Task*>{};
+  for (int i = 0; i < 100; i++) {
+    tasks.push_back(makeTask(10ms));
+    expected.push_back(tasks.back().get());
+    queue.push(tasks.back());
+  }
+
+  EXPECT_EQ(popAll(queue), expected);
+}
+
+TEST(TaskQueueTest, removesAnyTask) {
+  auto queue = TaskQueue{};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int>{0, 1000};
+  for (int i = 0; i < 200; i++) {
+    tasks.push_back(
+        makeTask(std::chrono::milliseconds(distribution(generator))));
+    queue.push(tasks.back());
+  }
+
+  // Removing every third task.
+  auto remaining = std::vector<std::shared_ptr<Task>>{};
+  for (size_t i = 0; i < tasks.size(); i++) {
+    if (i % 3 == 0) {
+      EXPECT_TRUE(queue.remove(*tasks[i]));
+      EXPECT_FALSE(queue.remove(*tasks[i]));
+    } else {
+      remaining.push_back(tasks[i]);
+    }
+  }
+  EXPECT_EQ(queue.size(), remaining.size());
+
+  // Removed tasks can be pushed again.
+  queue.push(tasks[0]);
+  remaining.push_back(tasks[0]);
+
+  auto popped = std::vector<std::shared_ptr<Task>>{};
+  while (!queue.empty()) {
+    popped.push_back(queue.top());
+    queue.pop();
+  }
+
+  ASSERT_EQ(popped.size(), remaining.size());
+  for (size_t i = 1; i < popped.size(); i++) {
+    // `TaskPriorityComparer` is true if the first task expires later.
+    EXPECT_FALSE(TaskPriorityComparer{}(popped[i - 1], popped[i]));
+  }
+  for (const auto& task : remaining) {
+    EXPECT_NE(std::find(popped.begin(), popped.end(), task), popped.end());
+  }
+}
+
+TEST(TaskQueueTest, doesNotRemoveTasksOfOtherQueues) {
+  auto queue = TaskQueue{};
+  auto otherQueue = TaskQueue{};
+  auto task = makeTask(10ms);
+  auto otherTask = makeTask(10ms);
+  queue.push(task);
+  otherQueue.push(otherTask);
+
+  EXPECT_FALSE(queue.remove(*otherTask));
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_EQ(otherQueue.size(), 1);
+}
+
+TEST(TaskQueueTest, countsIdleTasks) {
+  auto queue = TaskQueue{};
+  auto idleTask = std::make_shared<Task>(
+      SchedulerPriority::IdlePriority,
+      [](facebook::jsi::Runtime& /*runtime*/) {},
+      RuntimeSchedulerTimePoint(5ms));
+  auto otherIdleTask = std::make_shared<Task>(
+      SchedulerPriority::IdlePriority,
+      [](facebook::jsi::Runtime& /*runtime*/) {},
+      RuntimeSchedulerTimePoint(30ms));
+  queue.push(idleTask);
+  queue.push(makeTask(10ms));
+  queue.push(otherIdleTask);
+  EXPECT_EQ(queue.getIdleTaskCount(), 2);
+
+  queue.remove(*otherIdleTask);
+  EXPECT_EQ(queue.getIdleTaskCount(), 1);
+
+  queue.pop();
+  EXPECT_EQ(queue.getIdleTaskCount(), 0);
+  EXPECT_EQ(queue.size(), 1);
+}
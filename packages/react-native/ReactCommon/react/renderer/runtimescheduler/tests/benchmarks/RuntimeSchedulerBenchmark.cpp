@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler_Modern.h>
+#include <react/renderer/runtimescheduler/TaskQueue.h>
+#include <chrono>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../StubQueue.h"
+
+namespace facebook::react {
+
+/*
+ * Throughput of the task queue under frequent rescheduling, as done by React
+ * concurrent rendering: for every new task, a random recent one is cancelled
+ * (it may have run already), and every other step the most urgent task runs.
+ */
+constexpr size_t kPendingTaskCount = 1000;
+constexpr auto kStepCount = 10000;
+
+std::shared_ptr<Task> makeTask(int step) {
+  return std::make_shared<Task>(
+      SchedulerPriority::NormalPriority,
+      [](jsi::Runtime& /*runtime*/) {},
+      RuntimeSchedulerTimePoint(std::chrono::milliseconds(step)));
+}
+
+/*
+ * Same workload with the previous queue: cancelled tasks stay in it until
+ * they reach the top.
+ */
+static void rescheduleWithLazyCancellation(benchmark::State& state) {
+  auto maxQueueSize = size_t{0};
+  for (auto _ : state) {
+    auto generator = std::mt19937{42};
+    auto queue = std::priority_queue<
+        std::shared_ptr<Task>,
+        std::vector<std::shared_ptr<Task>>,
+        TaskPriorityComparer>{};
+    auto pendingTasks = std::vector<std::shared_ptr<Task>>{};
+
+    for (int step = 0; step < kStepCount; step++) {
+      auto task = makeTask(step);
+      queue.push(task);
+      pendingTasks.push_back(std::move(task));
+
+      if (pendingTasks.size() > kPendingTaskCount) {
+        auto index = generator() % pendingTasks.size();
+        // What `cancelTask` does with this queue.
+        std::swap(pendingTasks[index], pendingTasks.back());
+        pendingTasks.pop_back();
+      }
+
+      if (step % 2 == 0) {
+        // Cancelled tasks are recognized by having no other owner here.
+        while (!queue.empty() && queue.top().use_count() == 1) {
+          queue.pop();
+        }
+        if (!queue.empty()) {
+          queue.pop();
+        }
+      }
+      maxQueueSize = std::max(maxQueueSize, queue.size());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kStepCount);
+  state.counters["maxQueueSize"] = static_cast<double>(maxQueueSize);
+}
+BENCHMARK(rescheduleWithLazyCancellation);
+
+/*
+ * What `RuntimeScheduler_Modern` does now: cancelled tasks are removed right
+ * away.
+ */
+static void rescheduleWithTaskQueue(benchmark::State& state) {
+  auto maxQueueSize = size_t{0};
+  for (auto _ : state) {
+    auto generator = std::mt19937{42};
+    auto queue = TaskQueue{};
+    auto pendingTasks = std::vector<std::shared_ptr<Task>>{};
+
+    for (int step = 0; step < kStepCount; step++) {
+      auto task = makeTask(step);
+      queue.push(task);
+      pendingTasks.push_back(std::move(task));
+
+      if (pendingTasks.size() > kPendingTaskCount) {
+        auto index = generator() % pendingTasks.size();
+        std::swap(pendingTasks[index], pendingTasks.back());
+        queue.remove(*pendingTasks.back());
+        pendingTasks.pop_back();
+      }
+
+      if (step % 2 == 0 && !queue.empty()) {
+        queue.pop();
+      }
+      maxQueueSize = std::max(maxQueueSize, queue.size());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kStepCount);
+  state.counters["maxQueueSize"] = static_cast<double>(maxQueueSize);
+}
+BENCHMARK(rescheduleWithTaskQueue);
+
+/*
+ * End-to-end: schedules a batch of tasks, cancels and reschedules half of
+ * them with a higher priority, and runs the event loop until all are done.
+ */
+static void scheduleCancelAndRunTasks(benchmark::State& state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto stubQueue = StubQueue{};
+  auto runtimeScheduler = RuntimeScheduler_Modern(
+      [&](std::function<void(jsi::Runtime & runtime)>&& callback) {
+        stubQueue.runOnQueue([&, callback = std::move(callback)]() {
+          callback(*runtime);
+        });
+      },
+      []() { return RuntimeSchedulerClock::now(); },
+      [](jsi::Runtime& /*runtime*/, jsi::JSError& /*error*/) {});
+
+  auto executedTaskCount = 0;
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  tasks.reserve(kPendingTaskCount);
+  for (auto _ : state) {
+    tasks.clear();
+    for (size_t i = 0; i < kPendingTaskCount; i++) {
+      tasks.push_back(runtimeScheduler.scheduleTask(
+          SchedulerPriority::NormalPriority,
+          [&](jsi::Runtime& /*runtime*/) { executedTaskCount++; }));
+    }
+    for (size_t i = 0; i < kPendingTaskCount; i += 2) {
+      runtimeScheduler.cancelTask(*tasks[i]);
+      runtimeScheduler.scheduleTask(
+          SchedulerPriority::UserBlockingPriority,
+          [&](jsi::Runtime& /*runtime*/) { executedTaskCount++; });
+    }
+    stubQueue.flush();
+  }
+  benchmark::DoNotOptimize(executedTaskCount);
+  state.SetItemsProcessed(state.iterations() * kPendingTaskCount * 3 / 2);
+}
+BENCHMARK(scheduleCancelAndRunTasks);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
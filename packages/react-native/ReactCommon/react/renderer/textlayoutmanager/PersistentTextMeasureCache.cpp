@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PersistentTextMeasureCache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint32_t kFileMagic = 0x4d54'4e52; // "RNTM"
+constexpr uint32_t kFileVersion = 1;
+
+struct FileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t environmentFingerprint;
+  uint64_t entryCount;
+};
+
+/*
+ * 64-bit FNV-1a over the canonical binary representation of the values
+ * passed to `add`. Unlike `std::hash`, the result is stable across
+ * processes.
+ */
+class Fingerprint {
+ public:
+  void add(std::string_view bytes) {
+    add(bytes.size());
+    for (auto byte : bytes) {
+      hash_ ^= static_cast<uint8_t>(byte);
+      hash_ *= 0x100'0000'01b3ULL;
+    }
+  }
+
+  template <typename T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+  void add(T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (auto byte : bytes) {
+      hash_ ^= static_cast<uint8_t>(byte);
+      hash_ *= 0x100'0000'01b3ULL;
+    }
+  }
+
+  template <typename T>
+  void add(const std::optional<T>& value) {
+    add(value.has_value());
+    if (value.has_value()) {
+      add(*value);
+    }
+  }
+
+  uint64_t value() const {
+    return hash_;
+  }
+
+ private:
+  uint64_t hash_{0xcbf2'9ce4'8422'2325ULL};
+};
+
+uint64_t environmentFingerprint(
+    const PersistentTextMeasureCache::Environment& environment) {
+  auto fingerprint = Fingerprint{};
+  fingerprint.add(kFileVersion);
+  fingerprint.add(environment.fontScale);
+  fingerprint.add(std::string_view{environment.locale});
+  return fingerprint.value();
+}
+
+} // namespace
+
+PersistentTextMeasureCache::PersistentTextMeasureCache(
+    std::string filePath,
+    Environment environment)
+    : filePath_(std::move(filePath)),
+      environmentFingerprint_(environmentFingerprint(environment)) {
+  map();
+}
+
+PersistentTextMeasureCache::~PersistentTextMeasureCache() {
+  unmap();
+}
+
+std::optional<uint64_t> PersistentTextMeasureCache::fingerprint(
+    const TextMeasureCacheKey& key) {
+  auto fingerprint = Fingerprint{};
+
+  // Mirrors `areAttributedStringsEquivalentLayoutWise`.
+  const auto& fragments = key.attributedString.getFragments();
+  fingerprint.add(fragments.size());
+  for (const auto& fragment : fragments) {
+    if (fragment.isAttachment()) {
+      return std::nullopt;
+    }
+
+    const auto& textAttributes = *fragment.textAttributes;
+    fingerprint.add(std::string_view{fragment.string});
+    fingerprint.add(std::string_view{textAttributes.fontFamily});
+    fingerprint.add(textAttributes.fontSize);
+    fingerprint.add(textAttributes.fontSizeMultiplier);
+    fingerprint.add(textAttributes.fontWeight);
+    fingerprint.add(textAttributes.fontStyle);
+    fingerprint.add(textAttributes.fontVariant);
+    fingerprint.add(textAttributes.allowFontScaling);
+    fingerprint.add(textAttributes.dynamicTypeRamp);
+    fingerprint.add(textAttributes.letterSpacing);
+    fingerprint.add(textAttributes.lineHeight);
+    fingerprint.add(textAttributes.alignment);
+  }
+
+  const auto& paragraphAttributes = key.paragraphAttributes;
+  fingerprint.add(paragraphAttributes.maximumNumberOfLines);
+  fingerprint.add(paragraphAttributes.ellipsizeMode);
+  fingerprint.add(paragraphAttributes.textBreakStrategy);
+  fingerprint.add(paragraphAttributes.adjustsFontSizeToFit);
+  fingerprint.add(paragraphAttributes.includeFontPadding);
+  fingerprint.add(paragraphAttributes.android_hyphenationFrequency);
+  fingerprint.add(paragraphAttributes.minimumFontSize);
+  fingerprint.add(paragraphAttributes.maximumFontSize);
+
+  fingerprint.add(key.layoutConstraints.maximumSize.width);
+
+  return fingerprint.value();
+}
+
+std::optional<TextMeasurement> PersistentTextMeasureCache::get(
+    const TextMeasureCacheKey& key) const {
+  auto keyFingerprint = fingerprint(key);
+  if (!keyFingerprint) {
+    return std::nullopt;
+  }
+
+  if (auto entry = findMappedEntry(*keyFingerprint)) {
+    return TextMeasurement{{entry->width, entry->height}, {}};
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iterator = recordedEntries_.find(*keyFingerprint);
+  if (iterator == recordedEntries_.end()) {
+    return std::nullopt;
+  }
+  return TextMeasurement{iterator->second, {}};
+}
+
+void PersistentTextMeasureCache::set(
+    const TextMeasureCacheKey& key,
+    const TextMeasurement& measurement) const {
+  auto keyFingerprint = fingerprint(key);
+  if (!keyFingerprint || !measurement.attachments.empty() ||
+      findMappedEntry(*keyFingerprint) != nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (recordedEntries_.size() < kMaxEntryCount) {
+    recordedEntries_[*keyFingerprint] = measurement.size;
+  }
+}
+
+size_t PersistentTextMeasureCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return mappedEntryCount_ + recordedEntries_.size();
+}
+
+void PersistentTextMeasureCache::warmUp() const {
+  if (mappedData_ == nullptr) {
+    return;
+  }
+
+  madvise(mappedData_, mappedSize_, MADV_WILLNEED);
+}
+
+bool PersistentTextMeasureCache::persist() const {
+  auto entries = std::vector<Entry>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries.reserve(
+        std::min(kMaxEntryCount, recordedEntries_.size() + mappedEntryCount_));
+    for (const auto& [entryFingerprint, size] : recordedEntries_) {
+      entries.push_back(
+          {entryFingerprint,
+           static_cast<float>(size.width),
+           static_cast<float>(size.height)});
+    }
+  }
+
+  for (size_t i = 0;
+       i < mappedEntryCount_ && entries.size() < kMaxEntryCount;
+       i++) {
+    entries.push_back(mappedEntries_[i]);
+  }
+
+  std::sort(
+      entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.fingerprint < rhs.fingerprint;
+      });
+
+  auto header = FileHeader{
+      kFileMagic, kFileVersion, environmentFingerprint_, entries.size()};
+
+  auto temporaryFilePath = filePath_ + ".tmp";
+  auto file = std::fopen(temporaryFilePath.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  auto succeeded = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+      std::fwrite(entries.data(), sizeof(Entry), entries.size(), file) ==
+          entries.size();
+  succeeded = std::fclose(file) == 0 && succeeded;
+
+  if (!succeeded ||
+      std::rename(temporaryFilePath.c_str(), filePath_.c_str()) != 0) {
+    std::remove(temporaryFilePath.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void PersistentTextMeasureCache::map() {
+  auto fileDescriptor = open(filePath_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fileDescriptor < 0) {
+    return;
+  }
+
+  struct stat fileStat {};
+  if (fstat(fileDescriptor, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < sizeof(FileHeader)) {
+    close(fileDescriptor);
+    return;
+  }
+
+  auto size = static_cast<size_t>(fileStat.st_size);
+  auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  close(fileDescriptor);
+  if (data == MAP_FAILED) {
+    return;
+  }
+
+  mappedData_ = data;
+  mappedSize_ = size;
+
+  const auto& header = *static_cast<const FileHeader*>(data);
+  if (header.magic != kFileMagic || header.version != kFileVersion ||
+      header.environmentFingerprint != environmentFingerprint_ ||
+      header.entryCount > (size - sizeof(FileHeader)) / sizeof(Entry)) {
+    // Stale or corrupted file, it will be overwritten by `persist`.
+    unmap();
+    return;
+  }
+
+  mappedEntries_ = reinterpret_cast<const Entry*>(
+      static_cast<const char*>(data) + sizeof(FileHeader));
+  mappedEntryCount_ = static_cast<size_t>(header.entryCount);
+}
+
+void PersistentTextMeasureCache::unmap() {
+  if (mappedData_ != nullptr) {
+    munmap(mappedData_, mappedSize_);
+  }
+  mappedData_ = nullptr;
+  mappedSize_ = 0;
+  mappedEntries_ = nullptr;
+  mappedEntryCount_ = 0;
+}
+
+const PersistentTextMeasureCache::Entry*
+PersistentTextMeasureCache::findMappedEntry(uint64_t fingerprint) const {
+  auto end = mappedEntries_ + mappedEntryCount_;
+  auto iterator = std::lower_bound(
+      mappedEntries_, end, fingerprint, [](const Entry& entry, uint64_t value) {
+        return entry.fingerprint < value;
+      });
+  if (iterator == end || iterator->fingerprint != fingerprint) {
+    return nullptr;
+  }
+  return iterator;
+}
+
+} // namespace facebook::react
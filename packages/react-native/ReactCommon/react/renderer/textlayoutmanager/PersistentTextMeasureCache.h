@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+namespace facebook::react {
+
+/*
+ * Optional on-disk layer below `TextMeasureCache` that survives app
+ * launches. Paragraphs measured during a previous run can be laid out on
+ * cold start without going through the platform text layout.
+ *
+ * Entries are stored in a memory-mapped, versioned file as a sorted array of
+ * (key fingerprint, size) pairs. A fingerprint is a stable 64-bit hash of
+ * everything `TextMeasureCacheKey` equality takes into account. Measurements
+ * of attributed strings with attachments are not persisted because they
+ * depend on the layout of the attached views.
+ *
+ * The whole file is ignored if it was written for a different font scale or
+ * locale.
+ *
+ * To enable it, put a `std::shared_ptr<const PersistentTextMeasureCache>`
+ * into the `ContextContainer` under
+ * `PersistentTextMeasureCache::ContextContainerKey`. The embedder owns that
+ * instance: it should call `warmUp` right after creating it (before the first
+ * surface starts) and `persist` when the app goes to the background or shuts
+ * down.
+ *
+ * The cxx TextLayoutManager can manage the cache by itself instead: put the
+ * file path (a `std::string`) into the `ContextContainer` under
+ * `PersistentTextMeasureCache::FilePathContextContainerKey`. The cache is then
+ * warmed up when the TextLayoutManager is created and persisted when it is
+ * destroyed.
+ */
+class PersistentTextMeasureCache final {
+ public:
+  static constexpr const char* ContextContainerKey =
+      "PersistentTextMeasureCache";
+  static constexpr const char* FilePathContextContainerKey =
+      "PersistentTextMeasureCacheFilePath";
+
+  /*
+   * Environment properties which, when changed, invalidate all persisted
+   * measurements.
+   */
+  struct Environment {
+    Float fontScale{1};
+    std::string locale{};
+  };
+
+  /*
+   * Maps the file at `filePath` if it exists and matches `environment`.
+   */
+  PersistentTextMeasureCache(std::string filePath, Environment environment);
+  ~PersistentTextMeasureCache();
+
+  PersistentTextMeasureCache(const PersistentTextMeasureCache&) = delete;
+  PersistentTextMeasureCache& operator=(const PersistentTextMeasureCache&) =
+      delete;
+
+  /*
+   * Returns a persisted measurement for a given key, if any.
+   * Can be called from any thread.
+   */
+  std::optional<TextMeasurement> get(const TextMeasureCacheKey& key) const;
+
+  /*
+   * Records a measurement to be written by the next `persist` call.
+   * Can be called from any thread.
+   */
+  void set(const TextMeasureCacheKey& key, const TextMeasurement& measurement)
+      const;
+
+  /*
+   * Asks the OS to page in the mapped file, so first lookups during startup
+   * don't fault on every page.
+   */
+  void warmUp() const;
+
+  /*
+   * Writes persisted and recorded measurements to the file, keeping at most
+   * `kMaxEntryCount` of them (recorded ones first). The file is replaced
+   * atomically. Returns `false` if writing failed.
+   * Can be called from any thread.
+   */
+  bool persist() const;
+
+  /*
+   * Number of entries that can be looked up right now.
+   */
+  size_t size() const;
+
+  /*
+   * Returns a stable fingerprint of a key, or an empty optional if the key
+   * must not be persisted.
+   */
+  static std::optional<uint64_t> fingerprint(const TextMeasureCacheKey& key);
+
+  static constexpr size_t kMaxEntryCount = 8192;
+
+ private:
+  struct Entry {
+    uint64_t fingerprint;
+    float width;
+    float height;
+  };
+
+  void map();
+  void unmap();
+  const Entry* findMappedEntry(uint64_t fingerprint) const;
+
+  const std::string filePath_;
+  const uint64_t environmentFingerprint_;
+
+  // Read-only after construction.
+  void* mappedData_{nullptr};
+  size_t mappedSize_{0};
+  const Entry* mappedEntries_{nullptr};
+  size_t mappedEntryCount_{0};
+
+  // Protected by `mutex_`.
+  mutable std::unordered_map<uint64_t, Size> recordedEntries_;
+  mutable std::mutex mutex_;
+};
+
+} // namespace facebook::react
@@ -10,6 +10,7 @@
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
@@ -93,6 +94,8 @@ class TextLayoutManager {
 #endif
   TextMeasureCache textMeasureCache_;
   LineMeasureCache lineMeasureCache_;
+  std::shared_ptr<const PersistentTextMeasureCache>
+      persistentTextMeasureCache_;
 };
 
 } // namespace facebook::react
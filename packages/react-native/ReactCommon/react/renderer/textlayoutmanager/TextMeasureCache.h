@@ -10,8 +10,8 @@
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/utils/ConcurrentLRUCache.h>
 #include <react/utils/FloatComparison.h>
-#include <react/utils/SimpleThreadSafeCache.h>
 #include <react/utils/hash_combine.h>
 
 namespace facebook::react {
@@ -85,67 +85,18 @@ constexpr auto kSimpleThreadSafeCacheSizeCap = size_t{1024};
 
 /*
  * Thread-safe, evicting hash table designed to store text measurement
- * information.
+ * information. Measurements run outside of the cache locks, so concurrently
+ * laid out surfaces don't block each other.
  */
-using TextMeasureCache = SimpleThreadSafeCache<
-    TextMeasureCacheKey,
-    TextMeasurement,
-    kSimpleThreadSafeCacheSizeCap>;
+using TextMeasureCache =
+    ConcurrentLRUCache<TextMeasureCacheKey, TextMeasurement>;
 
 /*
  * Thread-safe, evicting hash table designed to store line measurement
  * information.
  */
-using LineMeasureCache = SimpleThreadSafeCache<
-    LineMeasureCacheKey,
-    LinesMeasurements,
-    kSimpleThreadSafeCacheSizeCap>;
-
-inline bool areTextAttributesEquivalentLayoutWise(
-    const TextAttributes& lhs,
-    const TextAttributes& rhs) {
-  // Here we check all attributes that affect layout metrics and don't check any
-  // attributes that affect only a decorative aspect of displayed text (like
-  // colors).
-  return std::tie(
-             lhs.fontFamily,
-             lhs.fontWeight,
-             lhs.fontStyle,
-             lhs.fontVariant,
-             lhs.allowFontScaling,
-             lhs.dynamicTypeRamp,
-             lhs.alignment) ==
-      std::tie(
-             rhs.fontFamily,
-             rhs.fontWeight,
-             rhs.fontStyle,
-             rhs.fontVariant,
-             rhs.allowFontScaling,
-             rhs.dynamicTypeRamp,
-             rhs.alignment) &&
-      floatEquality(lhs.fontSize, rhs.fontSize) &&
-      floatEquality(lhs.fontSizeMultiplier, rhs.fontSizeMultiplier) &&
-      floatEquality(lhs.letterSpacing, rhs.letterSpacing) &&
-      floatEquality(lhs.lineHeight, rhs.lineHeight);
-}
-
-inline size_t textAttributesHashLayoutWise(
-    const TextAttributes& textAttributes) {
-  // Taking into account the same props as
-  // `areTextAttributesEquivalentLayoutWise` mentions.
-  return facebook::react::hash_combine(
-      textAttributes.fontFamily,
-      textAttributes.fontSize,
-      textAttributes.fontSizeMultiplier,
-      textAttributes.fontWeight,
-      textAttributes.fontStyle,
-      textAttributes.fontVariant,
-      textAttributes.allowFontScaling,
-      textAttributes.dynamicTypeRamp,
-      textAttributes.letterSpacing,
-      textAttributes.lineHeight,
-      textAttributes.alignment);
-}
+using LineMeasureCache =
+    ConcurrentLRUCache<LineMeasureCacheKey, LinesMeasurements>;
 
 inline bool areAttributedStringFragmentsEquivalentLayoutWise(
     const AttributedString::Fragment& lhs,
@@ -166,7 +117,7 @@ inline size_t attributedStringFragmentHashLayoutWise(
   // because they are logically interdependent and this can break an invariant
   // between hash and equivalence functions (and cause cache misses).
   return facebook::react::hash_combine(
-      fragment.string, textAttributesHashLayoutWise(fragment.textAttributes));
+      fragment.string, fragment.textAttributes.getLayoutWiseHash());
 }
 
 inline bool areAttributedStringsEquivalentLayoutWise(
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextPreMeasurer.h"
+
+#include <glog/logging.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+
+#ifdef ANDROID
+#include <fbjni/fbjni.h>
+#endif
+
+namespace facebook::react {
+
+TextPreMeasurer::TextPreMeasurer(
+    std::shared_ptr<const TextLayoutManager> textLayoutManager,
+    size_t workerCount,
+    WorkerWrapper workerWrapper)
+    : textLayoutManager_(std::move(textLayoutManager)) {
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; i++) {
+    workers_.emplace_back([this, workerWrapper]() {
+      if (workerWrapper) {
+        workerWrapper([this]() { runWorker(); });
+        return;
+      }
+#ifdef ANDROID
+      // `TextLayoutManager` measures text through JNI on Android.
+      jni::ThreadScope::WithClassLoader([this]() { runWorker(); });
+#else
+      runWorker();
+#endif
+    });
+  }
+}
+
+TextPreMeasurer::~TextPreMeasurer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    metrics_.droppedRequestCount +=
+        visibleRequests_.size() + hiddenRequests_.size();
+    visibleRequests_.clear();
+    hiddenRequests_.clear();
+  }
+  requestAvailable_.notify_all();
+  idle_.notify_all();
+
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void TextPreMeasurer::enqueue(Request request, Priority priority) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return;
+    }
+
+    auto& requests =
+        priority == Priority::Visible ? visibleRequests_ : hiddenRequests_;
+    requests.push_back(std::move(request));
+    metrics_.enqueuedRequestCount++;
+
+    if (visibleRequests_.size() + hiddenRequests_.size() >
+        kMaxPendingRequestCount) {
+      auto& victims =
+          hiddenRequests_.empty() ? visibleRequests_ : hiddenRequests_;
+      victims.pop_front();
+      metrics_.droppedRequestCount++;
+    }
+  }
+  requestAvailable_.notify_one();
+}
+
+void TextPreMeasurer::waitUntilIdle() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock, [this]() {
+    return stopped_ ||
+        (visibleRequests_.empty() && hiddenRequests_.empty() &&
+         inProgressRequestCount_ == 0);
+  });
+}
+
+TextPreMeasurer::Metrics TextPreMeasurer::getMetrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+void TextPreMeasurer::runWorker() const {
+  while (true) {
+    auto request = Request{};
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      requestAvailable_.wait(lock, [this]() {
+        return stopped_ || !visibleRequests_.empty() ||
+            !hiddenRequests_.empty();
+      });
+
+      if (stopped_) {
+        return;
+      }
+
+      auto& requests =
+          visibleRequests_.empty() ? hiddenRequests_ : visibleRequests_;
+      request = std::move(requests.front());
+      requests.pop_front();
+      inProgressRequestCount_++;
+    }
+
+    // The result is discarded, measuring primes the caches of
+    // `TextLayoutManager`. A failure only costs the head start: layout
+    // measures the paragraph again.
+    try {
+      textLayoutManager_->measure(
+          AttributedStringBox{request.attributedString},
+          request.paragraphAttributes,
+          request.layoutContext,
+          request.layoutConstraints);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Failed to pre-measure a paragraph: " << e.what();
+    } catch (...) {
+      LOG(ERROR) << "Failed to pre-measure a paragraph.";
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      inProgressRequestCount_--;
+      metrics_.measuredRequestCount++;
+      if (visibleRequests_.empty() && hiddenRequests_.empty() &&
+          inProgressRequestCount_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+}
+
+} // namespace facebook::react
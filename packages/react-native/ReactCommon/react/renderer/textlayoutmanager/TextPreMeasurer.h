@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/TextLayoutContext.h>
+
+namespace facebook::react {
+
+class TextLayoutManager;
+
+/*
+ * Measures paragraphs speculatively on a small pool of background threads,
+ * so that by the time layout runs as part of a commit, most measurements are
+ * already in the `TextMeasureCache` of the `TextLayoutManager`. If layout asks
+ * for a paragraph that is still being measured, it waits for that measurement
+ * instead of starting another one.
+ *
+ * Requests for visible surfaces are always served before requests for hidden
+ * ones. The number of pending requests is bounded; when the limit is reached,
+ * the oldest request of the lowest priority is dropped.
+ */
+class TextPreMeasurer final {
+ public:
+  enum class Priority {
+    // The paragraph belongs to a surface which is currently displayed.
+    Visible,
+    // The paragraph belongs to a surface which is prerendered or hidden.
+    Hidden,
+  };
+
+  struct Request {
+    AttributedString attributedString;
+    ParagraphAttributes paragraphAttributes;
+    TextLayoutContext layoutContext;
+    LayoutConstraints layoutConstraints;
+  };
+
+  struct Metrics {
+    size_t enqueuedRequestCount{0};
+    size_t measuredRequestCount{0};
+    size_t droppedRequestCount{0};
+  };
+
+  /*
+   * Runs the worker loop passed as an argument. Can be used to set up
+   * platform-specific thread state for the lifetime of a worker. By default,
+   * workers are attached to the JVM on Android.
+   */
+  using WorkerWrapper = std::function<void(const std::function<void()>& run)>;
+
+  static constexpr size_t kDefaultWorkerCount = 2;
+  static constexpr size_t kMaxPendingRequestCount = 1024;
+
+  TextPreMeasurer(
+      std::shared_ptr<const TextLayoutManager> textLayoutManager,
+      size_t workerCount = kDefaultWorkerCount,
+      WorkerWrapper workerWrapper = nullptr);
+
+  /*
+   * Drops pending requests and waits for in-progress ones to finish.
+   */
+  ~TextPreMeasurer();
+
+  TextPreMeasurer(const TextPreMeasurer&) = delete;
+  TextPreMeasurer& operator=(const TextPreMeasurer&) = delete;
+
+  /*
+   * Schedules a paragraph to be measured.
+   * Can be called from any thread.
+   */
+  void enqueue(Request request, Priority priority) const;
+
+  /*
+   * Blocks until there are no pending or in-progress requests.
+   * Can be called from any thread except workers.
+   */
+  void waitUntilIdle() const;
+
+  /*
+   * Can be called from any thread.
+   */
+  Metrics getMetrics() const;
+
+ private:
+  void runWorker() const;
+
+  const std::shared_ptr<const TextLayoutManager> textLayoutManager_;
+
+  // Protected by `mutex_`.
+  mutable std::deque<Request> visibleRequests_;
+  mutable std::deque<Request> hiddenRequests_;
+  mutable size_t inProgressRequestCount_{0};
+  mutable Metrics metrics_{};
+  mutable bool stopped_{false};
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable requestAvailable_;
+  mutable std::condition_variable idle_;
+
+  std::vector<std::thread> workers_;
+};
+
+} // namespace facebook::react
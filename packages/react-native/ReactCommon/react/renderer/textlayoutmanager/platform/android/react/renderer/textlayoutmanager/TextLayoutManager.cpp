@@ -155,7 +155,12 @@ TextLayoutManager::TextLayoutManager(
     const ContextContainer::Shared& contextContainer)
     : contextContainer_(contextContainer),
       textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
-      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      persistentTextMeasureCache_(
+          contextContainer
+              ->find<std::shared_ptr<const PersistentTextMeasureCache>>(
+                  PersistentTextMeasureCache::ContextContainerKey)
+              .value_or(nullptr)) {}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
@@ -166,7 +171,13 @@ TextMeasurement TextLayoutManager::measure(
 
   auto measurement = textMeasureCache_.get(
       {attributedString, paragraphAttributes, layoutConstraints},
-      [&](const TextMeasureCacheKey& /*key*/) {
+      [&](const TextMeasureCacheKey& key) {
+        if (persistentTextMeasureCache_) {
+          if (auto measurement = persistentTextMeasureCache_->get(key)) {
+            return *measurement;
+          }
+        }
+
         auto telemetry = TransactionTelemetry::threadLocalTelemetry();
         if (telemetry != nullptr) {
           telemetry->willMeasureText();
@@ -182,6 +193,10 @@ TextMeasurement TextLayoutManager::measure(
           telemetry->didMeasureText();
         }
 
+        if (persistentTextMeasureCache_) {
+          persistentTextMeasureCache_->set(key, measurement);
+        }
+
         return measurement;
       });
 
@@ -7,26 +7,102 @@
 
 #include "TextLayoutManager.h"
 
+#include <memory>
+#include <string>
+
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
+#include <react/renderer/textlayoutmanager/TextLayoutEngine.h>
+
 namespace facebook::react {
 
+namespace {
+
+const TextLayoutEngine& getTextLayoutEngine() {
+  // Shared by all instances, so shaped fragments are reused across surfaces.
+  static auto& textLayoutEngine = *new TextLayoutEngine();
+  return textLayoutEngine;
+}
+
+std::shared_ptr<const PersistentTextMeasureCache>
+getPersistentTextMeasureCache(
+    const ContextContainer::Shared& contextContainer) {
+  if (!contextContainer) {
+    return nullptr;
+  }
+
+  auto persistentTextMeasureCache =
+      contextContainer->find<std::shared_ptr<const PersistentTextMeasureCache>>(
+          PersistentTextMeasureCache::ContextContainerKey);
+  if (persistentTextMeasureCache) {
+    // Owned, warmed up and persisted by the embedder.
+    return *persistentTextMeasureCache;
+  }
+
+  auto filePath = contextContainer->find<std::string>(
+      PersistentTextMeasureCache::FilePathContextContainerKey);
+  if (!filePath) {
+    return nullptr;
+  }
+
+  // Measurements recorded while this TextLayoutManager was alive are written
+  // out when the last reference to the cache goes away.
+  auto cache = std::shared_ptr<const PersistentTextMeasureCache>(
+      new PersistentTextMeasureCache(
+          *filePath, PersistentTextMeasureCache::Environment{}),
+      [](const PersistentTextMeasureCache* cache) {
+        cache->persist();
+        delete cache;
+      });
+  cache->warmUp();
+  return cache;
+}
+
+} // namespace
+
 TextLayoutManager::TextLayoutManager(
-    const ContextContainer::Shared& /*contextContainer*/)
+    const ContextContainer::Shared& contextContainer)
     : textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
-      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      persistentTextMeasureCache_(
+          getPersistentTextMeasureCache(contextContainer)) {
+  if (contextContainer) {
+    auto fontDirectories = contextContainer->find<std::vector<std::string>>(
+        FontRegistry::ContextContainerKey);
+    if (fontDirectories) {
+      for (const auto& fontDirectory : *fontDirectories) {
+        FontRegistry::shared().registerFontDirectory(fontDirectory);
+      }
+    }
+  }
+}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
-    const ParagraphAttributes& /*paragraphAttributes*/,
+    const ParagraphAttributes& paragraphAttributes,
     const TextLayoutContext& /*layoutContext*/,
-    const LayoutConstraints& /*layoutConstraints*/) const {
-  TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
-    }
-  }
-  return TextMeasurement{{0, 0}, attachments};
+    const LayoutConstraints& layoutConstraints) const {
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return textMeasureCache_.get(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](const TextMeasureCacheKey& key) {
+        if (persistentTextMeasureCache_) {
+          if (auto measurement = persistentTextMeasureCache_->get(key)) {
+            return *measurement;
+          }
+        }
+
+        auto measurement = getTextLayoutEngine().measure(
+            attributedString,
+            paragraphAttributes,
+            layoutConstraints.maximumSize);
+
+        if (persistentTextMeasureCache_) {
+          persistentTextMeasureCache_->set(key, measurement);
+        }
+
+        return measurement;
+      });
 }
 
 #ifdef ANDROID
@@ -39,10 +115,17 @@ TextMeasurement TextLayoutManager::measureCachedSpannableById(
 #endif
 
 LinesMeasurements TextLayoutManager::measureLines(
-    const AttributedStringBox& /*attributedStringBox*/,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const Size& /*size*/) const {
-  return {};
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return lineMeasureCache_.get(
+      {attributedString, paragraphAttributes, size},
+      [&](const LineMeasureCacheKey& /*key*/) {
+        return getTextLayoutEngine().measureLines(
+            attributedString, paragraphAttributes, size);
+      });
 };
 
 } // namespace facebook::react
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontFace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string_view>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Bounds-checked big-endian reader over the contents of a font file.
+ * Out-of-range reads return zero and mark the reader as failed.
+ */
+class FontDataReader {
+ public:
+  explicit FontDataReader(const std::vector<uint8_t>& data) : data_(data) {}
+
+  uint8_t u8(size_t offset) const {
+    if (offset + 1 > data_.size()) {
+      failed_ = true;
+      return 0;
+    }
+    return data_[offset];
+  }
+
+  uint16_t u16(size_t offset) const {
+    return static_cast<uint16_t>((u8(offset) << 8) | u8(offset + 1));
+  }
+
+  int16_t i16(size_t offset) const {
+    return static_cast<int16_t>(u16(offset));
+  }
+
+  uint32_t u32(size_t offset) const {
+    return (static_cast<uint32_t>(u16(offset)) << 16) | u16(offset + 2);
+  }
+
+  bool contains(size_t offset, size_t length) const {
+    return offset <= data_.size() && length <= data_.size() - offset;
+  }
+
+  bool failed() const {
+    return failed_;
+  }
+
+ private:
+  const std::vector<uint8_t>& data_;
+  mutable bool failed_{false};
+};
+
+struct TableRecord {
+  uint32_t offset;
+  uint32_t length;
+};
+
+constexpr uint32_t tag(const char (&name)[5]) {
+  return (static_cast<uint32_t>(name[0]) << 24) |
+      (static_cast<uint32_t>(name[1]) << 16) |
+      (static_cast<uint32_t>(name[2]) << 8) | static_cast<uint32_t>(name[3]);
+}
+
+std::optional<TableRecord> findTable(
+    const FontDataReader& reader,
+    uint32_t tableTag) {
+  auto numTables = reader.u16(4);
+  for (size_t i = 0; i < numTables; i++) {
+    auto record = 12 + i * 16;
+    if (reader.u32(record) == tableTag) {
+      auto table = TableRecord{reader.u32(record + 8), reader.u32(record + 12)};
+      if (!reader.contains(table.offset, table.length)) {
+        return std::nullopt;
+      }
+      return table;
+    }
+  }
+  return std::nullopt;
+}
+
+void appendUtf8(std::string& string, char32_t codePoint) {
+  if (codePoint < 0x80) {
+    string.push_back(static_cast<char>(codePoint));
+  } else if (codePoint < 0x800) {
+    string.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+    string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else if (codePoint < 0x10000) {
+    string.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+    string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else {
+    string.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+    string.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  }
+}
+
+/*
+ * Reads the font family name from the `name` table, preferring the
+ * typographic family name (id 16) over the legacy one (id 1).
+ */
+std::string readFamilyName(const FontDataReader& reader, TableRecord name) {
+  auto count = reader.u16(name.offset + 2);
+  auto storage = name.offset + reader.u16(name.offset + 4);
+
+  auto bestName = std::string{};
+  auto bestScore = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto record = name.offset + 6 + i * 12;
+    auto platformId = reader.u16(record);
+    auto nameId = reader.u16(record + 6);
+    auto length = reader.u16(record + 8);
+    auto offset = storage + reader.u16(record + 10);
+
+    if ((nameId != 1 && nameId != 16) || !reader.contains(offset, length)) {
+      continue;
+    }
+
+    auto isUtf16 = platformId == 0 || platformId == 3;
+    auto score = (nameId == 16 ? 2 : 0) + (isUtf16 ? 1 : 0);
+    if (score <= bestScore) {
+      continue;
+    }
+
+    auto value = std::string{};
+    if (isUtf16) {
+      for (size_t j = 0; j + 1 < length; j += 2) {
+        char32_t unit = reader.u16(offset + j);
+        if (unit >= 0xD800 && unit <= 0xDBFF && j + 3 < length) {
+          char32_t low = reader.u16(offset + j + 2);
+          unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+          j += 2;
+        }
+        appendUtf8(value, unit);
+      }
+    } else {
+      for (size_t j = 0; j < length; j++) {
+        appendUtf8(value, reader.u8(offset + j));
+      }
+    }
+
+    bestName = std::move(value);
+    bestScore = score;
+  }
+  return bestName;
+}
+
+} // namespace
+
+FontFace::Shared FontFace::loadFromFile(const std::string& path) {
+  auto stream = std::ifstream(path, std::ios::binary);
+  if (!stream) {
+    return nullptr;
+  }
+
+  auto data = std::vector<uint8_t>(
+      std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  return loadFromData(std::move(data));
+}
+
+FontFace::Shared FontFace::loadFromData(std::vector<uint8_t> data) {
+  auto face = std::shared_ptr<FontFace>(new FontFace());
+  if (!face->parse(data)) {
+    return nullptr;
+  }
+  return face;
+}
+
+FontFace::Shared FontFace::fallback() {
+  static auto face = []() {
+    auto face = std::shared_ptr<FontFace>(new FontFace());
+    face->familyName_ = "";
+    face->unitsPerEm_ = 1000;
+    face->ascender_ = 930;
+    face->descender_ = -240;
+    face->lineGap_ = 0;
+    face->capHeight_ = 700;
+    face->xHeight_ = 520;
+    face->fallbackAdvance_ = 550;
+    face->asciiAdvances_.fill(face->fallbackAdvance_);
+    return face;
+  }();
+  return face;
+}
+
+bool FontFace::parse(const std::vector<uint8_t>& data) {
+  auto reader = FontDataReader{data};
+
+  auto version = reader.u32(0);
+  if (version != 0x00010000 && version != tag("OTTO") &&
+      version != tag("true")) {
+    // Font collections (`ttcf`) and other formats are not supported.
+    return false;
+  }
+
+  auto head = findTable(reader, tag("head"));
+  auto hhea = findTable(reader, tag("hhea"));
+  auto hmtx = findTable(reader, tag("hmtx"));
+  auto maxp = findTable(reader, tag("maxp"));
+  auto cmap = findTable(reader, tag("cmap"));
+  if (!head || !hhea || !hmtx || !maxp || !cmap) {
+    return false;
+  }
+
+  if (reader.u32(head->offset + 12) != 0x5F0F3CF5) {
+    return false;
+  }
+  unitsPerEm_ = reader.u16(head->offset + 18);
+  if (unitsPerEm_ == 0) {
+    return false;
+  }
+  italic_ = (reader.u16(head->offset + 44) & 0x2) != 0;
+
+  ascender_ = reader.i16(hhea->offset + 4);
+  descender_ = reader.i16(hhea->offset + 6);
+  lineGap_ = reader.i16(hhea->offset + 8);
+  auto numberOfHMetrics = reader.u16(hhea->offset + 34);
+  auto numGlyphs = reader.u16(maxp->offset + 4);
+  if (numberOfHMetrics == 0 || numberOfHMetrics > numGlyphs ||
+      hmtx->length < numberOfHMetrics * 4u) {
+    return false;
+  }
+
+  glyphAdvances_.resize(numGlyphs);
+  for (size_t glyph = 0; glyph < numGlyphs; glyph++) {
+    // Glyphs past `numberOfHMetrics` share the last advance.
+    auto metric = std::min<size_t>(glyph, numberOfHMetrics - 1);
+    glyphAdvances_[glyph] = reader.u16(hmtx->offset + metric * 4);
+  }
+
+  capHeight_ = static_cast<int16_t>(ascender_ * 0.7);
+  xHeight_ = static_cast<int16_t>(ascender_ * 0.5);
+  if (auto os2 = findTable(reader, tag("OS/2"))) {
+    weight_ = reader.u16(os2->offset + 4);
+    italic_ = italic_ || (reader.u16(os2->offset + 62) & 0x1) != 0;
+    if (reader.u16(os2->offset) >= 2 && os2->length >= 90) {
+      xHeight_ = reader.i16(os2->offset + 86);
+      capHeight_ = reader.i16(os2->offset + 88);
+    }
+  }
+
+  if (auto name = findTable(reader, tag("name"))) {
+    familyName_ = readFamilyName(reader, *name);
+  }
+
+  // Picking the best Unicode subtable: full repertoire (format 12) first,
+  // then BMP (format 4).
+  auto subtableCount = reader.u16(cmap->offset + 2);
+  auto bestSubtable = std::optional<size_t>{};
+  auto bestFormat = uint16_t{0};
+  for (size_t i = 0; i < subtableCount; i++) {
+    auto record = cmap->offset + 4 + i * 8;
+    auto platformId = reader.u16(record);
+    auto encodingId = reader.u16(record + 2);
+    auto offset = cmap->offset + reader.u32(record + 4);
+    auto isUnicode = platformId == 0 ||
+        (platformId == 3 && (encodingId == 1 || encodingId == 10));
+    auto format = reader.u16(offset);
+    if (!isUnicode || (format != 4 && format != 12)) {
+      continue;
+    }
+    if (!bestSubtable || format > bestFormat) {
+      bestSubtable = offset;
+      bestFormat = format;
+    }
+  }
+
+  if (!bestSubtable) {
+    return false;
+  }
+
+  auto subtable = *bestSubtable;
+  if (bestFormat == 12) {
+    auto groupCount = reader.u32(subtable + 12);
+    if (!reader.contains(subtable + 16, size_t{groupCount} * 12)) {
+      return false;
+    }
+    characterRanges_.reserve(groupCount);
+    for (size_t i = 0; i < groupCount; i++) {
+      auto group = subtable + 16 + i * 12;
+      auto start = static_cast<char32_t>(reader.u32(group));
+      auto end = static_cast<char32_t>(reader.u32(group + 4));
+      auto startGlyph = static_cast<int64_t>(reader.u32(group + 8));
+      characterRanges_.push_back(
+          {start,
+           end,
+           static_cast<int32_t>(startGlyph - static_cast<int64_t>(start)),
+           -1});
+    }
+  } else {
+    auto segmentCount = size_t{reader.u16(subtable + 6)} / 2;
+    auto endCodes = subtable + 14;
+    auto startCodes = endCodes + segmentCount * 2 + 2;
+    auto idDeltas = startCodes + segmentCount * 2;
+    auto idRangeOffsets = idDeltas + segmentCount * 2;
+    auto glyphIdArray = idRangeOffsets + segmentCount * 2;
+    auto subtableEnd = subtable + reader.u16(subtable + 2);
+
+    for (size_t i = glyphIdArray; i + 1 < subtableEnd; i += 2) {
+      glyphIdArray_.push_back(reader.u16(i));
+    }
+
+    characterRanges_.reserve(segmentCount);
+    for (size_t i = 0; i < segmentCount; i++) {
+      auto start = reader.u16(startCodes + i * 2);
+      auto end = reader.u16(endCodes + i * 2);
+      auto idDelta = reader.i16(idDeltas + i * 2);
+      auto idRangeOffset = reader.u16(idRangeOffsets + i * 2);
+      if (start == 0xFFFF) {
+        continue;
+      }
+      auto glyphArrayIndex = idRangeOffset == 0
+          ? -1
+          : static_cast<int32_t>(i + idRangeOffset / 2 - segmentCount);
+      characterRanges_.push_back({start, end, idDelta, glyphArrayIndex});
+    }
+  }
+
+  std::sort(
+      characterRanges_.begin(),
+      characterRanges_.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.start < rhs.start; });
+
+  if (reader.failed()) {
+    return false;
+  }
+
+  for (char32_t codePoint = 0; codePoint < asciiAdvances_.size();
+       codePoint++) {
+    asciiAdvances_[codePoint] = glyphAdvances_[glyphIndex(codePoint)];
+  }
+
+  return true;
+}
+
+uint16_t FontFace::glyphIndex(char32_t codePoint) const {
+  auto range = std::upper_bound(
+      characterRanges_.begin(),
+      characterRanges_.end(),
+      codePoint,
+      [](char32_t value, const auto& range) { return value < range.start; });
+  if (range == characterRanges_.begin()) {
+    return 0;
+  }
+  range--;
+  if (codePoint > range->end) {
+    return 0;
+  }
+
+  auto glyph = uint32_t{0};
+  if (range->glyphArrayIndex < 0) {
+    glyph = (static_cast<int64_t>(codePoint) + range->delta) & 0xFFFF;
+  } else {
+    auto index = range->glyphArrayIndex + (codePoint - range->start);
+    if (index >= glyphIdArray_.size() || glyphIdArray_[index] == 0) {
+      return 0;
+    }
+    glyph = (glyphIdArray_[index] + range->delta) & 0xFFFF;
+  }
+
+  return glyph < glyphAdvances_.size() ? static_cast<uint16_t>(glyph) : 0;
+}
+
+const std::string& FontFace::getFamilyName() const {
+  return familyName_;
+}
+
+int FontFace::getWeight() const {
+  return weight_;
+}
+
+bool FontFace::isItalic() const {
+  return italic_;
+}
+
+bool FontFace::hasGlyph(char32_t codePoint) const {
+  return fallbackAdvance_ != 0 || glyphIndex(codePoint) != 0;
+}
+
+uint16_t FontFace::advanceInFontUnits(char32_t codePoint) const {
+  if (codePoint < asciiAdvances_.size()) {
+    return asciiAdvances_[codePoint];
+  }
+
+  if (fallbackAdvance_ != 0) {
+    return fallbackAdvance_;
+  }
+
+  std::lock_guard<std::mutex> lock(advanceCacheMutex_);
+  auto iterator = advanceCache_.find(codePoint);
+  if (iterator != advanceCache_.end()) {
+    return iterator->second;
+  }
+
+  auto advance = glyphAdvances_[glyphIndex(codePoint)];
+  advanceCache_.emplace(codePoint, advance);
+  return advance;
+}
+
+Float FontFace::getAdvance(char32_t codePoint, Float fontSize) const {
+  return advanceInFontUnits(codePoint) * fontSize / unitsPerEm_;
+}
+
+Float FontFace::getAscender(Float fontSize) const {
+  return ascender_ * fontSize / unitsPerEm_;
+}
+
+Float FontFace::getDescender(Float fontSize) const {
+  return descender_ * fontSize / unitsPerEm_;
+}
+
+Float FontFace::getLineGap(Float fontSize) const {
+  return lineGap_ * fontSize / unitsPerEm_;
+}
+
+Float FontFace::getCapHeight(Float fontSize) const {
+  return capHeight_ * fontSize / unitsPerEm_;
+}
+
+Float FontFace::getXHeight(Float fontSize) const {
+  return xHeight_ * fontSize / unitsPerEm_;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+/*
+ * Horizontal metrics of a single TrueType/OpenType font face, read directly
+ * from the `head`, `hhea`, `hmtx`, `maxp`, `cmap`, `OS/2` and `name` tables
+ * of a local font file. Only what's needed to measure text is loaded: glyph
+ * advances, vertical metrics and the family/weight/style used for font
+ * matching. No glyph outlines, kerning or complex shaping.
+ *
+ * Advances of ASCII characters are precomputed; advances of other characters
+ * are cached on first use. All methods can be called from any thread.
+ */
+class FontFace final {
+ public:
+  using Shared = std::shared_ptr<const FontFace>;
+
+  /*
+   * Loads a face from a `.ttf` or `.otf` file.
+   * Returns `nullptr` if the file can't be read or isn't a supported font.
+   */
+  static Shared loadFromFile(const std::string& path);
+
+  /*
+   * Loads a face from the raw contents of a font file.
+   * Returns `nullptr` if the data isn't a supported font.
+   */
+  static Shared loadFromData(std::vector<uint8_t> data);
+
+  /*
+   * A face with synthetic metrics used when no font file matches. Every
+   * character advances by a fixed fraction of the font size, so layout is
+   * still deterministic.
+   */
+  static Shared fallback();
+
+  const std::string& getFamilyName() const;
+  int getWeight() const;
+  bool isItalic() const;
+
+  /*
+   * Returns `true` if the face has a glyph for the given code point.
+   */
+  bool hasGlyph(char32_t codePoint) const;
+
+  /*
+   * Returns the horizontal advance of a code point for a given font size.
+   */
+  Float getAdvance(char32_t codePoint, Float fontSize) const;
+
+  /*
+   * Vertical metrics for a given font size. `descender` is negative, as in
+   * the font file.
+   */
+  Float getAscender(Float fontSize) const;
+  Float getDescender(Float fontSize) const;
+  Float getLineGap(Float fontSize) const;
+  Float getCapHeight(Float fontSize) const;
+  Float getXHeight(Float fontSize) const;
+
+ private:
+  FontFace() = default;
+
+  bool parse(const std::vector<uint8_t>& data);
+  uint16_t glyphIndex(char32_t codePoint) const;
+  uint16_t advanceInFontUnits(char32_t codePoint) const;
+
+  std::string familyName_{};
+  int weight_{400};
+  bool italic_{false};
+
+  // Metrics in font units.
+  uint16_t unitsPerEm_{1000};
+  int16_t ascender_{800};
+  int16_t descender_{-200};
+  int16_t lineGap_{0};
+  int16_t capHeight_{700};
+  int16_t xHeight_{500};
+
+  // Advance of every glyph, indexed by glyph id.
+  std::vector<uint16_t> glyphAdvances_{};
+
+  struct CharacterRange {
+    char32_t start;
+    char32_t end;
+    // Added to the code point (modulo 65536) to get the glyph id.
+    int32_t delta;
+    // Index in `glyphIdArray_` of the glyph id of `start`, or -1 if glyph
+    // ids are computed with `delta` only.
+    int32_t glyphArrayIndex;
+  };
+
+  // Sorted, non-overlapping ranges from the best `cmap` subtable.
+  std::vector<CharacterRange> characterRanges_{};
+  std::vector<uint16_t> glyphIdArray_{};
+
+  std::array<uint16_t, 128> asciiAdvances_{};
+  mutable std::unordered_map<char32_t, uint16_t> advanceCache_;
+  mutable std::mutex advanceCacheMutex_;
+
+  // Fixed advance (in font units) of the synthetic fallback face.
+  uint16_t fallbackAdvance_{0};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontRegistry.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+
+namespace facebook::react {
+
+namespace {
+
+std::string toLower(std::string string) {
+  std::transform(string.begin(), string.end(), string.begin(), [](auto c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  });
+  return string;
+}
+
+std::string canonicalPath(const std::string& path) {
+  auto errorCode = std::error_code{};
+  auto canonicalPath = std::filesystem::weakly_canonical(path, errorCode);
+  return errorCode ? path : canonicalPath.string();
+}
+
+bool isFontFile(const std::filesystem::path& path) {
+  auto extension = toLower(path.extension().string());
+  return extension == ".ttf" || extension == ".otf";
+}
+
+/*
+ * Lower is better. Style mismatches always lose against weight mismatches.
+ */
+int matchDistance(const FontFace& fontFace, int weight, bool italic) {
+  auto distance = std::abs(fontFace.getWeight() - weight);
+  // For light weights, lighter faces are preferred; for bold weights, bolder
+  // ones.
+  auto preferLighter = weight <= 400;
+  if (preferLighter ? fontFace.getWeight() > weight
+                    : fontFace.getWeight() < weight) {
+    distance += 1000;
+  }
+  if (fontFace.isItalic() != italic) {
+    distance += 10000;
+  }
+  return distance;
+}
+
+} // namespace
+
+FontRegistry& FontRegistry::shared() {
+  static auto& registry = *new FontRegistry();
+  return registry;
+}
+
+bool FontRegistry::insertRegisteredPath(const std::string& path) {
+  std::unique_lock lock(mutex_);
+  return registeredPaths_.insert(path).second;
+}
+
+bool FontRegistry::registerFontFile(const std::string& path) {
+  auto fontFace = FontFace::loadFromFile(path);
+  if (!fontFace || !insertRegisteredPath(canonicalPath(path))) {
+    return false;
+  }
+  registerFontFace(std::move(fontFace));
+  return true;
+}
+
+size_t FontRegistry::registerFontDirectory(const std::string& path) {
+  auto errorCode = std::error_code{};
+  auto iterator = std::filesystem::recursive_directory_iterator(
+      path,
+      std::filesystem::directory_options::skip_permission_denied,
+      errorCode);
+  if (errorCode || !insertRegisteredPath(canonicalPath(path))) {
+    return 0;
+  }
+
+  // Sorting makes the default family deterministic.
+  auto paths = std::vector<std::filesystem::path>{};
+  for (const auto& entry : iterator) {
+    if (entry.is_regular_file(errorCode) && isFontFile(entry.path())) {
+      paths.push_back(entry.path());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+
+  auto count = size_t{0};
+  for (const auto& fontPath : paths) {
+    count += registerFontFile(fontPath.string()) ? 1 : 0;
+  }
+  return count;
+}
+
+void FontRegistry::registerFontFace(FontFace::Shared fontFace) {
+  std::unique_lock lock(mutex_);
+  if (defaultFamilyName_.empty()) {
+    defaultFamilyName_ = toLower(fontFace->getFamilyName());
+  }
+  fontFaces_.push_back(std::move(fontFace));
+  matchCache_.clear();
+  fallbackCache_.clear();
+  generation_++;
+}
+
+void FontRegistry::setDefaultFamilyName(const std::string& familyName) {
+  std::unique_lock lock(mutex_);
+  defaultFamilyName_ = toLower(familyName);
+  matchCache_.clear();
+  generation_++;
+}
+
+size_t FontRegistry::getGeneration() const {
+  return generation_;
+}
+
+FontFace::Shared FontRegistry::getFontFace(
+    const std::string& familyName,
+    int weight,
+    bool italic) const {
+  auto key = toLower(familyName) + '\0' + std::to_string(weight) +
+      (italic ? "i" : "n");
+  {
+    std::shared_lock lock(mutex_);
+    auto iterator = matchCache_.find(key);
+    if (iterator != matchCache_.end()) {
+      return iterator->second;
+    }
+  }
+
+  std::unique_lock lock(mutex_);
+  auto familyNames = {toLower(familyName), defaultFamilyName_};
+  auto bestMatch = FontFace::Shared{};
+  for (const auto& candidateFamilyName : familyNames) {
+    auto bestDistance = std::numeric_limits<int>::max();
+    for (const auto& fontFace : fontFaces_) {
+      if (toLower(fontFace->getFamilyName()) != candidateFamilyName) {
+        continue;
+      }
+      auto distance = matchDistance(*fontFace, weight, italic);
+      if (distance < bestDistance) {
+        bestMatch = fontFace;
+        bestDistance = distance;
+      }
+    }
+    if (bestMatch) {
+      break;
+    }
+  }
+
+  if (!bestMatch) {
+    bestMatch = fontFaces_.empty() ? FontFace::fallback() : fontFaces_.front();
+  }
+
+  matchCache_.emplace(std::move(key), bestMatch);
+  return bestMatch;
+}
+
+FontFace::Shared FontRegistry::getFallbackFontFace(char32_t codePoint) const {
+  {
+    std::shared_lock lock(mutex_);
+    auto iterator = fallbackCache_.find(codePoint);
+    if (iterator != fallbackCache_.end()) {
+      return iterator->second;
+    }
+  }
+
+  std::unique_lock lock(mutex_);
+  auto match = FontFace::Shared{};
+  for (const auto& fontFace : fontFaces_) {
+    if (fontFace->hasGlyph(codePoint)) {
+      match = fontFace;
+      break;
+    }
+  }
+
+  fallbackCache_.emplace(codePoint, match);
+  return match;
+}
+
+} // namespace facebook::react
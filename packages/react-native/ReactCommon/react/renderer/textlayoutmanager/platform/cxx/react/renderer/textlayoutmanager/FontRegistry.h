@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <react/renderer/textlayoutmanager/FontFace.h>
+
+namespace facebook::react {
+
+/*
+ * Set of font faces available to the cxx text layout, loaded from local font
+ * files. Faces are matched by family name, weight and style the same way CSS
+ * font matching does it: same family and style first, then the closest
+ * weight.
+ *
+ * If nothing is registered, every lookup returns `FontFace::fallback()`.
+ * All methods can be called from any thread.
+ */
+class FontRegistry final {
+ public:
+  /*
+   * Key of a `std::vector<std::string>` of font directories in the
+   * `ContextContainer`. `TextLayoutManager` registers all fonts found in
+   * them.
+   */
+  static constexpr const char* ContextContainerKey = "FontDirectories";
+
+  /*
+   * Returns the process-wide registry.
+   */
+  static FontRegistry& shared();
+
+  /*
+   * Registers a single `.ttf` or `.otf` file.
+   * Returns `false` if the file isn't a supported font or was already
+   * registered.
+   */
+  bool registerFontFile(const std::string& path);
+
+  /*
+   * Registers all font files found in a directory and its subdirectories.
+   * A directory that was already registered is not scanned again.
+   * Returns the number of newly registered faces.
+   */
+  size_t registerFontDirectory(const std::string& path);
+
+  void registerFontFace(FontFace::Shared fontFace);
+
+  /*
+   * Family used when the requested one isn't registered. Defaults to the
+   * family of the first registered face.
+   */
+  void setDefaultFamilyName(const std::string& familyName);
+
+  /*
+   * Returns the best matching face. Never returns `nullptr`.
+   */
+  FontFace::Shared getFontFace(
+      const std::string& familyName,
+      int weight,
+      bool italic) const;
+
+  /*
+   * Returns the first registered face that has a glyph for a code point, or
+   * `nullptr` if there is none. Used for characters missing from the matched
+   * face.
+   */
+  FontFace::Shared getFallbackFontFace(char32_t codePoint) const;
+
+  /*
+   * Incremented every time the result of a lookup may change, i.e. when a
+   * face is registered or the default family changes. Lets clients drop
+   * their own caches of resolved faces and measured text.
+   */
+  size_t getGeneration() const;
+
+ private:
+  /*
+   * Marks a canonical path as registered. Returns `false` if it already was.
+   */
+  bool insertRegisteredPath(const std::string& path);
+
+  std::vector<FontFace::Shared> fontFaces_;
+  std::string defaultFamilyName_;
+  std::unordered_set<std::string> registeredPaths_;
+  std::atomic<size_t> generation_{0};
+
+  mutable std::unordered_map<std::string, FontFace::Shared> matchCache_;
+  mutable std::unordered_map<char32_t, FontFace::Shared> fallbackCache_;
+  mutable std::shared_mutex mutex_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "LineBreaker.h"
+
+namespace facebook::react {
+
+namespace {
+
+bool isInRange(char32_t codePoint, char32_t first, char32_t last) {
+  return codePoint >= first && codePoint <= last;
+}
+
+} // namespace
+
+LineBreakClass getLineBreakClass(char32_t codePoint) {
+  if (codePoint < 0x80) {
+    switch (codePoint) {
+      case '\n':
+        return LineBreakClass::LF;
+      case '\r':
+        return LineBreakClass::CR;
+      case '\v':
+      case '\f':
+        return LineBreakClass::BK;
+      case ' ':
+        return LineBreakClass::SP;
+      case '\t':
+        return LineBreakClass::BA;
+      case '-':
+        return LineBreakClass::HY;
+      case '(':
+      case '[':
+      case '{':
+        return LineBreakClass::OP;
+      case ')':
+      case ']':
+        return LineBreakClass::CP;
+      case '}':
+        return LineBreakClass::CL;
+      case '!':
+      case '?':
+        return LineBreakClass::EX;
+      case ',':
+      case '.':
+      case ':':
+      case ';':
+        return LineBreakClass::IS;
+      default:
+        return LineBreakClass::AL;
+    }
+  }
+
+  switch (codePoint) {
+    case 0x0085: // Next line
+    case 0x2028: // Line separator
+    case 0x2029: // Paragraph separator
+      return LineBreakClass::BK;
+    case 0x200B:
+      return LineBreakClass::ZW;
+    case 0x00A0:
+    case 0x2007:
+    case 0x2011:
+    case 0x202F:
+    case 0x2060:
+    case 0xFEFF:
+      return LineBreakClass::GL;
+    case 0x00AD:
+    case 0x1680:
+    case 0x2010:
+    case 0x2012:
+    case 0x2013:
+    case 0x2027:
+      return LineBreakClass::BA;
+    case 0x2018:
+    case 0x201C:
+    case 0x3008:
+    case 0x300A:
+    case 0x300C:
+    case 0x300E:
+    case 0x3010:
+    case 0xFF08:
+    case 0xFF3B:
+    case 0xFF5B:
+      return LineBreakClass::OP;
+    case 0x2019:
+    case 0x201D:
+    case 0x3001:
+    case 0x3002:
+    case 0x3009:
+    case 0x300B:
+    case 0x300D:
+    case 0x300F:
+    case 0x3011:
+    case 0xFF09:
+    case 0xFF0C:
+    case 0xFF0E:
+    case 0xFF3D:
+    case 0xFF5D:
+      return LineBreakClass::CL;
+    case 0xFF01:
+    case 0xFF1F:
+      return LineBreakClass::EX;
+    case 0x3005:
+    case 0x303B:
+    case 0x309D:
+    case 0x309E:
+    case 0x30FC:
+    case 0x30FD:
+    case 0x30FE:
+      return LineBreakClass::NS;
+    case 0x200D:
+      return LineBreakClass::CM;
+    default:
+      break;
+  }
+
+  if (isInRange(codePoint, 0x2000, 0x2006) ||
+      isInRange(codePoint, 0x2008, 0x200A)) {
+    return LineBreakClass::BA;
+  }
+
+  if (isInRange(codePoint, 0x0300, 0x036F) ||
+      isInRange(codePoint, 0x0483, 0x0489) ||
+      isInRange(codePoint, 0x0591, 0x05BD) ||
+      isInRange(codePoint, 0x064B, 0x065F) ||
+      isInRange(codePoint, 0x1AB0, 0x1AFF) ||
+      isInRange(codePoint, 0x1DC0, 0x1DFF) ||
+      isInRange(codePoint, 0x20D0, 0x20FF) ||
+      isInRange(codePoint, 0x3099, 0x309A) ||
+      isInRange(codePoint, 0xFE00, 0xFE0F) ||
+      isInRange(codePoint, 0xFE20, 0xFE2F) ||
+      isInRange(codePoint, 0x1F3FB, 0x1F3FF) ||
+      isInRange(codePoint, 0xE0020, 0xE007F) ||
+      isInRange(codePoint, 0xE0100, 0xE01EF)) {
+    return LineBreakClass::CM;
+  }
+
+  // Small kana are non-starters.
+  if (codePoint == 0x3041 || codePoint == 0x3043 || codePoint == 0x3045 ||
+      codePoint == 0x3047 || codePoint == 0x3049 || codePoint == 0x3063 ||
+      codePoint == 0x3083 || codePoint == 0x3085 || codePoint == 0x3087 ||
+      codePoint == 0x30A1 || codePoint == 0x30A3 || codePoint == 0x30A5 ||
+      codePoint == 0x30A7 || codePoint == 0x30A9 || codePoint == 0x30C3 ||
+      codePoint == 0x30E3 || codePoint == 0x30E5 || codePoint == 0x30E7) {
+    return LineBreakClass::NS;
+  }
+
+  if (isInRange(codePoint, 0x1100, 0x115F) || // Hangul Jamo
+      isInRange(codePoint, 0x2E80, 0x2FFF) || // CJK radicals
+      isInRange(codePoint, 0x3040, 0x30FF) || // Hiragana, Katakana
+      isInRange(codePoint, 0x3130, 0x318F) || // Hangul compatibility Jamo
+      isInRange(codePoint, 0x3190, 0x4DBF) || // CJK misc, extension A
+      isInRange(codePoint, 0x4E00, 0x9FFF) || // CJK unified ideographs
+      isInRange(codePoint, 0xA960, 0xA97F) || // Hangul Jamo extended A
+      isInRange(codePoint, 0xAC00, 0xD7A3) || // Hangul syllables
+      isInRange(codePoint, 0xF900, 0xFAFF) || // CJK compatibility
+      isInRange(codePoint, 0xFF10, 0xFF19) || // Fullwidth digits
+      isInRange(codePoint, 0xFF21, 0xFF3A) || // Fullwidth Latin
+      isInRange(codePoint, 0xFF41, 0xFF5A) ||
+      isInRange(codePoint, 0x1F000, 0x1FAFF) || // Emoji and pictographs
+      isInRange(codePoint, 0x20000, 0x3FFFD)) { // CJK extensions B-H
+    return LineBreakClass::ID;
+  }
+
+  return LineBreakClass::AL;
+}
+
+std::vector<LineBreakOpportunity> findLineBreakOpportunities(
+    const std::vector<char32_t>& codePoints) {
+  auto size = codePoints.size();
+  auto opportunities =
+      std::vector<LineBreakOpportunity>(size, LineBreakOpportunity::None);
+  if (size == 0) {
+    return opportunities;
+  }
+
+  // LB9, LB10: combining marks take the class of their base character, or
+  // act as `AL` if there is none.
+  auto classes = std::vector<LineBreakClass>(size);
+  for (size_t i = 0; i < size; i++) {
+    auto lineBreakClass = getLineBreakClass(codePoints[i]);
+    if (lineBreakClass == LineBreakClass::CM) {
+      auto base = i > 0 ? classes[i - 1] : LineBreakClass::AL;
+      auto isBreakingBase = base == LineBreakClass::BK ||
+          base == LineBreakClass::CR || base == LineBreakClass::LF ||
+          base == LineBreakClass::SP || base == LineBreakClass::ZW;
+      lineBreakClass = isBreakingBase ? LineBreakClass::AL : base;
+    }
+    classes[i] = lineBreakClass;
+  }
+
+  // Class of the last character before the current run of spaces.
+  auto beforeSpaces = classes[0];
+
+  for (size_t i = 0; i + 1 < size; i++) {
+    auto before = classes[i];
+    auto after = classes[i + 1];
+    if (before != LineBreakClass::SP) {
+      beforeSpaces = before;
+    }
+
+    auto opportunity = [&]() {
+      // LB4, LB5: always break after hard line breaks, but never inside CR LF.
+      if (before == LineBreakClass::CR) {
+        return after == LineBreakClass::LF ? LineBreakOpportunity::None
+                                           : LineBreakOpportunity::Mandatory;
+      }
+      if (before == LineBreakClass::BK || before == LineBreakClass::LF) {
+        return LineBreakOpportunity::Mandatory;
+      }
+      // LB6, LB7: never break before hard line breaks, spaces or ZW.
+      if (after == LineBreakClass::BK || after == LineBreakClass::CR ||
+          after == LineBreakClass::LF || after == LineBreakClass::SP ||
+          after == LineBreakClass::ZW) {
+        return LineBreakOpportunity::None;
+      }
+      // LB8: break after ZW, even if followed by spaces.
+      if (beforeSpaces == LineBreakClass::ZW) {
+        return LineBreakOpportunity::Allowed;
+      }
+      // LB8a, LB9: never break after ZWJ or before combining marks.
+      if (codePoints[i] == 0x200D ||
+          getLineBreakClass(codePoints[i + 1]) == LineBreakClass::CM) {
+        return LineBreakOpportunity::None;
+      }
+      // LB11, LB12, LB12a: never break around glue, unless it follows a space
+      // or a hyphen.
+      if (before == LineBreakClass::GL ||
+          (after == LineBreakClass::GL && before != LineBreakClass::SP &&
+           before != LineBreakClass::BA && before != LineBreakClass::HY)) {
+        return LineBreakOpportunity::None;
+      }
+      // LB13: never break before closing punctuation, even after spaces.
+      if (after == LineBreakClass::CL || after == LineBreakClass::CP ||
+          after == LineBreakClass::EX || after == LineBreakClass::IS) {
+        return LineBreakOpportunity::None;
+      }
+      // LB14: never break after opening punctuation, even after spaces.
+      if (beforeSpaces == LineBreakClass::OP) {
+        return LineBreakOpportunity::None;
+      }
+      // LB18: break after spaces.
+      if (before == LineBreakClass::SP) {
+        return LineBreakOpportunity::Allowed;
+      }
+      // LB21: never break before hyphens and non-starters.
+      if (after == LineBreakClass::BA || after == LineBreakClass::HY ||
+          after == LineBreakClass::NS) {
+        return LineBreakOpportunity::None;
+      }
+      // LB20.1: never break after a hyphen that starts a word.
+      if (before == LineBreakClass::HY && after == LineBreakClass::AL &&
+          (i == 0 || classes[i - 1] == LineBreakClass::SP ||
+           classes[i - 1] == LineBreakClass::BK ||
+           classes[i - 1] == LineBreakClass::LF ||
+           classes[i - 1] == LineBreakClass::ZW)) {
+        return LineBreakOpportunity::None;
+      }
+      // LB31: break everywhere else, except between alphanumeric characters
+      // and their punctuation (LB23-LB30).
+      if (before == LineBreakClass::ID || after == LineBreakClass::ID ||
+          before == LineBreakClass::BA || before == LineBreakClass::HY ||
+          before == LineBreakClass::CL) {
+        return LineBreakOpportunity::Allowed;
+      }
+      return LineBreakOpportunity::None;
+    }();
+
+    opportunities[i] = opportunity;
+  }
+
+  // LB3: always break at the end of text.
+  opportunities[size - 1] = LineBreakOpportunity::Mandatory;
+  return opportunities;
+}
+
+} // namespace facebook::react
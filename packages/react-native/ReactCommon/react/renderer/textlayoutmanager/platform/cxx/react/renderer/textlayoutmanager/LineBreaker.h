@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Line breaking classes from Unicode Standard Annex #14 that the cxx text
+ * layout distinguishes. Everything else is treated as `AL` (alphabetic).
+ */
+enum class LineBreakClass : uint8_t {
+  AL, // Alphabetic and everything not listed below.
+  BK, // Mandatory break: line/paragraph separators, form feed.
+  CR, // Carriage return.
+  LF, // Line feed.
+  SP, // Space.
+  ZW, // Zero width space.
+  GL, // Non-breaking ("glue"), including word joiners.
+  BA, // Break after: tab, dashes, soft hyphen, spaces other than U+0020.
+  HY, // Hyphen-minus.
+  OP, // Opening punctuation.
+  CL, // Closing punctuation, including CJK full stops and commas.
+  CP, // Closing parenthesis.
+  EX, // Exclamation/interrogation.
+  IS, // Infix numeric separators.
+  NS, // Non-starters: small kana, iteration marks.
+  ID, // Ideographs, kana, Hangul and emoji: break on either side.
+  CM, // Combining marks, ZWJ and variation selectors.
+};
+
+enum class LineBreakOpportunity : uint8_t {
+  None,
+  Allowed,
+  Mandatory,
+};
+
+LineBreakClass getLineBreakClass(char32_t codePoint);
+
+/*
+ * Returns, for every code point, whether a line can or must be broken right
+ * after it. The text always has a mandatory break at its end.
+ *
+ * This implements the pair rules of UAX #14 (LB4-LB21, LB20.1 and LB31) for
+ * the classes above; numeric, quotation and regional indicator rules are not
+ * applied.
+ */
+std::vector<LineBreakOpportunity> findLineBreakOpportunities(
+    const std::vector<char32_t>& codePoints);
+
+} // namespace facebook::react
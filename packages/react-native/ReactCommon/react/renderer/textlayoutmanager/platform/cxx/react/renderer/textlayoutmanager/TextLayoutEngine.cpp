@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextLayoutEngine.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr auto kDefaultFontSize = Float{14};
+
+// Tolerance for floating point errors accumulated while summing advances.
+constexpr auto kWidthEpsilon = Float{0.001};
+
+constexpr auto kReplacementCharacter = char32_t{0xFFFD};
+constexpr auto kObjectReplacementCharacter = char32_t{0xFFFC};
+
+/*
+ * Decodes UTF-8, replacing invalid sequences with U+FFFD.
+ */
+void decodeUtf8(
+    const std::string& string,
+    std::vector<char32_t>& codePoints,
+    std::vector<uint32_t>& byteOffsets) {
+  codePoints.reserve(string.size());
+  byteOffsets.reserve(string.size());
+
+  auto size = string.size();
+  auto i = size_t{0};
+  while (i < size) {
+    auto byte = static_cast<uint8_t>(string[i]);
+    auto length = size_t{1};
+    auto codePoint = kReplacementCharacter;
+    if (byte < 0x80) {
+      codePoint = byte;
+    } else if (byte >= 0xC2 && byte < 0xF5) {
+      auto expectedLength =
+          static_cast<size_t>(byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4);
+      auto leadingBitsMask = expectedLength == 2 ? 0x1F
+          : expectedLength == 3                ? 0x0F
+                                               : 0x07;
+      auto value = static_cast<char32_t>(byte & leadingBitsMask);
+      auto valid = i + expectedLength <= size;
+      for (size_t j = 1; valid && j < expectedLength; j++) {
+        auto continuation = static_cast<uint8_t>(string[i + j]);
+        valid = (continuation & 0xC0) == 0x80;
+        value = (value << 6) | (continuation & 0x3F);
+      }
+      // Rejecting overlong encodings, surrogates and out of range values.
+      auto minimumValue = expectedLength == 2 ? 0x80
+          : expectedLength == 3                ? 0x800
+                                               : 0x10000;
+      valid = valid && value >= static_cast<char32_t>(minimumValue) &&
+          value <= 0x10FFFF && (value < 0xD800 || value > 0xDFFF);
+      if (valid) {
+        codePoint = value;
+        length = expectedLength;
+      }
+    }
+
+    codePoints.push_back(codePoint);
+    byteOffsets.push_back(static_cast<uint32_t>(i));
+    i += length;
+  }
+}
+
+bool isHangingWhitespace(char32_t codePoint) {
+  switch (getLineBreakClass(codePoint)) {
+    case LineBreakClass::SP:
+    case LineBreakClass::BK:
+    case LineBreakClass::CR:
+    case LineBreakClass::LF:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool isZeroWidth(char32_t codePoint) {
+  switch (getLineBreakClass(codePoint)) {
+    case LineBreakClass::BK:
+    case LineBreakClass::CR:
+    case LineBreakClass::LF:
+    case LineBreakClass::ZW:
+    case LineBreakClass::CM:
+      return true;
+    default:
+      return codePoint == 0x00AD || codePoint == 0x2060 ||
+          codePoint == 0xFEFF;
+  }
+}
+
+Float alignmentOffset(
+    TextAlignment alignment,
+    Float lineWidth,
+    Float containerWidth) {
+  if (!std::isfinite(containerWidth)) {
+    return 0;
+  }
+
+  switch (alignment) {
+    case TextAlignment::Center:
+      return (containerWidth - lineWidth) / 2;
+    case TextAlignment::Right:
+      return containerWidth - lineWidth;
+    default:
+      return 0;
+  }
+}
+
+} // namespace
+
+TextLayoutEngine::TextLayoutEngine(const FontRegistry& fontRegistry)
+    : fontRegistry_(fontRegistry),
+      fontRegistryGeneration_(fontRegistry.getGeneration()),
+      shapedTextCache_(kSimpleThreadSafeCacheSizeCap),
+      fragmentCache_(kSimpleThreadSafeCacheSizeCap * 4) {}
+
+std::shared_ptr<const TextLayoutEngine::ShapedFragment>
+TextLayoutEngine::shapeFragment(
+    const AttributedString::Fragment& fragment) const {
+  auto shapedFragment = std::make_shared<ShapedFragment>();
+  const auto& textAttributes = *fragment.textAttributes;
+
+  if (fragment.isAttachment()) {
+    auto size = fragment.parentShadowView.layoutMetrics.frame.size;
+    shapedFragment->codePoints = {kObjectReplacementCharacter};
+    shapedFragment->byteOffsets = {0};
+    shapedFragment->advances = {size.width};
+    shapedFragment->metrics.ascender = size.height;
+    shapedFragment->metrics.isAttachment = true;
+    return shapedFragment;
+  }
+
+  auto allowFontScaling = textAttributes.allowFontScaling.value_or(true);
+  auto fontSizeMultiplier =
+      allowFontScaling && !std::isnan(textAttributes.fontSizeMultiplier)
+      ? textAttributes.fontSizeMultiplier
+      : Float{1};
+  auto fontSize = std::isnan(textAttributes.fontSize)
+      ? kDefaultFontSize
+      : textAttributes.fontSize;
+  fontSize *= fontSizeMultiplier;
+  auto letterSpacing = std::isnan(textAttributes.letterSpacing)
+      ? Float{0}
+      : textAttributes.letterSpacing;
+  auto fontWeight = static_cast<int>(
+      textAttributes.fontWeight.value_or(FontWeight::Regular));
+  auto italic = textAttributes.fontStyle.value_or(FontStyle::Normal) !=
+      FontStyle::Normal;
+
+  auto fontFace =
+      fontRegistry_.getFontFace(textAttributes.fontFamily, fontWeight, italic);
+
+  decodeUtf8(
+      fragment.string,
+      shapedFragment->codePoints,
+      shapedFragment->byteOffsets);
+
+  auto& advances = shapedFragment->advances;
+  advances.reserve(shapedFragment->codePoints.size());
+  for (auto codePoint : shapedFragment->codePoints) {
+    if (isZeroWidth(codePoint)) {
+      advances.push_back(0);
+      continue;
+    }
+
+    const auto* glyphFontFace = fontFace.get();
+    if (!fontFace->hasGlyph(codePoint)) {
+      if (auto fallbackFontFace =
+              fontRegistry_.getFallbackFontFace(codePoint)) {
+        glyphFontFace = fallbackFontFace.get();
+      }
+    }
+    advances.push_back(
+        glyphFontFace->getAdvance(codePoint, fontSize) + letterSpacing);
+  }
+
+  auto& metrics = shapedFragment->metrics;
+  metrics.ascender = fontFace->getAscender(fontSize);
+  metrics.descender = -fontFace->getDescender(fontSize);
+  metrics.lineGap = fontFace->getLineGap(fontSize);
+  metrics.capHeight = fontFace->getCapHeight(fontSize);
+  metrics.xHeight = fontFace->getXHeight(fontSize);
+  metrics.lineHeight = textAttributes.lineHeight * fontSizeMultiplier;
+
+  return shapedFragment;
+}
+
+std::shared_ptr<const TextLayoutEngine::ShapedText> TextLayoutEngine::shape(
+    const AttributedString& attributedString) const {
+  auto fontRegistryGeneration = fontRegistry_.getGeneration();
+  if (fontRegistryGeneration_.exchange(fontRegistryGeneration) !=
+      fontRegistryGeneration) {
+    shapedTextCache_.clear();
+    fragmentCache_.clear();
+  }
+
+  return shapedTextCache_.get(
+      attributedString, [this](const AttributedString& attributedString) {
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry) {
+          telemetry->willMeasureText();
+        }
+
+        auto shapedText =
+            std::make_shared<const ShapedText>(shapeText(attributedString));
+
+        if (telemetry) {
+          telemetry->didMeasureText();
+        }
+
+        return shapedText;
+      });
+}
+
+TextLayoutEngine::ShapedText TextLayoutEngine::shapeText(
+    const AttributedString& attributedString) const {
+  auto shapedText = ShapedText{};
+  const auto& fragments = attributedString.getFragments();
+  shapedText.runs.reserve(fragments.size());
+
+  for (const auto& fragment : fragments) {
+    // Attachments are cheap to shape, and their size isn't part of the
+    // cache key hash.
+    auto shapedFragment = fragment.isAttachment()
+        ? shapeFragment(fragment)
+        : fragmentCache_.get(
+              fragment, [this](const AttributedString::Fragment& fragment) {
+                return shapeFragment(fragment);
+              });
+
+    auto byteOffset = static_cast<uint32_t>(shapedText.text.size());
+    auto run = shapedFragment->metrics;
+    run.start = shapedText.codePoints.size();
+    run.end = run.start + shapedFragment->codePoints.size();
+    shapedText.runs.push_back(run);
+
+    shapedText.text += fragment.string;
+    shapedText.codePoints.insert(
+        shapedText.codePoints.end(),
+        shapedFragment->codePoints.begin(),
+        shapedFragment->codePoints.end());
+    shapedText.advances.insert(
+        shapedText.advances.end(),
+        shapedFragment->advances.begin(),
+        shapedFragment->advances.end());
+    for (auto offset : shapedFragment->byteOffsets) {
+      shapedText.byteOffsets.push_back(byteOffset + offset);
+    }
+  }
+
+  shapedText.byteOffsets.push_back(
+      static_cast<uint32_t>(shapedText.text.size()));
+
+  const auto& codePoints = shapedText.codePoints;
+  const auto& advances = shapedText.advances;
+  auto breakOpportunities = findLineBreakOpportunities(codePoints);
+  auto segmentStart = size_t{0};
+  for (size_t i = 0; i < codePoints.size(); i++) {
+    if (breakOpportunities[i] == LineBreakOpportunity::None) {
+      continue;
+    }
+
+    auto segment = Segment{segmentStart, i + 1, i + 1};
+    while (segment.contentEnd > segment.start &&
+           isHangingWhitespace(codePoints[segment.contentEnd - 1])) {
+      segment.contentEnd--;
+    }
+    for (auto j = segment.start; j < segment.contentEnd; j++) {
+      segment.contentWidth += advances[j];
+    }
+    for (auto j = segment.contentEnd; j < segment.end; j++) {
+      segment.trailingWidth += advances[j];
+    }
+    segment.isMandatoryBreak =
+        breakOpportunities[i] == LineBreakOpportunity::Mandatory;
+
+    shapedText.segments.push_back(segment);
+    segmentStart = i + 1;
+  }
+
+  if (!fragments.empty()) {
+    shapedText.alignment = fragments.front().textAttributes->alignment.value_or(
+        TextAlignment::Natural);
+  }
+
+  return shapedText;
+}
+
+std::vector<TextLayoutEngine::Line> TextLayoutEngine::layout(
+    const ShapedText& shapedText,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maximumWidth) const {
+  auto lines = std::vector<Line>{};
+  const auto& codePoints = shapedText.codePoints;
+  const auto& advances = shapedText.advances;
+  const auto& runs = shapedText.runs;
+  auto size = codePoints.size();
+  if (size == 0) {
+    return lines;
+  }
+
+  auto maximumNumberOfLines = paragraphAttributes.maximumNumberOfLines > 0
+      ? static_cast<size_t>(paragraphAttributes.maximumNumberOfLines)
+      : std::numeric_limits<size_t>::max();
+  auto availableWidth = maximumWidth + kWidthEpsilon;
+
+  auto lineStart = size_t{0};
+  // Width of the line without trailing spaces, and width of those spaces.
+  auto lineWidth = Float{0};
+  auto hangingWidth = Float{0};
+
+  // Appends the line ending at `end`, returns `true` if no more lines fit.
+  auto closeLine = [&](size_t end) {
+    auto line = Line{lineStart, end, lineWidth};
+    if (!lines.empty()) {
+      line.top = lines.back().top + lines.back().height;
+    }
+
+    auto ascender = Float{0};
+    auto descender = Float{0};
+    auto lineGap = Float{0};
+    auto lineHeight = std::numeric_limits<Float>::quiet_NaN();
+
+    // Empty lines (after a trailing line break) take the metrics of the last
+    // run.
+    auto first = std::min(lineStart, size - 1);
+    auto last = std::max(first + 1, end);
+    auto run = std::upper_bound(
+        runs.begin(), runs.end(), first, [](size_t index, const Run& run) {
+          return index < run.end;
+        });
+    for (; run != runs.end() && run->start < last; run++) {
+      ascender = std::max(ascender, run->ascender);
+      descender = std::max(descender, run->descender);
+      lineGap = std::max(lineGap, run->lineGap);
+      if (!run->isAttachment) {
+        line.capHeight = std::max(line.capHeight, run->capHeight);
+        line.xHeight = std::max(line.xHeight, run->xHeight);
+      }
+      if (!std::isnan(run->lineHeight)) {
+        lineHeight = std::isnan(lineHeight)
+            ? run->lineHeight
+            : std::max(lineHeight, run->lineHeight);
+      }
+    }
+
+    if (std::isnan(lineHeight)) {
+      line.height = ascender + descender + lineGap;
+      line.baseline = ascender;
+    } else {
+      // The difference with the natural height is split evenly above and
+      // below the glyphs.
+      line.height = lineHeight;
+      line.baseline = (lineHeight - ascender - descender) / 2 + ascender;
+    }
+    line.descender = line.height - line.baseline;
+
+    lines.push_back(line);
+    lineStart = end;
+    lineWidth = 0;
+    hangingWidth = 0;
+    return lines.size() >= maximumNumberOfLines;
+  };
+
+  for (const auto& segment : shapedText.segments) {
+    if (lineStart != segment.start &&
+        lineWidth + hangingWidth + segment.contentWidth > availableWidth) {
+      if (closeLine(segment.start)) {
+        return lines;
+      }
+    }
+
+    if (lineStart == segment.start && segment.contentWidth > availableWidth) {
+      // The segment doesn't fit even on its own line, so it is broken
+      // between code points, keeping at least one per line.
+      for (auto i = segment.start; i < segment.contentEnd; i++) {
+        if (i > lineStart && lineWidth + advances[i] > availableWidth) {
+          if (closeLine(i)) {
+            return lines;
+          }
+        }
+        lineWidth += advances[i];
+      }
+    } else {
+      lineWidth += hangingWidth + segment.contentWidth;
+    }
+    hangingWidth = segment.trailingWidth;
+
+    if (segment.isMandatoryBreak) {
+      if (closeLine(segment.end)) {
+        return lines;
+      }
+    }
+  }
+
+  // A trailing line break starts an empty line.
+  auto lastClass = getLineBreakClass(codePoints.back());
+  if (lastClass == LineBreakClass::BK || lastClass == LineBreakClass::CR ||
+      lastClass == LineBreakClass::LF) {
+    closeLine(size);
+  }
+
+  return lines;
+}
+
+TextMeasurement TextLayoutEngine::measure(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Size maximumSize) const {
+  auto shapedText = shape(attributedString);
+  auto lines = layout(*shapedText, paragraphAttributes, maximumSize.width);
+
+  auto size = Size{};
+  for (const auto& line : lines) {
+    size.width = std::max(size.width, line.width);
+  }
+  if (!lines.empty()) {
+    size.height = lines.back().top + lines.back().height;
+  }
+
+  auto attachments = TextMeasurement::Attachments{};
+  for (const auto& run : shapedText->runs) {
+    if (!run.isAttachment) {
+      continue;
+    }
+
+    auto attachmentSize = Size{shapedText->advances[run.start], run.ascender};
+    auto line = std::find_if(lines.begin(), lines.end(), [&](const auto& line) {
+      return run.start >= line.start && run.start < line.end;
+    });
+    if (line == lines.end()) {
+      // Truncated by `maximumNumberOfLines`.
+      attachments.push_back({{{0, 0}, attachmentSize}, true});
+      continue;
+    }
+
+    auto x = alignmentOffset(shapedText->alignment, line->width, size.width);
+    for (auto i = line->start; i < run.start; i++) {
+      x += shapedText->advances[i];
+    }
+    auto y = line->top + line->baseline - attachmentSize.height;
+    auto isClipped =
+        x + attachmentSize.width > maximumSize.width + kWidthEpsilon;
+    attachments.push_back({{{x, y}, attachmentSize}, isClipped});
+  }
+
+  return TextMeasurement{size, attachments};
+}
+
+LinesMeasurements TextLayoutEngine::measureLines(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Size size) const {
+  auto shapedText = shape(attributedString);
+  auto lines = layout(*shapedText, paragraphAttributes, size.width);
+
+  auto linesMeasurements = LinesMeasurements{};
+  linesMeasurements.reserve(lines.size());
+  for (const auto& line : lines) {
+    auto textStart = shapedText->byteOffsets[line.start];
+    auto textEnd = shapedText->byteOffsets[line.end];
+    auto x = alignmentOffset(shapedText->alignment, line.width, size.width);
+    linesMeasurements.emplace_back(
+        shapedText->text.substr(textStart, textEnd - textStart),
+        Rect{{x, line.top}, {line.width, line.height}},
+        line.descender,
+        line.capHeight,
+        line.baseline,
+        line.xHeight);
+  }
+  return linesMeasurements;
+}
+
+} // namespace facebook::react
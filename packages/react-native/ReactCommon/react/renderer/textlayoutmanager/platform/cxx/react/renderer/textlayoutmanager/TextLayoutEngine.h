@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <react/utils/ConcurrentLRUCache.h>
+
+namespace facebook::react {
+
+/*
+ * Portable text layout used by the cxx `TextLayoutManager`.
+ *
+ * Layout happens in two steps:
+ * - Shaping converts an `AttributedString` into code points with advances,
+ *   per-fragment vertical metrics and unbreakable segments between UAX #14
+ *   line break opportunities. It doesn't depend on the available width.
+ *   Shaped paragraphs are cached, so measuring a paragraph at another width
+ *   (as Yoga does when it probes max-content and then the exact width) only
+ *   runs line breaking again. Shaped fragments are cached too, so only
+ *   changed fragments of an edited paragraph are shaped again.
+ * - Line breaking greedily fits segments into a given width. Trailing
+ *   spaces hang past the end of a line; words wider than a line are broken
+ *   between code points.
+ *
+ * Every paragraph shaping is reported to the thread's `TransactionTelemetry`
+ * as a text measurement.
+ *
+ * Glyph advances come from `FontRegistry` faces; there is no kerning,
+ * ligature or bidirectional support.
+ */
+class TextLayoutEngine final {
+ public:
+  /*
+   * Vertical metrics of a run of text with the same attributes.
+   * `descender` is positive and grows down from the baseline.
+   */
+  struct Run {
+    size_t start{0};
+    size_t end{0};
+    Float ascender{0};
+    Float descender{0};
+    Float lineGap{0};
+    Float capHeight{0};
+    Float xHeight{0};
+    // Explicit line height, NaN if not set.
+    Float lineHeight{std::numeric_limits<Float>::quiet_NaN()};
+    bool isAttachment{false};
+  };
+
+  /*
+   * Code points `[start, end)` between two line break opportunities. Its
+   * trailing whitespace `[contentEnd, end)` hangs at the end of a line.
+   */
+  struct Segment {
+    size_t start{0};
+    size_t contentEnd{0};
+    size_t end{0};
+    Float contentWidth{0};
+    Float trailingWidth{0};
+    // The line must be broken after this segment.
+    bool isMandatoryBreak{false};
+  };
+
+  /*
+   * Width-independent representation of a paragraph, with one element per
+   * code point in `codePoints` and `advances`.
+   */
+  struct ShapedText {
+    std::string text;
+    std::vector<char32_t> codePoints;
+    // Offsets of code points in `text`, plus the size of `text`.
+    std::vector<uint32_t> byteOffsets;
+    std::vector<Float> advances;
+    std::vector<Segment> segments;
+    // One run per fragment, in order.
+    std::vector<Run> runs;
+    TextAlignment alignment{TextAlignment::Natural};
+  };
+
+  /*
+   * A laid out line spanning code points `[start, end)`.
+   * `width` doesn't include hanging spaces and line breaks.
+   */
+  struct Line {
+    size_t start{0};
+    size_t end{0};
+    Float width{0};
+    Float top{0};
+    Float height{0};
+    // Distance from the top of the line to its baseline.
+    Float baseline{0};
+    Float descender{0};
+    Float capHeight{0};
+    Float xHeight{0};
+  };
+
+  explicit TextLayoutEngine(
+      const FontRegistry& fontRegistry = FontRegistry::shared());
+
+  /*
+   * Returns the shaped representation of a paragraph, from the cache if
+   * possible. Cached paragraphs and fragments are dropped when faces are
+   * registered in the font registry.
+   */
+  std::shared_ptr<const ShapedText> shape(
+      const AttributedString& attributedString) const;
+
+  /*
+   * Breaks shaped text into lines no wider than `maximumWidth` (unless a
+   * single code point doesn't fit), stopping after
+   * `paragraphAttributes.maximumNumberOfLines` lines.
+   */
+  std::vector<Line> layout(
+      const ShapedText& shapedText,
+      const ParagraphAttributes& paragraphAttributes,
+      Float maximumWidth) const;
+
+  TextMeasurement measure(
+      const AttributedString& attributedString,
+      const ParagraphAttributes& paragraphAttributes,
+      Size maximumSize) const;
+
+  LinesMeasurements measureLines(
+      const AttributedString& attributedString,
+      const ParagraphAttributes& paragraphAttributes,
+      Size size) const;
+
+ private:
+  /*
+   * Code points and advances of a single fragment.
+   */
+  struct ShapedFragment {
+    std::vector<char32_t> codePoints;
+    std::vector<uint32_t> byteOffsets;
+    std::vector<Float> advances;
+    Run metrics;
+  };
+
+  struct FragmentHashLayoutWise {
+    size_t operator()(const AttributedString::Fragment& fragment) const {
+      return attributedStringFragmentHashLayoutWise(fragment);
+    }
+  };
+
+  struct FragmentEqualLayoutWise {
+    bool operator()(
+        const AttributedString::Fragment& lhs,
+        const AttributedString::Fragment& rhs) const {
+      return areAttributedStringFragmentsEquivalentLayoutWise(lhs, rhs);
+    }
+  };
+
+  struct AttributedStringHashLayoutWise {
+    size_t operator()(const AttributedString& attributedString) const {
+      return attributedStringHashLayoutWise(attributedString);
+    }
+  };
+
+  struct AttributedStringEqualLayoutWise {
+    bool operator()(const AttributedString& lhs, const AttributedString& rhs)
+        const {
+      return areAttributedStringsEquivalentLayoutWise(lhs, rhs);
+    }
+  };
+
+  std::shared_ptr<const ShapedFragment> shapeFragment(
+      const AttributedString::Fragment& fragment) const;
+
+  ShapedText shapeText(const AttributedString& attributedString) const;
+
+  const FontRegistry& fontRegistry_;
+  // `FontRegistry::getGeneration()` the caches were filled with.
+  mutable std::atomic<size_t> fontRegistryGeneration_;
+  ConcurrentLRUCache<
+      AttributedString,
+      std::shared_ptr<const ShapedText>,
+      AttributedStringHashLayoutWise,
+      AttributedStringEqualLayoutWise>
+      shapedTextCache_;
+  ConcurrentLRUCache<
+      AttributedString::Fragment,
+      std::shared_ptr<const ShapedFragment>,
+      FragmentHashLayoutWise,
+      FragmentEqualLayoutWise>
+      fragmentCache_;
+};
+
+} // namespace facebook::react
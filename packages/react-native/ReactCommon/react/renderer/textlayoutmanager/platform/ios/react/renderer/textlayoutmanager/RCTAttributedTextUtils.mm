@@ -390,8 +390,8 @@ static NSMutableAttributedString *RCTNSAttributedStringFragmentFromFragment(
   } else {
     NSString *string = [NSString stringWithUTF8String:fragment.string.c_str()];
 
-    if (fragment.textAttributes.textTransform.has_value()) {
-      auto textTransform = fragment.textAttributes.textTransform.value();
+    if (fragment.textAttributes->textTransform.has_value()) {
+      auto textTransform = fragment.textAttributes->textTransform.value();
       string = RCTNSStringFromStringApplyingTextTransform(string, textTransform);
     }
 
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/FontFace.h>
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
+
+namespace facebook::react {
+
+namespace {
+
+class FontDataBuilder {
+ public:
+  void u16(uint32_t value) {
+    data.push_back(static_cast<uint8_t>(value >> 8));
+    data.push_back(static_cast<uint8_t>(value));
+  }
+
+  void u32(uint32_t value) {
+    u16(value >> 16);
+    u16(value & 0xFFFF);
+  }
+
+  void zeros(size_t count) {
+    data.insert(data.end(), count, 0);
+  }
+
+  void set16(size_t offset, uint32_t value) {
+    data[offset] = static_cast<uint8_t>(value >> 8);
+    data[offset + 1] = static_cast<uint8_t>(value);
+  }
+
+  std::vector<uint8_t> data;
+};
+
+/*
+ * Builds a minimal TrueType font with 3 glyphs:
+ * - 0 (.notdef), advance 500;
+ * - 1 for 'A', advance 600;
+ * - 2 for 'B' and 'a', advance 700.
+ * Units per em are 1000.
+ */
+std::vector<uint8_t> buildFont(
+    const std::string& familyName,
+    int weight,
+    bool italic) {
+  auto tables = std::vector<std::pair<std::string, FontDataBuilder>>{};
+
+  auto head = FontDataBuilder{};
+  head.zeros(54);
+  head.set16(12, 0x5F0F);
+  head.set16(14, 0x3CF5);
+  head.set16(18, 1000);
+  tables.emplace_back("head", head);
+
+  auto hhea = FontDataBuilder{};
+  hhea.zeros(36);
+  hhea.set16(4, 800);
+  hhea.set16(6, static_cast<uint16_t>(-200));
+  hhea.set16(8, 100);
+  hhea.set16(34, 3);
+  tables.emplace_back("hhea", hhea);
+
+  auto maxp = FontDataBuilder{};
+  maxp.u32(0x00005000);
+  maxp.u16(3);
+  tables.emplace_back("maxp", maxp);
+
+  auto hmtx = FontDataBuilder{};
+  for (auto advance : {500, 600, 700}) {
+    hmtx.u16(advance);
+    hmtx.u16(0);
+  }
+  tables.emplace_back("hmtx", hmtx);
+
+  auto cmap = FontDataBuilder{};
+  cmap.u16(0);
+  cmap.u16(1);
+  cmap.u16(3);
+  cmap.u16(1);
+  cmap.u32(12);
+  // Format 4 subtable with 3 segments: 'A'-'B' mapped with a delta, 'a'
+  // mapped through the glyph id array, and the final 0xFFFF segment.
+  cmap.u16(4);
+  cmap.u16(16 + 3 * 8 + 2);
+  cmap.u16(0);
+  cmap.u16(3 * 2);
+  cmap.zeros(6);
+  for (auto endCode : {0x42, 0x61, 0xFFFF}) {
+    cmap.u16(endCode);
+  }
+  cmap.u16(0);
+  for (auto startCode : {0x41, 0x61, 0xFFFF}) {
+    cmap.u16(startCode);
+  }
+  for (auto idDelta : {1 - 0x41, 0, 1}) {
+    cmap.u16(static_cast<uint16_t>(idDelta));
+  }
+  for (auto idRangeOffset : {0, 4, 0}) {
+    cmap.u16(idRangeOffset);
+  }
+  cmap.u16(2);
+  tables.emplace_back("cmap", cmap);
+
+  auto os2 = FontDataBuilder{};
+  os2.zeros(96);
+  os2.set16(0, 2);
+  os2.set16(4, weight);
+  os2.set16(62, italic ? 1 : 0);
+  os2.set16(86, 450);
+  os2.set16(88, 650);
+  tables.emplace_back("OS/2", os2);
+
+  auto name = FontDataBuilder{};
+  name.u16(0);
+  name.u16(1);
+  name.u16(18);
+  name.u16(3);
+  name.u16(1);
+  name.u16(0x409);
+  name.u16(1);
+  name.u16(static_cast<uint32_t>(familyName.size() * 2));
+  name.u16(0);
+  for (auto character : familyName) {
+    name.u16(static_cast<uint8_t>(character));
+  }
+  tables.emplace_back("name", name);
+
+  auto font = FontDataBuilder{};
+  font.u32(0x00010000);
+  font.u16(static_cast<uint32_t>(tables.size()));
+  font.zeros(6);
+  auto offset = 12 + tables.size() * 16;
+  for (const auto& [tag, table] : tables) {
+    for (auto character : tag) {
+      font.data.push_back(static_cast<uint8_t>(character));
+    }
+    font.u32(0);
+    font.u32(static_cast<uint32_t>(offset));
+    font.u32(static_cast<uint32_t>(table.data.size()));
+    offset += table.data.size();
+  }
+  for (const auto& [tag, table] : tables) {
+    font.data.insert(font.data.end(), table.data.begin(), table.data.end());
+  }
+  return font.data;
+}
+
+} // namespace
+
+TEST(FontFaceTest, readsNamesAndMetrics) {
+  auto fontFace = FontFace::loadFromData(buildFont("Test", 700, true));
+  ASSERT_NE(fontFace, nullptr);
+
+  EXPECT_EQ(fontFace->getFamilyName(), "Test");
+  EXPECT_EQ(fontFace->getWeight(), 700);
+  EXPECT_TRUE(fontFace->isItalic());
+  EXPECT_FLOAT_EQ(fontFace->getAscender(10), 8);
+  EXPECT_FLOAT_EQ(fontFace->getDescender(10), -2);
+  EXPECT_FLOAT_EQ(fontFace->getLineGap(10), 1);
+  EXPECT_FLOAT_EQ(fontFace->getCapHeight(10), 6.5);
+  EXPECT_FLOAT_EQ(fontFace->getXHeight(10), 4.5);
+}
+
+TEST(FontFaceTest, mapsCodePointsToAdvances) {
+  auto fontFace = FontFace::loadFromData(buildFont("Test", 400, false));
+  ASSERT_NE(fontFace, nullptr);
+
+  EXPECT_TRUE(fontFace->hasGlyph('A'));
+  EXPECT_TRUE(fontFace->hasGlyph('a'));
+  EXPECT_FALSE(fontFace->hasGlyph('z'));
+  EXPECT_FALSE(fontFace->hasGlyph(0x4E00));
+
+  EXPECT_FLOAT_EQ(fontFace->getAdvance('A', 10), 6);
+  EXPECT_FLOAT_EQ(fontFace->getAdvance('B', 10), 7);
+  EXPECT_FLOAT_EQ(fontFace->getAdvance('a', 20), 14);
+  // Missing glyphs use the advance of `.notdef`.
+  EXPECT_FLOAT_EQ(fontFace->getAdvance('z', 10), 5);
+  EXPECT_FLOAT_EQ(fontFace->getAdvance(0x4E00, 10), 5);
+}
+
+TEST(FontFaceTest, rejectsInvalidData) {
+  EXPECT_EQ(FontFace::loadFromData({}), nullptr);
+  EXPECT_EQ(FontFace::loadFromData({0, 1, 0, 0, 0, 0}), nullptr);
+
+  auto truncatedFont = buildFont("Test", 400, false);
+  truncatedFont.resize(truncatedFont.size() / 2);
+  EXPECT_EQ(FontFace::loadFromData(truncatedFont), nullptr);
+
+  EXPECT_EQ(FontFace::loadFromFile("/nonexistent/font.ttf"), nullptr);
+}
+
+TEST(FontFaceTest, fallbackFaceHasAllGlyphs) {
+  auto fontFace = FontFace::fallback();
+
+  EXPECT_TRUE(fontFace->hasGlyph('A'));
+  EXPECT_TRUE(fontFace->hasGlyph(0x4E00));
+  EXPECT_FLOAT_EQ(
+      fontFace->getAdvance('A', 10), fontFace->getAdvance(0x4E00, 10));
+}
+
+TEST(FontRegistryTest, matchesFamilyWeightAndStyle) {
+  auto registry = FontRegistry{};
+  auto regular = FontFace::loadFromData(buildFont("Test", 400, false));
+  auto bold = FontFace::loadFromData(buildFont("Test", 700, false));
+  auto boldItalic = FontFace::loadFromData(buildFont("Test", 700, true));
+  auto other = FontFace::loadFromData(buildFont("Other", 400, false));
+  registry.registerFontFace(regular);
+  registry.registerFontFace(bold);
+  registry.registerFontFace(boldItalic);
+  registry.registerFontFace(other);
+
+  EXPECT_EQ(registry.getFontFace("Test", 400, false), regular);
+  EXPECT_EQ(registry.getFontFace("test", 700, false), bold);
+  EXPECT_EQ(registry.getFontFace("Test", 700, true), boldItalic);
+  EXPECT_EQ(registry.getFontFace("Test", 300, false), regular);
+  EXPECT_EQ(registry.getFontFace("Test", 900, false), bold);
+  EXPECT_EQ(registry.getFontFace("Test", 400, true), boldItalic);
+  EXPECT_EQ(registry.getFontFace("Other", 700, false), other);
+
+  // Unknown families resolve to the first registered family.
+  EXPECT_EQ(registry.getFontFace("Unknown", 400, false), regular);
+  registry.setDefaultFamilyName("Other");
+  EXPECT_EQ(registry.getFontFace("Unknown", 400, false), other);
+}
+
+TEST(FontRegistryTest, findsFallbackFaces) {
+  auto registry = FontRegistry{};
+  EXPECT_EQ(registry.getFontFace("Test", 400, false), FontFace::fallback());
+  EXPECT_EQ(registry.getFallbackFontFace('A'), nullptr);
+
+  auto fontFace = FontFace::loadFromData(buildFont("Test", 400, false));
+  registry.registerFontFace(fontFace);
+  EXPECT_EQ(registry.getFallbackFontFace('A'), fontFace);
+  EXPECT_EQ(registry.getFallbackFontFace('z'), nullptr);
+}
+
+TEST(FontRegistryTest, registersFontFilesOnce) {
+  auto directory =
+      std::filesystem::path{::testing::TempDir()} / "FontRegistryTest";
+  std::filesystem::create_directories(directory / "nested");
+  for (const auto& [path, weight] :
+       {std::pair{directory / "Regular.ttf", 400},
+        std::pair{directory / "nested" / "Bold.otf", 700}}) {
+    auto data = buildFont("Test", weight, false);
+    std::ofstream(path, std::ios::binary)
+        .write(reinterpret_cast<const char*>(data.data()), data.size());
+  }
+
+  auto registry = FontRegistry{};
+  auto generation = registry.getGeneration();
+  EXPECT_EQ(registry.registerFontDirectory(directory.string()), 2);
+  EXPECT_EQ(registry.getGeneration(), generation + 2);
+
+  // Neither the directory nor files in it add faces again.
+  EXPECT_EQ(registry.registerFontDirectory(directory.string()), 0);
+  EXPECT_EQ(registry.registerFontDirectory((directory / ".").string()), 0);
+  EXPECT_FALSE(registry.registerFontFile((directory / "Regular.ttf").string()));
+  EXPECT_EQ(registry.getGeneration(), generation + 2);
+
+  std::filesystem::remove_all(directory);
+}
+
+} // namespace facebook::react
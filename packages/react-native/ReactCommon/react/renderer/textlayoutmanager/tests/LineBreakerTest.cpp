@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Returns `text` with "|" where a break is allowed and "!" where it is
+ * mandatory, omitting the mandatory break at the end.
+ */
+std::string markBreaks(const std::u32string& text) {
+  auto codePoints = std::vector<char32_t>(text.begin(), text.end());
+  auto opportunities = findLineBreakOpportunities(codePoints);
+
+  auto result = std::string{};
+  for (size_t i = 0; i < codePoints.size(); i++) {
+    auto codePoint = codePoints[i];
+    result += codePoint < 0x80 ? static_cast<char>(codePoint) : '*';
+    if (i + 1 == codePoints.size()) {
+      break;
+    }
+    if (opportunities[i] == LineBreakOpportunity::Allowed) {
+      result += '|';
+    } else if (opportunities[i] == LineBreakOpportunity::Mandatory) {
+      result += '!';
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(LineBreakerTest, breaksAfterSpaces) {
+  EXPECT_EQ(markBreaks(U"hello world"), "hello |world");
+  EXPECT_EQ(markBreaks(U"a   b"), "a   |b");
+  EXPECT_EQ(markBreaks(U" a"), " |a");
+}
+
+TEST(LineBreakerTest, breaksAtLineSeparators) {
+  EXPECT_EQ(markBreaks(U"a\nb"), "a\n!b");
+  EXPECT_EQ(markBreaks(U"a\r\nb"), "a\r\n!b");
+  EXPECT_EQ(markBreaks(U"a b"), "a*!b");
+  EXPECT_EQ(markBreaks(U"a \nb"), "a \n!b");
+}
+
+TEST(LineBreakerTest, alwaysBreaksAtTheEnd) {
+  auto opportunities = findLineBreakOpportunities({'a', 'b'});
+  EXPECT_EQ(opportunities.back(), LineBreakOpportunity::Mandatory);
+  EXPECT_TRUE(findLineBreakOpportunities({}).empty());
+}
+
+TEST(LineBreakerTest, breaksAfterHyphens) {
+  EXPECT_EQ(markBreaks(U"well-known"), "well-|known");
+  EXPECT_EQ(markBreaks(U"a–b"), "a*|b");
+  EXPECT_EQ(markBreaks(U"a -b"), "a |-b");
+}
+
+TEST(LineBreakerTest, keepsPunctuationAttached) {
+  EXPECT_EQ(markBreaks(U"(a b)"), "(a |b)");
+  EXPECT_EQ(markBreaks(U"( a"), "( a");
+  EXPECT_EQ(markBreaks(U"a !"), "a !");
+  EXPECT_EQ(markBreaks(U"a, b."), "a, |b.");
+}
+
+TEST(LineBreakerTest, respectsGlue) {
+  EXPECT_EQ(markBreaks(U"a b"), "a*b");
+  EXPECT_EQ(markBreaks(U"a  b"), "a |*b");
+  EXPECT_EQ(markBreaks(U"a​b"), "a*|b");
+}
+
+TEST(LineBreakerTest, breaksAroundIdeographs) {
+  EXPECT_EQ(markBreaks(U"漢字"), "*|*");
+  EXPECT_EQ(markBreaks(U"a漢b"), "a|*|b");
+  // No break before CJK punctuation and small kana.
+  EXPECT_EQ(markBreaks(U"漢。字"), "**|*");
+  EXPECT_EQ(markBreaks(U"チャ"), "**");
+}
+
+TEST(LineBreakerTest, keepsCombiningMarksWithTheirBase) {
+  EXPECT_EQ(markBreaks(U"é a"), "e* |a");
+  EXPECT_EQ(markBreaks(U"漢️字"), "**|*");
+  EXPECT_EQ(markBreaks(U"\U0001F469‍\U0001F4BB"), "***");
+}
+
+} // namespace facebook::react
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
+
+using namespace facebook::react;
+
+namespace {
+
+TextMeasureCacheKey makeKey(std::string string, Float maximumWidth) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 14;
+  fragment.textAttributes = textAttributes;
+
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(std::move(fragment));
+
+  auto key = TextMeasureCacheKey{};
+  key.attributedString = attributedString;
+  key.layoutConstraints.maximumSize = {maximumWidth, 1000};
+  return key;
+}
+
+std::string temporaryFilePath() {
+  return std::string{::testing::TempDir()} + "PersistentTextMeasureCache.bin";
+}
+
+} // namespace
+
+TEST(PersistentTextMeasureCacheTest, testMeasurementsSurviveReload) {
+  auto filePath = temporaryFilePath();
+  std::remove(filePath.c_str());
+  auto environment = PersistentTextMeasureCache::Environment{1, "en_US"};
+
+  {
+    auto cache = PersistentTextMeasureCache{filePath, environment};
+    EXPECT_FALSE(cache.get(makeKey("Hello", 100)).has_value());
+
+    cache.set(makeKey("Hello", 100), TextMeasurement{{42, 17}, {}});
+    EXPECT_TRUE(cache.get(makeKey("Hello", 100)).has_value());
+    EXPECT_TRUE(cache.persist());
+  }
+
+  auto cache = PersistentTextMeasureCache{filePath, environment};
+  cache.warmUp();
+  EXPECT_EQ(cache.size(), 1);
+
+  auto measurement = cache.get(makeKey("Hello", 100));
+  ASSERT_TRUE(measurement.has_value());
+  EXPECT_EQ(measurement->size, (Size{42, 17}));
+
+  // Different width or text is a different key.
+  EXPECT_FALSE(cache.get(makeKey("Hello", 200)).has_value());
+  EXPECT_FALSE(cache.get(makeKey("World", 100)).has_value());
+
+  std::remove(filePath.c_str());
+}
+
+TEST(PersistentTextMeasureCacheTest, testEnvironmentChangeInvalidatesFile) {
+  auto filePath = temporaryFilePath();
+  std::remove(filePath.c_str());
+
+  {
+    auto cache = PersistentTextMeasureCache{filePath, {1, "en_US"}};
+    cache.set(makeKey("Hello", 100), TextMeasurement{{42, 17}, {}});
+    EXPECT_TRUE(cache.persist());
+  }
+
+  EXPECT_EQ(PersistentTextMeasureCache(filePath, {1, "en_US"}).size(), 1);
+  EXPECT_EQ(PersistentTextMeasureCache(filePath, {1.5, "en_US"}).size(), 0);
+  EXPECT_EQ(PersistentTextMeasureCache(filePath, {1, "fr_FR"}).size(), 0);
+
+  std::remove(filePath.c_str());
+}
+
+TEST(PersistentTextMeasureCacheTest, testAttachmentsAreNotPersisted) {
+  auto key = makeKey("Hello", 100);
+  auto attachment = AttributedString::Fragment{};
+  attachment.string = AttributedString::Fragment::AttachmentCharacter();
+  key.attributedString.appendFragment(std::move(attachment));
+
+  EXPECT_FALSE(PersistentTextMeasureCache::fingerprint(key).has_value());
+  EXPECT_TRUE(
+      PersistentTextMeasureCache::fingerprint(makeKey("Hello", 100))
+          .has_value());
+}
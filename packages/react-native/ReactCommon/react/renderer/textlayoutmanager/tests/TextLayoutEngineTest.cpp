@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <react/renderer/textlayoutmanager/TextLayoutEngine.h>
+
+namespace facebook::react {
+
+namespace {
+
+// With no registered fonts, every character of a 10pt font advances by 5.5
+// and lines are 11.7 high (9.3 above the baseline).
+constexpr auto kAdvance = Float{5.5};
+constexpr auto kLineHeight = Float{11.7};
+constexpr auto kAscender = Float{9.3};
+
+TextAttributes makeTextAttributes() {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 10;
+  return textAttributes;
+}
+
+AttributedString::Fragment makeFragment(
+    const std::string& string,
+    const TextAttributes& textAttributes = makeTextAttributes()) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  fragment.textAttributes = textAttributes;
+  return fragment;
+}
+
+AttributedString makeAttributedString(const std::string& string) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment(string));
+  return attributedString;
+}
+
+std::vector<std::string> lineTexts(const LinesMeasurements& lines) {
+  auto texts = std::vector<std::string>{};
+  for (const auto& line : lines) {
+    texts.push_back(line.text);
+  }
+  return texts;
+}
+
+} // namespace
+
+class TextLayoutEngineTest : public ::testing::Test {
+ protected:
+  FontRegistry fontRegistry_{};
+  TextLayoutEngine engine_{fontRegistry_};
+};
+
+TEST_F(TextLayoutEngineTest, measuresSingleLine) {
+  auto measurement = engine_.measure(
+      makeAttributedString("hello world"), {}, {1000, 1000});
+
+  EXPECT_FLOAT_EQ(measurement.size.width, 11 * kAdvance);
+  EXPECT_FLOAT_EQ(measurement.size.height, kLineHeight);
+}
+
+TEST_F(TextLayoutEngineTest, wrapsAtBreakOpportunities) {
+  auto attributedString = makeAttributedString("hello world again");
+
+  auto lines =
+      engine_.measureLines(attributedString, {}, {12 * kAdvance, 1000});
+  EXPECT_EQ(
+      lineTexts(lines),
+      (std::vector<std::string>{"hello world ", "again"}));
+  // Trailing spaces hang.
+  EXPECT_FLOAT_EQ(lines[0].frame.size.width, 11 * kAdvance);
+  EXPECT_FLOAT_EQ(lines[1].frame.origin.y, kLineHeight);
+  EXPECT_FLOAT_EQ(lines[0].ascender, kAscender);
+
+  auto measurement =
+      engine_.measure(attributedString, {}, {12 * kAdvance, 1000});
+  EXPECT_FLOAT_EQ(measurement.size.width, 11 * kAdvance);
+  EXPECT_FLOAT_EQ(measurement.size.height, 2 * kLineHeight);
+}
+
+TEST_F(TextLayoutEngineTest, breaksLongWords) {
+  auto lines = engine_.measureLines(
+      makeAttributedString("abcdefgh"), {}, {3 * kAdvance, 1000});
+
+  EXPECT_EQ(
+      lineTexts(lines), (std::vector<std::string>{"abc", "def", "gh"}));
+}
+
+TEST_F(TextLayoutEngineTest, keepsAtLeastOneCharacterPerLine) {
+  auto lines =
+      engine_.measureLines(makeAttributedString("ab"), {}, {1, 1000});
+
+  EXPECT_EQ(lineTexts(lines), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST_F(TextLayoutEngineTest, breaksAtLineSeparators) {
+  auto lines = engine_.measureLines(
+      makeAttributedString("a\nb\n"), {}, {1000, 1000});
+
+  EXPECT_EQ(lineTexts(lines), (std::vector<std::string>{"a\n", "b\n", ""}));
+  EXPECT_FLOAT_EQ(lines[0].frame.size.width, kAdvance);
+}
+
+TEST_F(TextLayoutEngineTest, limitsNumberOfLines) {
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+
+  auto measurement = engine_.measure(
+      makeAttributedString("a b c d"), paragraphAttributes, {kAdvance, 1000});
+
+  EXPECT_FLOAT_EQ(measurement.size.height, 2 * kLineHeight);
+}
+
+TEST_F(TextLayoutEngineTest, appliesFragmentAttributes) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("ab"));
+  auto largeTextAttributes = makeTextAttributes();
+  largeTextAttributes.fontSize = 20;
+  largeTextAttributes.letterSpacing = 1;
+  attributedString.appendFragment(makeFragment("cd", largeTextAttributes));
+
+  auto measurement = engine_.measure(attributedString, {}, {1000, 1000});
+
+  EXPECT_FLOAT_EQ(
+      measurement.size.width, 2 * kAdvance + 2 * (2 * kAdvance + 1));
+  EXPECT_FLOAT_EQ(measurement.size.height, 2 * kLineHeight);
+}
+
+TEST_F(TextLayoutEngineTest, appliesFontSizeMultiplier) {
+  auto textAttributes = makeTextAttributes();
+  textAttributes.fontSizeMultiplier = 2;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("ab", textAttributes));
+
+  EXPECT_FLOAT_EQ(
+      engine_.measure(attributedString, {}, {1000, 1000}).size.width,
+      4 * kAdvance);
+
+  textAttributes.allowFontScaling = false;
+  attributedString.getFragments()[0].textAttributes = textAttributes;
+  EXPECT_FLOAT_EQ(
+      engine_.measure(attributedString, {}, {1000, 1000}).size.width,
+      2 * kAdvance);
+}
+
+TEST_F(TextLayoutEngineTest, appliesLineHeight) {
+  auto textAttributes = makeTextAttributes();
+  textAttributes.lineHeight = 20;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("a\nb", textAttributes));
+
+  auto lines = engine_.measureLines(attributedString, {}, {1000, 1000});
+
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_FLOAT_EQ(lines[1].frame.origin.y, 20);
+  EXPECT_FLOAT_EQ(lines[1].frame.size.height, 20);
+  EXPECT_FLOAT_EQ(lines[1].ascender, (20 - kLineHeight) / 2 + kAscender);
+}
+
+TEST_F(TextLayoutEngineTest, positionsAttachments) {
+  auto attachment = AttributedString::Fragment{};
+  attachment.string = AttributedString::Fragment::AttachmentCharacter();
+  attachment.parentShadowView.layoutMetrics.frame.size = {10, 30};
+
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("ab"));
+  attributedString.appendFragment(std::move(attachment));
+
+  auto measurement = engine_.measure(attributedString, {}, {1000, 1000});
+
+  ASSERT_EQ(measurement.attachments.size(), 1);
+  const auto& frame = measurement.attachments[0].frame;
+  EXPECT_FLOAT_EQ(frame.origin.x, 2 * kAdvance);
+  EXPECT_FLOAT_EQ(frame.origin.y, 0);
+  EXPECT_EQ(frame.size, (Size{10, 30}));
+  EXPECT_FALSE(measurement.attachments[0].isClipped);
+  EXPECT_FLOAT_EQ(measurement.size.width, 2 * kAdvance + 10);
+  EXPECT_FLOAT_EQ(measurement.size.height, 30 + (kLineHeight - kAscender));
+}
+
+TEST_F(TextLayoutEngineTest, alignsLines) {
+  auto textAttributes = makeTextAttributes();
+  textAttributes.alignment = TextAlignment::Center;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("ab", textAttributes));
+
+  auto lines = engine_.measureLines(attributedString, {}, {100, 1000});
+
+  EXPECT_FLOAT_EQ(lines[0].frame.origin.x, (100 - 2 * kAdvance) / 2);
+}
+
+TEST_F(TextLayoutEngineTest, shapesParagraphOncePerLayoutPass) {
+  auto telemetry = TransactionTelemetry{};
+  telemetry.setAsThreadLocal();
+  telemetry.willLayout();
+
+  auto attributedString = makeAttributedString("hello world again");
+  auto maxContentSize =
+      engine_.measure(attributedString, {}, {1000, 1000}).size;
+  auto wrappedSize =
+      engine_.measure(attributedString, {}, {12 * kAdvance, 1000}).size;
+  auto lines =
+      engine_.measureLines(attributedString, {}, {5 * kAdvance, 1000});
+
+  EXPECT_FLOAT_EQ(maxContentSize.height, kLineHeight);
+  EXPECT_FLOAT_EQ(wrappedSize.height, 2 * kLineHeight);
+  EXPECT_EQ(lines.size(), 3);
+  EXPECT_EQ(telemetry.getNumberOfTextMeasurements(), 1);
+
+  // Attributes that don't affect layout don't invalidate shaped text.
+  auto translucentTextAttributes = makeTextAttributes();
+  translucentTextAttributes.opacity = 0.5;
+  auto translucentString = AttributedString{};
+  translucentString.appendFragment(
+      makeFragment("hello world again", translucentTextAttributes));
+  engine_.measure(translucentString, {}, {100, 1000});
+  EXPECT_EQ(telemetry.getNumberOfTextMeasurements(), 1);
+
+  engine_.measure(makeAttributedString("hello"), {}, {100, 1000});
+  EXPECT_EQ(telemetry.getNumberOfTextMeasurements(), 2);
+
+  telemetry.didLayout();
+  telemetry.unsetAsThreadLocal();
+}
+
+TEST_F(TextLayoutEngineTest, measuresEmptyString) {
+  auto measurement = engine_.measure(AttributedString{}, {}, {1000, 1000});
+
+  EXPECT_EQ(measurement.size, (Size{0, 0}));
+}
+
+TEST_F(TextLayoutEngineTest, dropsCachesWhenFontsAreRegistered) {
+  auto attributedString = makeAttributedString("Hello");
+  auto shapedText = engine_.shape(attributedString);
+  EXPECT_EQ(engine_.shape(attributedString), shapedText);
+
+  fontRegistry_.registerFontFace(FontFace::fallback());
+  EXPECT_NE(engine_.shape(attributedString), shapedText);
+}
+
+} // namespace facebook::react
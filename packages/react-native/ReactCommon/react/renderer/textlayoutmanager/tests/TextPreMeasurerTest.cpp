@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/renderer/textlayoutmanager/TextPreMeasurer.h>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Records measured strings. Measurement blocks while the manager is paused.
+ */
+class RecordingTextLayoutManager final : public TextLayoutManager {
+ public:
+  RecordingTextLayoutManager()
+      : TextLayoutManager(std::make_shared<ContextContainer>()) {}
+
+  TextMeasurement measure(
+      const AttributedStringBox& attributedStringBox,
+      const ParagraphAttributes& /*paragraphAttributes*/,
+      const TextLayoutContext& /*layoutContext*/,
+      const LayoutConstraints& /*layoutConstraints*/) const override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    started_ = true;
+    startedCondition_.notify_all();
+    resumedCondition_.wait(lock, [this]() { return !paused_; });
+    measuredStrings_.push_back(
+        attributedStringBox.getValue().getString());
+    return {};
+  }
+
+  void pause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = true;
+    started_ = false;
+  }
+
+  void waitUntilStarted() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    startedCondition_.wait(lock, [this]() { return started_; });
+  }
+
+  void resume() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      paused_ = false;
+    }
+    resumedCondition_.notify_all();
+  }
+
+  std::vector<std::string> getMeasuredStrings() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return measuredStrings_;
+  }
+
+ private:
+  mutable std::vector<std::string> measuredStrings_;
+  mutable bool paused_{false};
+  mutable bool started_{false};
+  mutable std::mutex mutex_;
+  mutable std::condition_variable startedCondition_;
+  mutable std::condition_variable resumedCondition_;
+};
+
+TextPreMeasurer::Request makeRequest(const std::string& string) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(std::move(fragment));
+  return {std::move(attributedString), {}, {}, {{0, 0}, {100, 100}}};
+}
+
+} // namespace
+
+TEST(TextPreMeasurerTest, measuresEnqueuedParagraphs) {
+  auto textLayoutManager = std::make_shared<RecordingTextLayoutManager>();
+  auto textPreMeasurer = TextPreMeasurer{textLayoutManager};
+
+  textPreMeasurer.enqueue(
+      makeRequest("first"), TextPreMeasurer::Priority::Visible);
+  textPreMeasurer.enqueue(
+      makeRequest("second"), TextPreMeasurer::Priority::Hidden);
+  textPreMeasurer.waitUntilIdle();
+
+  EXPECT_EQ(textLayoutManager->getMeasuredStrings().size(), 2);
+
+  auto metrics = textPreMeasurer.getMetrics();
+  EXPECT_EQ(metrics.enqueuedRequestCount, 2);
+  EXPECT_EQ(metrics.measuredRequestCount, 2);
+  EXPECT_EQ(metrics.droppedRequestCount, 0);
+}
+
+TEST(TextPreMeasurerTest, measuresVisibleParagraphsFirst) {
+  auto textLayoutManager = std::make_shared<RecordingTextLayoutManager>();
+  auto textPreMeasurer = TextPreMeasurer{textLayoutManager, 1};
+
+  // Keeps the only worker busy while the other requests are enqueued.
+  textLayoutManager->pause();
+  textPreMeasurer.enqueue(
+      makeRequest("blocking"), TextPreMeasurer::Priority::Hidden);
+  textLayoutManager->waitUntilStarted();
+
+  textPreMeasurer.enqueue(
+      makeRequest("hidden"), TextPreMeasurer::Priority::Hidden);
+  textPreMeasurer.enqueue(
+      makeRequest("visible"), TextPreMeasurer::Priority::Visible);
+
+  textLayoutManager->resume();
+  textPreMeasurer.waitUntilIdle();
+
+  EXPECT_EQ(
+      textLayoutManager->getMeasuredStrings(),
+      (std::vector<std::string>{"blocking", "visible", "hidden"}));
+}
+
+TEST(TextPreMeasurerTest, dropsHiddenParagraphsWhenFull) {
+  auto textLayoutManager = std::make_shared<RecordingTextLayoutManager>();
+  auto textPreMeasurer = TextPreMeasurer{textLayoutManager, 1};
+
+  textLayoutManager->pause();
+  textPreMeasurer.enqueue(
+      makeRequest("blocking"), TextPreMeasurer::Priority::Visible);
+  textLayoutManager->waitUntilStarted();
+
+  textPreMeasurer.enqueue(
+      makeRequest("hidden"), TextPreMeasurer::Priority::Hidden);
+  for (size_t i = 0; i < TextPreMeasurer::kMaxPendingRequestCount; i++) {
+    textPreMeasurer.enqueue(
+        makeRequest("visible"), TextPreMeasurer::Priority::Visible);
+  }
+
+  textLayoutManager->resume();
+  textPreMeasurer.waitUntilIdle();
+
+  auto measuredStrings = textLayoutManager->getMeasuredStrings();
+  EXPECT_EQ(
+      measuredStrings.size(), TextPreMeasurer::kMaxPendingRequestCount + 1);
+  EXPECT_EQ(
+      std::count(measuredStrings.begin(), measuredStrings.end(), "hidden"), 0);
+  EXPECT_EQ(textPreMeasurer.getMetrics().droppedRequestCount, 1);
+}
+
+} // namespace facebook::react
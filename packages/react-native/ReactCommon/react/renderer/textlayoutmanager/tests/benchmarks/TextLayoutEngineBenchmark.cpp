@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextLayoutEngine.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr auto kParagraphCount = 200;
+
+// Uses system fonts if there are any, synthetic metrics otherwise.
+const FontRegistry& getFontRegistry() {
+  static auto& fontRegistry = []() -> FontRegistry& {
+    auto& fontRegistry = *new FontRegistry();
+    fontRegistry.registerFontDirectory("/usr/share/fonts");
+    return fontRegistry;
+  }();
+  return fontRegistry;
+}
+
+std::vector<AttributedString> makeParagraphs() {
+  auto regularTextAttributes = TextAttributes{};
+  regularTextAttributes.fontSize = 14;
+  auto boldTextAttributes = regularTextAttributes;
+  boldTextAttributes.fontWeight = FontWeight::Bold;
+
+  auto paragraphs = std::vector<AttributedString>{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    auto paragraph = AttributedString{};
+
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = "Paragraph #" + std::to_string(i) + ": ";
+    fragment.textAttributes = boldTextAttributes;
+    paragraph.appendFragment(std::move(fragment));
+
+    fragment = AttributedString::Fragment{};
+    fragment.string =
+        "The quick brown fox jumps over the lazy dog, then keeps running "
+        "across the field until the text is long enough to wrap a few "
+        "times on a phone-sized screen.";
+    fragment.textAttributes = regularTextAttributes;
+    paragraph.appendFragment(std::move(fragment));
+
+    paragraphs.push_back(std::move(paragraph));
+  }
+  return paragraphs;
+}
+
+auto paragraphs = makeParagraphs();
+
+/*
+ * Every iteration uses a fresh engine, so all fragments are shaped.
+ */
+static void layoutColdParagraphs(benchmark::State& state) {
+  for (auto _ : state) {
+    auto engine = TextLayoutEngine{getFontRegistry()};
+    for (const auto& paragraph : paragraphs) {
+      benchmark::DoNotOptimize(engine.measure(paragraph, {}, {320, 10000}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kParagraphCount);
+}
+BENCHMARK(layoutColdParagraphs);
+
+/*
+ * Mimics a Yoga layout pass probing every paragraph at its max-content width
+ * and then at the exact width. Only the first probe shapes the paragraph.
+ */
+static void layoutParagraphsAtSeveralWidths(benchmark::State& state) {
+  for (auto _ : state) {
+    auto engine = TextLayoutEngine{getFontRegistry()};
+    for (const auto& paragraph : paragraphs) {
+      benchmark::DoNotOptimize(engine.measure(
+          paragraph, {}, {std::numeric_limits<Float>::infinity(), 10000}));
+      benchmark::DoNotOptimize(engine.measure(paragraph, {}, {320, 10000}));
+      benchmark::DoNotOptimize(engine.measure(paragraph, {}, {280, 10000}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kParagraphCount);
+}
+BENCHMARK(layoutParagraphsAtSeveralWidths);
+
+/*
+ * Shaped paragraphs are cached, only line breaking runs.
+ */
+static void layoutWarmParagraphs(benchmark::State& state) {
+  auto engine = TextLayoutEngine{getFontRegistry()};
+  for (auto _ : state) {
+    for (const auto& paragraph : paragraphs) {
+      benchmark::DoNotOptimize(engine.measure(paragraph, {}, {320, 10000}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kParagraphCount);
+}
+BENCHMARK(layoutWarmParagraphs);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
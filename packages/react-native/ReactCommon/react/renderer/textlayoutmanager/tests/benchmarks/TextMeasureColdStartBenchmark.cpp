@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// Roughly the number of paragraphs on a text-heavy first screen.
+constexpr auto kParagraphCount = 200;
+
+auto filePath = std::string{"/tmp/TextMeasureColdStartBenchmark.bin"};
+
+std::vector<AttributedString> makeParagraphs() {
+  auto paragraphs = std::vector<AttributedString>{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = "Paragraph #" + std::to_string(i) +
+        " of a text-heavy screen that is measured on cold start.";
+    auto textAttributes = TextAttributes{};
+    textAttributes.fontSize = 14;
+    fragment.textAttributes = textAttributes;
+    auto paragraph = AttributedString{};
+    paragraph.appendFragment(std::move(fragment));
+    paragraphs.push_back(std::move(paragraph));
+  }
+  return paragraphs;
+}
+
+auto paragraphs = makeParagraphs();
+auto layoutConstraints = LayoutConstraints{{0, 0}, {320, 10000}};
+
+void measureFirstScreen(const TextLayoutManager& textLayoutManager) {
+  for (const auto& paragraph : paragraphs) {
+    benchmark::DoNotOptimize(textLayoutManager.measure(
+        AttributedStringBox{paragraph}, {}, {}, layoutConstraints));
+  }
+}
+
+/*
+ * Every iteration simulates an app launch: a fresh `TextLayoutManager` with
+ * empty in-memory caches measures the first screen.
+ */
+static void coldStartWithoutPersistentCache(benchmark::State& state) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  for (auto _ : state) {
+    auto textLayoutManager = TextLayoutManager{contextContainer};
+    measureFirstScreen(textLayoutManager);
+  }
+}
+BENCHMARK(coldStartWithoutPersistentCache);
+
+static void coldStartWithPersistentCache(benchmark::State& state) {
+  auto environment = PersistentTextMeasureCache::Environment{1, "en_US"};
+  std::remove(filePath.c_str());
+
+  // A previous launch populates the file.
+  {
+    auto persistentCache = std::make_shared<const PersistentTextMeasureCache>(
+        filePath, environment);
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        PersistentTextMeasureCache::ContextContainerKey, persistentCache);
+    measureFirstScreen(TextLayoutManager{contextContainer});
+    persistentCache->persist();
+  }
+
+  for (auto _ : state) {
+    auto persistentCache = std::make_shared<const PersistentTextMeasureCache>(
+        filePath, environment);
+    persistentCache->warmUp();
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        PersistentTextMeasureCache::ContextContainerKey, persistentCache);
+    auto textLayoutManager = TextLayoutManager{contextContainer};
+    measureFirstScreen(textLayoutManager);
+  }
+
+  std::remove(filePath.c_str());
+}
+BENCHMARK(coldStartWithPersistentCache);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
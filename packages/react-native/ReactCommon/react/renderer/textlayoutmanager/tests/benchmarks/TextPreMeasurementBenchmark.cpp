@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/renderer/textlayoutmanager/TextPreMeasurer.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// Roughly the number of paragraphs committed by a text-heavy screen.
+constexpr auto kParagraphCount = 200;
+
+std::vector<AttributedString> makeParagraphs() {
+  auto paragraphs = std::vector<AttributedString>{};
+  for (int i = 0; i < kParagraphCount; i++) {
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = "Paragraph #" + std::to_string(i) +
+        " of a text-heavy screen which is committed, laid out and mounted.";
+    auto textAttributes = TextAttributes{};
+    textAttributes.fontSize = 14;
+    fragment.textAttributes = textAttributes;
+    auto paragraph = AttributedString{};
+    paragraph.appendFragment(std::move(fragment));
+    paragraphs.push_back(std::move(paragraph));
+  }
+  return paragraphs;
+}
+
+auto paragraphs = makeParagraphs();
+auto layoutConstraints = LayoutConstraints{{0, 0}, {320, 10000}};
+
+/*
+ * Measures every paragraph on the calling thread, like layout does during a
+ * commit.
+ */
+void layOutScreen(const TextLayoutManager& textLayoutManager) {
+  for (const auto& paragraph : paragraphs) {
+    benchmark::DoNotOptimize(textLayoutManager.measure(
+        AttributedStringBox{paragraph}, {}, {}, layoutConstraints));
+  }
+}
+
+/*
+ * Every iteration commits the screen with empty measurement caches.
+ */
+static void commitWithoutPreMeasurement(benchmark::State& state) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto textLayoutManager =
+        std::make_shared<const TextLayoutManager>(contextContainer);
+    state.ResumeTiming();
+
+    layOutScreen(*textLayoutManager);
+  }
+  state.SetItemsProcessed(state.iterations() * kParagraphCount);
+}
+BENCHMARK(commitWithoutPreMeasurement)->UseRealTime();
+
+/*
+ * Same as above, but paragraphs are submitted for pre-measurement right
+ * before layout, as `ParagraphPreMeasurementCommitHook` does.
+ */
+static void commitWithPreMeasurement(benchmark::State& state) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto workerCount = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto textLayoutManager =
+        std::make_shared<const TextLayoutManager>(contextContainer);
+    auto textPreMeasurer =
+        std::make_unique<TextPreMeasurer>(textLayoutManager, workerCount);
+    state.ResumeTiming();
+
+    for (const auto& paragraph : paragraphs) {
+      textPreMeasurer->enqueue(
+          {paragraph, {}, {}, layoutConstraints},
+          TextPreMeasurer::Priority::Visible);
+    }
+    layOutScreen(*textLayoutManager);
+
+    state.PauseTiming();
+    textPreMeasurer.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kParagraphCount);
+}
+BENCHMARK(commitWithPreMeasurement)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
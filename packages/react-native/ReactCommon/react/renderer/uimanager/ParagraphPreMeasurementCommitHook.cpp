@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ParagraphPreMeasurementCommitHook.h"
+
+#include <limits>
+
+#include <react/renderer/components/text/ParagraphShadowNode.h>
+#include <react/renderer/mounting/ShadowTree.h>
+
+namespace facebook::react {
+
+namespace {
+
+void enqueueChangedParagraphs(
+    const ShadowNode& shadowNode,
+    const LayoutContext& layoutContext,
+    const LayoutConstraints& defaultLayoutConstraints,
+    TextPreMeasurer::Priority priority,
+    const TextPreMeasurer& textPreMeasurer) {
+  for (const auto& childNode : shadowNode.getChildren()) {
+    if (childNode->getSealed()) {
+      // The subtree wasn't touched by the commit, its paragraphs are already
+      // measured.
+      continue;
+    }
+
+    auto paragraphShadowNode =
+        dynamic_cast<const ParagraphShadowNode*>(childNode.get());
+    if (paragraphShadowNode == nullptr) {
+      enqueueChangedParagraphs(
+          *childNode,
+          layoutContext,
+          defaultLayoutConstraints,
+          priority,
+          textPreMeasurer);
+      continue;
+    }
+
+    auto request = paragraphShadowNode->getPreMeasurementRequest(
+        layoutContext, defaultLayoutConstraints);
+    if (request.has_value()) {
+      textPreMeasurer.enqueue(std::move(request.value()), priority);
+    }
+  }
+}
+
+} // namespace
+
+ParagraphPreMeasurementCommitHook::ParagraphPreMeasurementCommitHook(
+    std::shared_ptr<const TextPreMeasurer> textPreMeasurer)
+    : textPreMeasurer_(std::move(textPreMeasurer)) {}
+
+void ParagraphPreMeasurementCommitHook::commitHookWasRegistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+void ParagraphPreMeasurementCommitHook::commitHookWasUnregistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+RootShadowNode::Unshared
+ParagraphPreMeasurementCommitHook::shadowTreeWillCommit(
+    const ShadowTree& shadowTree,
+    const RootShadowNode::Shared& /*oldRootShadowNode*/,
+    const RootShadowNode::Unshared& newRootShadowNode) noexcept {
+  const auto& rootProps = newRootShadowNode->getConcreteProps();
+
+  auto defaultLayoutConstraints = LayoutConstraints{
+      {0, 0},
+      {rootProps.layoutConstraints.maximumSize.width,
+       std::numeric_limits<Float>::infinity()},
+      rootProps.layoutConstraints.layoutDirection};
+
+  auto priority = shadowTree.getCommitMode() == ShadowTree::CommitMode::Normal
+      ? TextPreMeasurer::Priority::Visible
+      : TextPreMeasurer::Priority::Hidden;
+
+  enqueueChangedParagraphs(
+      *newRootShadowNode,
+      rootProps.layoutContext,
+      defaultLayoutConstraints,
+      priority,
+      *textPreMeasurer_);
+
+  return newRootShadowNode;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <react/renderer/textlayoutmanager/TextPreMeasurer.h>
+#include <react/renderer/uimanager/UIManagerCommitHook.h>
+
+namespace facebook::react {
+
+/*
+ * Submits new and changed paragraphs of a committed tree to a
+ * `TextPreMeasurer` right before the tree is laid out, so that text is
+ * measured in parallel with the layout of the rest of the tree.
+ *
+ * Only nodes created or cloned by the commit (i.e. unsealed ones) are
+ * visited. A changed paragraph is measured with the constraints of its
+ * previous layout; a new one is measured as if it spanned the full width of
+ * the surface. Paragraphs of surfaces which aren't displayed are measured
+ * with lower priority.
+ *
+ * To enable it, pass it to `SchedulerToolbox::commitHooks`. It only pays
+ * off with idle cores to run the `TextPreMeasurer` workers on: on a single
+ * core, the workers compete with layout and a commit gets slower.
+ */
+class ParagraphPreMeasurementCommitHook final : public UIManagerCommitHook {
+ public:
+  explicit ParagraphPreMeasurementCommitHook(
+      std::shared_ptr<const TextPreMeasurer> textPreMeasurer);
+
+#pragma mark - UIManagerCommitHook
+
+  void commitHookWasRegistered(const UIManager& uiManager) noexcept override;
+  void commitHookWasUnregistered(const UIManager& uiManager) noexcept override;
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& oldRootShadowNode,
+      const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
+
+ private:
+  const std::shared_ptr<const TextPreMeasurer> textPreMeasurer_;
+};
+
+} // namespace facebook::react
@@ -682,9 +682,14 @@ void UIManager::stopSurfaceForAnimationDelegate(SurfaceId surfaceId) const {
 void UIManager::animationTick() const {
   if (animationDelegate_ != nullptr &&
       animationDelegate_->shouldAnimateFrame()) {
-    shadowTreeRegistry_.enumerate([](const ShadowTree& shadowTree, bool&) {
-      shadowTree.notifyDelegatesOfUpdates();
-    });
+    shadowTreeRegistry_.enumerate(
+        [this](const ShadowTree& shadowTree, bool&) {
+          // Surfaces without in-flight animations have nothing to mount.
+          if (animationDelegate_->shouldAnimateFrame(
+                  shadowTree.getSurfaceId())) {
+            shadowTree.notifyDelegatesOfUpdates();
+          }
+        });
   }
 }
 
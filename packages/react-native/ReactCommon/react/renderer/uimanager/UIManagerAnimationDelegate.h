@@ -11,6 +11,7 @@
 
 #include <react/renderer/componentregistry/ComponentDescriptorFactory.h>
 #include <react/renderer/core/RawValue.h>
+#include <react/renderer/core/ReactPrimitives.h>
 
 namespace facebook::react {
 
@@ -41,6 +42,14 @@ class UIManagerAnimationDelegate {
    */
   virtual bool shouldAnimateFrame() const = 0;
 
+  /**
+   * Whether the given surface has animations to advance on the next frame.
+   * Surfaces without any are not notified by `UIManager::animationTick`.
+   */
+  virtual bool shouldAnimateFrame(SurfaceId /*surfaceId*/) const {
+    return shouldAnimateFrame();
+  }
+
   /**
    * Drop any animations for a given surface.
    */
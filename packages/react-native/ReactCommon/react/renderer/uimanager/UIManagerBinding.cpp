@@ -98,7 +98,7 @@ void UIManagerBinding::dispatchEvent(
   SystraceSection s("UIManagerBinding::dispatchEvent", "type", type);
 
   if (eventPayload.getType() == EventPayloadType::PointerEvent) {
-    auto pointerEvent = static_cast<const PointerEvent&>(eventPayload);
+    const auto& pointerEvent = static_cast<const PointerEvent&>(eventPayload);
     auto dispatchCallback = [this, &runtime](
                                 const ShadowNode& targetNode,
                                 const std::string& type,
@@ -38,6 +38,20 @@ class JSRuntime {
    */
   virtual void unstable_initializeOnJsThread() {}
 
+  /**
+   * Prepares a script for evaluation on a background thread, while the
+   * runtime is being initialized on the JS thread. Returns the prepared script
+   * to evaluate instead of the buffer, if any.
+   *
+   * Must not access the runtime, which may be in use on the JS thread. By
+   * default, this reads a byte of every page of the buffer, so that the pages
+   * of a memory-mapped bundle are loaded before evaluation.
+   */
+  virtual std::shared_ptr<const jsi::PreparedJavaScript>
+  unstable_prepareScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL);
+
  private:
   /**
    * Initialized by \c getRuntimeTargetDelegate if not overridden, and then
@@ -22,10 +22,16 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/utils/jsi-utils.h>
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <utility>
 
+#ifdef ANDROID
+#include <fbjni/fbjni.h>
+#endif
+
 namespace facebook::react {
 
 namespace {
@@ -44,6 +50,8 @@ std::shared_ptr<RuntimeScheduler> createRuntimeScheduler(
   return scheduler;
 }
 
+using PreparedScript = std::shared_ptr<const jsi::PreparedJavaScript>;
+
 } // namespace
 
 ReactInstance::ReactInstance(
@@ -159,6 +167,19 @@ ReactInstance::ReactInstance(
           std::function<void(jsi::Runtime & runtime)>&& callback) {
         runtimeScheduler->scheduleWork(std::move(callback));
       });
+
+  timerManager_->setErrorHandler(
+      [jsErrorHandler = jsErrorHandler_](
+          jsi::Runtime& runtime, jsi::JSError& error) {
+        jsErrorHandler->handleError(runtime, error, true);
+      });
+}
+
+ReactInstance::~ReactInstance() {
+  // The preparation task doesn't own the runtime.
+  if (preparedScript_.valid()) {
+    preparedScript_.wait();
+  }
 }
 
 void ReactInstance::unregisterFromInspector() {
@@ -227,22 +248,70 @@ void ReactInstance::loadScript(
   auto buffer = std::make_shared<BigStringBuffer>(std::move(script));
   std::string scriptName = simpleBasename(sourceURL);
 
+  // Reading and preparing the bundle doesn't need the runtime, so it happens
+  // on a background thread while the JS thread installs the bindings.
+  auto prepareScript = [runtime = runtime_.get(), buffer, sourceURL]() {
+    SystraceSection s("ReactInstance::prepareScript");
+    bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
+    if (hasLogger) {
+      ReactMarker::logMarkerBridgeless(ReactMarker::PREPARE_JS_BUNDLE_START);
+    }
+
+    auto prepared = runtime->unstable_prepareScript(buffer, sourceURL);
+    if (hasLogger) {
+      ReactMarker::logMarkerBridgeless(ReactMarker::PREPARE_JS_BUNDLE_STOP);
+    }
+    return prepared;
+  };
+
+  // Only one script is prepared in the background at a time. Scripts loaded
+  // meanwhile are prepared on the JS thread, right before they're evaluated.
+  auto preparedScript = std::shared_future<PreparedScript>{};
+  if (preparedScript_.valid() &&
+      preparedScript_.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready) {
+    preparedScript =
+        std::async(std::launch::deferred, std::move(prepareScript)).share();
+  } else {
+    auto prepareScriptInBackground = [prepareScript]() {
+      auto prepared = PreparedScript{};
+#ifdef ANDROID
+      // Markers are logged through JNI on Android.
+      jni::ThreadScope::WithClassLoader([&]() { prepared = prepareScript(); });
+#else
+      prepared = prepareScript();
+#endif
+      return prepared;
+    };
+    preparedScript_ =
+        std::async(std::launch::async, std::move(prepareScriptInBackground))
+            .share();
+    preparedScript = preparedScript_;
+  }
+
   runtimeScheduler_->scheduleWork([this,
                                    scriptName,
                                    sourceURL,
                                    buffer = std::move(buffer),
+                                   preparedScript = std::move(preparedScript),
                                    weakBufferedRuntimeExecuter =
                                        std::weak_ptr<BufferedRuntimeExecutor>(
                                            bufferedRuntimeExecutor_),
                                    completion](jsi::Runtime& runtime) {
     SystraceSection s("ReactInstance::loadScript");
+    auto prepared = preparedScript.get();
+
     bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
     if (hasLogger) {
       ReactMarker::logTaggedMarkerBridgeless(
           ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
     }
 
-    runtime.evaluateJavaScript(buffer, sourceURL);
+    if (prepared) {
+      runtime.evaluatePreparedJavaScript(prepared);
+    } else {
+      runtime.evaluateJavaScript(buffer, sourceURL);
+    }
 
     /**
      * TODO(T183610671): We need a safe/reliable way to enable the js
@@ -395,6 +464,11 @@ void ReactInstance::initializeRuntime(
   runtimeScheduler_->scheduleWork([this, options, bindingsInstallFunc](
                                       jsi::Runtime& runtime) {
     SystraceSection s("ReactInstance::initializeRuntime");
+    bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
+    if (hasLogger) {
+      ReactMarker::logMarkerBridgeless(
+          ReactMarker::INSTALL_RUNTIME_BINDINGS_START);
+    }
 
     bindNativePerformanceNow(runtime);
 
@@ -593,6 +667,11 @@ void ReactInstance::initializeRuntime(
     timerManager_->attachGlobals(runtime);
 
     bindingsInstallFunc(runtime);
+
+    if (hasLogger) {
+      ReactMarker::logMarkerBridgeless(
+          ReactMarker::INSTALL_RUNTIME_BINDINGS_STOP);
+    }
   });
 }
 
@@ -17,6 +17,7 @@
 #include <react/runtime/BufferedRuntimeExecutor.h>
 #include <react/runtime/JSRuntimeFactory.h>
 #include <react/runtime/TimerManager.h>
+#include <future>
 #include <vector>
 
 namespace facebook::react {
@@ -32,6 +33,8 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
       JsErrorHandler::OnJsError onJsError,
       jsinspector_modern::HostTarget* parentInspectorTarget = nullptr);
 
+  ~ReactInstance() override;
+
   RuntimeExecutor getUnbufferedRuntimeExecutor() noexcept;
 
   RuntimeExecutor getBufferedRuntimeExecutor() noexcept;
@@ -79,6 +82,14 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
   std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
   std::shared_ptr<JsErrorHandler> jsErrorHandler_;
 
+  /*
+   * The bundle being prepared on a background thread by `loadScript`, while
+   * the JS thread initializes the runtime. Only one bundle is prepared in the
+   * background at a time.
+   */
+  std::shared_future<std::shared_ptr<const jsi::PreparedJavaScript>>
+      preparedScript_;
+
   jsinspector_modern::InstanceTarget* inspectorTarget_{nullptr};
   jsinspector_modern::RuntimeTarget* runtimeInspectorTarget_{nullptr};
   jsinspector_modern::HostTarget* parentInspectorTarget_{nullptr};
@@ -7,16 +7,23 @@
 
 #include "TimerManager.h"
 
+#include <cxxreact/ErrorUtils.h>
 #include <cxxreact/SystraceSection.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/utils/OnScopeExit.h>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 namespace facebook::react {
 
 namespace {
 
+// Longer delays are shortened to this one, about 24.8 days.
+constexpr double kMaxTimerDelay = std::numeric_limits<int32_t>::max();
+
 double coerceNumberTimeout(jsi::Runtime& rt, const jsi::Value& timeout) {
   double delay = 0.0;
 
@@ -54,14 +61,24 @@ inline const char* getTimerSourceName(TimerSource source) {
 } // namespace
 
 TimerManager::TimerManager(
-    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept
-    : platformTimerRegistry_(std::move(platformTimerRegistry)) {}
+    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+    std::function<Clock::time_point()> now) noexcept
+    : platformTimerRegistry_(std::move(platformTimerRegistry)),
+      now_(std::move(now)),
+      startTime_(now_()),
+      onError_([](jsi::Runtime& runtime, jsi::JSError& error) {
+        handleJSError(runtime, error, true);
+      }) {}
 
 void TimerManager::setRuntimeExecutor(
     RuntimeExecutor runtimeExecutor) noexcept {
   runtimeExecutor_ = runtimeExecutor;
 }
 
+void TimerManager::setErrorHandler(TimerErrorHandler onError) noexcept {
+  onError_ = std::move(onError);
+}
+
 TimerHandle TimerManager::createReactNativeMicrotask(
     jsi::Function&& callback,
     std::vector<jsi::Value>&& args) {
@@ -121,9 +138,10 @@ TimerHandle TimerManager::createTimer(
           std::move(callback),
           std::move(args),
           /* repeat */ false,
-          source));
+          source,
+          delay));
 
-  platformTimerRegistry_->createTimer(timerID, delay);
+  scheduleTimer(timerID, delay);
 
   return timerID;
 }
@@ -149,9 +167,13 @@ TimerHandle TimerManager::createRecurringTimer(
       std::piecewise_construct,
       std::forward_as_tuple(timerID),
       std::forward_as_tuple(
-          std::move(callback), std::move(args), /* repeat */ true, source));
+          std::move(callback),
+          std::move(args),
+          /* repeat */ true,
+          source,
+          delay));
 
-  platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  scheduleTimer(timerID, delay);
 
   return timerID;
 }
@@ -179,8 +201,8 @@ void TimerManager::deleteTimer(jsi::Runtime& runtime, TimerHandle timerHandle) {
     throw jsi::JSError(runtime, "clearTimeout called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
   timers_.erase(timerHandle);
+  cancelTimer(timerHandle);
 }
 
 void TimerManager::deleteRecurringTimer(
@@ -190,34 +212,170 @@ void TimerManager::deleteRecurringTimer(
     throw jsi::JSError(runtime, "clearInterval called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
   timers_.erase(timerHandle);
+  cancelTimer(timerHandle);
 }
 
 void TimerManager::callTimer(TimerHandle timerHandle) {
   runtimeExecutor_([this, timerHandle](jsi::Runtime& runtime) {
+    callDueTimers(runtime, timerHandle);
+  });
+}
+
+TimerWheel::Tick TimerManager::getCurrentTick() const {
+  auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+      now_() - startTime_);
+  // The wheel may be ahead of the clock after the platform timer fired.
+  return std::max(
+      static_cast<TimerWheel::Tick>(std::max(elapsedTime.count(), int64_t{0})),
+      timerWheel_.getCurrentTick());
+}
+
+void TimerManager::scheduleTimer(TimerHandle handle, double delay) {
+  // Rounded up to whole milliseconds, so timers never fire early.
+  auto currentTick = getCurrentTick();
+  auto deadline = currentTick +
+      static_cast<TimerWheel::Tick>(std::ceil(std::min(delay, kMaxTimerDelay)));
+
+  timerWheel_.schedule(handle, deadline);
+  armPlatformTimer(deadline, currentTick);
+}
+
+void TimerManager::cancelTimer(TimerHandle handle) {
+  if (timerWheel_.cancel(handle) && timerWheel_.empty() && platformTimer_) {
+    platformTimerRegistry_->deleteTimer(platformTimer_->handle);
+    platformTimer_.reset();
+  }
+}
+
+void TimerManager::armPlatformTimer(
+    TimerWheel::Tick deadline,
+    TimerWheel::Tick currentTick) {
+  if (platformTimer_ && platformTimer_->deadline <= deadline) {
+    return;
+  }
+
+  if (platformTimer_) {
+    platformTimerRegistry_->deleteTimer(platformTimer_->handle);
+  }
+  platformTimer_ = PlatformTimer{platformTimerIndex_, deadline};
+  platformTimerIndex_ =
+      platformTimerIndex_ == std::numeric_limits<TimerHandle>::max()
+      ? 0
+      : platformTimerIndex_ + 1;
+  platformTimerRegistry_->createTimer(
+      platformTimer_->handle,
+      deadline > currentTick ? static_cast<double>(deadline - currentTick)
+                             : 0.0);
+}
+
+void TimerManager::callDueTimers(
+    jsi::Runtime& runtime,
+    TimerHandle platformTimerHandle) {
+  // The platform may still call a timer it was asked to delete, e.g. when it
+  // fired right before being re-armed. Its deadline is not the one of the
+  // timer armed now, which is called on its own.
+  if (!platformTimer_ || platformTimer_->handle != platformTimerHandle) {
+    return;
+  }
+
+  SystraceSection s("TimerManager::callDueTimers");
+
+  // Platform timers may fire a bit before their deadline as measured by
+  // `now_`, which still counts as reached.
+  auto currentTick = std::max(getCurrentTick(), platformTimer_->deadline);
+  platformTimer_.reset();
+
+  auto dueTimers = std::vector<TimerHandle>{};
+  timerWheel_.advance(currentTick, dueTimers);
+
+  // A failing timer doesn't prevent the other due timers from running.
+  for (auto timerHandle : dueTimers) {
     auto it = timers_.find(timerHandle);
-    if (it != timers_.end()) {
-      auto& timerCallback = it->second;
-      bool repeats = timerCallback.repeat;
-
-      {
-        SystraceSection s(
-            "TimerManager::callTimer",
-            "id",
-            timerHandle,
-            "type",
-            getTimerSourceName(timerCallback.source));
-        timerCallback.invoke(runtime);
-      }
+    if (it == timers_.end()) {
+      // Deleted by a timer called before.
+      continue;
+    }
 
-      if (!repeats) {
-        // Invoking a timer has the potential to delete it. Do not re-use the
-        // existing iterator to erase it from the map.
-        timers_.erase(timerHandle);
+    auto& timerCallback = it->second;
+    bool repeats = timerCallback.repeat;
+
+    try {
+      SystraceSection s2(
+          "TimerManager::callTimer",
+          "id",
+          timerHandle,
+          "type",
+          getTimerSourceName(timerCallback.source));
+      timerCallback.invoke(runtime);
+    } catch (jsi::JSError& error) {
+      onError_(runtime, error);
+    } catch (std::exception& ex) {
+      jsi::JSError error(
+          runtime, std::string("Non-js exception: ") + ex.what());
+      onError_(runtime, error);
+    }
+
+    // Invoking a timer has the potential to delete it. Do not re-use the
+    // existing iterator.
+    if (!repeats) {
+      timers_.erase(timerHandle);
+    } else if (auto repeating = timers_.find(timerHandle);
+               repeating != timers_.end()) {
+      scheduleTimer(timerHandle, repeating->second.delay);
+    }
+
+    try {
+      performMicrotaskCheckpoint(runtime);
+    } catch (std::exception& ex) {
+      // Hit the retries bound.
+      jsi::JSError error(
+          runtime, std::string("Non-js exception: ") + ex.what());
+      onError_(runtime, error);
+    }
+  }
+
+  if (auto nextDeadline = timerWheel_.getNextDeadline()) {
+    armPlatformTimer(*nextDeadline, getCurrentTick());
+  }
+}
+
+void TimerManager::performMicrotaskCheckpoint(jsi::Runtime& runtime) {
+  SystraceSection s("TimerManager::performMicrotaskCheckpoint");
+
+  if (performingMicrotaskCheckpoint_) {
+    return;
+  }
+
+  performingMicrotaskCheckpoint_ = true;
+  OnScopeExit restoreFlag([&]() { performingMicrotaskCheckpoint_ = false; });
+
+  uint8_t retries = 0;
+  // A heuristic number to guard infinite or absurd numbers of retries.
+  const static unsigned int kRetriesBound = 255;
+
+  while (retries < kRetriesBound) {
+    try {
+      if (ReactNativeFeatureFlags::disableEventLoopOnBridgeless()) {
+        callReactNativeMicrotasks(runtime);
+        break;
+      }
+      if (runtime.drainMicrotasks()) {
+        break;
       }
+    } catch (jsi::JSError& error) {
+      onError_(runtime, error);
+    } catch (std::exception& ex) {
+      jsi::JSError error(
+          runtime, std::string("Non-js exception: ") + ex.what());
+      onError_(runtime, error);
     }
-  });
+    retries++;
+  }
+
+  if (retries == kRetriesBound) {
+    throw std::runtime_error("Hits microtasks retries bound.");
+  }
 }
 
 void TimerManager::attachGlobals(jsi::Runtime& runtime) {
@@ -8,11 +8,15 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "PlatformTimerRegistry.h"
+#include "TimerWheel.h"
 
 namespace facebook::react {
 
@@ -33,11 +37,13 @@ struct TimerCallback {
       jsi::Function callback,
       std::vector<jsi::Value> args,
       bool repeat,
-      TimerSource source = TimerSource::Unknown)
+      TimerSource source = TimerSource::Unknown,
+      double delay = 0)
       : callback_(std::move(callback)),
         args_(std::move(args)),
         repeat(repeat),
-        source(source) {}
+        source(source),
+        delay(delay) {}
 
   void invoke(jsi::Runtime& runtime) {
     callback_.call(runtime, args_.data(), args_.size());
@@ -47,17 +53,44 @@ struct TimerCallback {
   const std::vector<jsi::Value> args_;
   bool repeat;
   TimerSource source;
+  double delay;
 };
 
+using TimerErrorHandler =
+    std::function<void(jsi::Runtime& runtime, jsi::JSError& error)>;
+
+/*
+ * Implements the JavaScript timer APIs.
+ *
+ * All timers share a single platform timer, armed for the earliest deadline
+ * of a `TimerWheel`, so creating and clearing timers doesn't involve the
+ * platform unless the earliest deadline changes.
+ */
 class TimerManager {
  public:
+  using Clock = std::chrono::steady_clock;
+
   explicit TimerManager(
-      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept;
+      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+      std::function<Clock::time_point()> now = Clock::now) noexcept;
 
   void setRuntimeExecutor(RuntimeExecutor runtimeExecutor) noexcept;
 
+  /*
+   * Sets the handler errors thrown by timers are reported to, one by one.
+   * By default, they are reported as fatal errors to `ErrorUtils`.
+   */
+  void setErrorHandler(TimerErrorHandler onError) noexcept;
+
   void callReactNativeMicrotasks(jsi::Runtime& runtime);
 
+  /*
+   * Called by the platform when its timer fires. Runs all the JavaScript
+   * timers due by then in a single runtime executor call, in deadline order,
+   * with a microtask checkpoint after each of them.
+   * Calls for a platform timer which has been deleted or re-armed since are
+   * ignored.
+   */
   void callTimer(TimerHandle handle);
 
   void attachGlobals(jsi::Runtime& runtime);
@@ -85,12 +118,59 @@ class TimerManager {
 
   void deleteRecurringTimer(jsi::Runtime& runtime, TimerHandle handle);
 
+  TimerWheel::Tick getCurrentTick() const;
+
+  void scheduleTimer(TimerHandle handle, double delay);
+
+  void cancelTimer(TimerHandle handle);
+
+  void callDueTimers(jsi::Runtime& runtime, TimerHandle platformTimerHandle);
+
+  /*
+   * Runs the microtasks queued by a timer before the next one is called, as
+   * the "perform a microtask checkpoint" step of the HTML event loop.
+   * Mirrors `RuntimeScheduler_Modern::performMicrotaskCheckpoint`: errors are
+   * reported and the remaining microtasks drained, up to a retries bound.
+   */
+  void performMicrotaskCheckpoint(jsi::Runtime& runtime);
+
+  /*
+   * Re-arms the platform timer if the earliest deadline is before the one
+   * it's armed for.
+   */
+  void armPlatformTimer(
+      TimerWheel::Tick deadline,
+      TimerWheel::Tick currentTick);
+
   RuntimeExecutor runtimeExecutor_;
   std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry_;
 
+  std::function<Clock::time_point()> now_;
+  const Clock::time_point startTime_;
+
   // A map (id => callback func) of the currently active JS timers
   std::unordered_map<TimerHandle, TimerCallback> timers_;
 
+  // Deadlines of the currently active JS timers, in milliseconds since
+  // `startTime_`.
+  TimerWheel timerWheel_;
+
+  struct PlatformTimer {
+    TimerHandle handle;
+    TimerWheel::Tick deadline;
+  };
+
+  // The platform timer currently armed, if any. Each arming uses a new
+  // handle, so that calls for the timers it replaced can be told apart.
+  std::optional<PlatformTimer> platformTimer_;
+
+  // The handle of the next platform timer armed.
+  TimerHandle platformTimerIndex_{0};
+
+  TimerErrorHandler onError_;
+
+  bool performingMicrotaskCheckpoint_{false};
+
   // Each timeout that is registered on this queue gets a sequential id.  This
   // is the global count from which those are assigned.
   TimerHandle timerIndex_{0};
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace facebook::react {
+
+TimerWheel::TimerWheel(Tick currentTick) : currentTick_(currentTick) {}
+
+bool TimerWheel::empty() const {
+  return nodeIndices_.empty();
+}
+
+size_t TimerWheel::size() const {
+  return nodeIndices_.size();
+}
+
+TimerWheel::Tick TimerWheel::getCurrentTick() const {
+  return currentTick_;
+}
+
+void TimerWheel::schedule(TimerId timerId, Tick deadline) {
+  auto [iterator, inserted] = nodeIndices_.try_emplace(timerId, kNone);
+  if (inserted) {
+    if (freeNodes_.empty()) {
+      iterator->second = static_cast<uint32_t>(nodes_.size());
+      nodes_.emplace_back();
+    } else {
+      iterator->second = freeNodes_.back();
+      freeNodes_.pop_back();
+    }
+  } else {
+    unlink(iterator->second);
+  }
+
+  auto& node = nodes_[iterator->second];
+  node.timerId = timerId;
+  node.deadline = deadline;
+  link(iterator->second, getList(deadline));
+}
+
+bool TimerWheel::cancel(TimerId timerId) {
+  auto iterator = nodeIndices_.find(timerId);
+  if (iterator == nodeIndices_.end()) {
+    return false;
+  }
+
+  unlink(iterator->second);
+  freeNodes_.push_back(iterator->second);
+  nodeIndices_.erase(iterator);
+  return true;
+}
+
+std::optional<TimerWheel::Tick> TimerWheel::getNextDeadline() const {
+  if (lists_[kDueList].head != kNone) {
+    return currentTick_;
+  }
+
+  auto earliestDeadlineOf = [&](uint32_t list) {
+    auto deadline = nodes_[lists_[list].head].deadline;
+    for (auto index = nodes_[lists_[list].head].next; index != kNone;
+         index = nodes_[index].next) {
+      deadline = std::min(deadline, nodes_[index].deadline);
+    }
+    return deadline;
+  };
+
+  for (uint32_t level = 0; level < kLevelCount; level++) {
+    if (occupiedSlots_[level] != 0) {
+      auto slot =
+          static_cast<uint32_t>(std::countr_zero(occupiedSlots_[level]));
+      // Timers on the same level-0 slot share their deadline.
+      return level == 0 ? nodes_[lists_[slot].head].deadline
+                        : earliestDeadlineOf(level * kSlotCount + slot);
+    }
+  }
+
+  if (lists_[kOverflowList].head != kNone) {
+    return earliestDeadlineOf(kOverflowList);
+  }
+
+  return std::nullopt;
+}
+
+void TimerWheel::advance(Tick tick, std::vector<TimerId>& dueTimerIds) {
+  dueBuffer_.clear();
+  collect(kDueList, dueBuffer_);
+
+  while (true) {
+    auto eventTick = getNextEventTick();
+    if (!eventTick || *eventTick > tick) {
+      break;
+    }
+    currentTick_ = *eventTick;
+
+    // Higher levels are cascaded first, as they may fill the lower ones.
+    constexpr auto kWheelBits = kLevelCount * kSlotBits;
+    if ((currentTick_ & ((Tick{1} << kWheelBits) - 1)) == 0) {
+      cascade(kOverflowList);
+    }
+    for (auto level = kLevelCount - 1; level > 0; level--) {
+      auto shift = level * kSlotBits;
+      if ((currentTick_ & ((Tick{1} << shift) - 1)) == 0) {
+        auto slot = (currentTick_ >> shift) & (kSlotCount - 1);
+        cascade(static_cast<uint32_t>(level * kSlotCount + slot));
+      }
+    }
+
+    collect(static_cast<uint32_t>(currentTick_ & (kSlotCount - 1)), dueBuffer_);
+    collect(kDueList, dueBuffer_);
+  }
+
+  currentTick_ = std::max(currentTick_, tick);
+
+  std::sort(dueBuffer_.begin(), dueBuffer_.end());
+  for (const auto& [deadline, timerId] : dueBuffer_) {
+    dueTimerIds.push_back(timerId);
+  }
+}
+
+#pragma mark - Private
+
+uint32_t TimerWheel::getList(Tick deadline) const {
+  if (deadline <= currentTick_) {
+    return kDueList;
+  }
+
+  // The most significant digit in which the deadline differs from the
+  // current tick.
+  auto level = static_cast<uint32_t>(
+      (std::bit_width(deadline ^ currentTick_) - 1) / kSlotBits);
+  if (level >= kLevelCount) {
+    return kOverflowList;
+  }
+
+  auto slot = (deadline >> (level * kSlotBits)) & (kSlotCount - 1);
+  return static_cast<uint32_t>(level * kSlotCount + slot);
+}
+
+std::optional<TimerWheel::Tick> TimerWheel::getNextEventTick() const {
+  if (lists_[kDueList].head != kNone) {
+    return currentTick_;
+  }
+
+  // Occupied slots of a level are always after the current tick's digit on
+  // that level, so the lowest occupied slot of the lowest occupied level is
+  // the next one to process.
+  for (uint32_t level = 0; level < kLevelCount; level++) {
+    if (occupiedSlots_[level] != 0) {
+      auto shift = level * kSlotBits;
+      auto slot = static_cast<Tick>(std::countr_zero(occupiedSlots_[level]));
+      auto base = (currentTick_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+      return base | (slot << shift);
+    }
+  }
+
+  if (lists_[kOverflowList].head != kNone) {
+    constexpr auto kWheelBits = kLevelCount * kSlotBits;
+    return ((currentTick_ >> kWheelBits) + 1) << kWheelBits;
+  }
+
+  return std::nullopt;
+}
+
+void TimerWheel::link(uint32_t nodeIndex, uint32_t list) {
+  auto& node = nodes_[nodeIndex];
+  auto& target = lists_[list];
+  node.list = list;
+  node.previous = target.tail;
+  node.next = kNone;
+  if (target.tail == kNone) {
+    target.head = nodeIndex;
+  } else {
+    nodes_[target.tail].next = nodeIndex;
+  }
+  target.tail = nodeIndex;
+
+  if (list < kDueList) {
+    occupiedSlots_[list / kSlotCount] |= uint64_t{1} << (list % kSlotCount);
+  }
+}
+
+void TimerWheel::unlink(uint32_t nodeIndex) {
+  auto& node = nodes_[nodeIndex];
+  auto& source = lists_[node.list];
+  if (node.previous == kNone) {
+    source.head = node.next;
+  } else {
+    nodes_[node.previous].next = node.next;
+  }
+  if (node.next == kNone) {
+    source.tail = node.previous;
+  } else {
+    nodes_[node.next].previous = node.previous;
+  }
+
+  if (node.list < kDueList && source.head == kNone) {
+    occupiedSlots_[node.list / kSlotCount] &=
+        ~(uint64_t{1} << (node.list % kSlotCount));
+  }
+  node.list = kNone;
+}
+
+void TimerWheel::cascade(uint32_t list) {
+  auto index = lists_[list].head;
+  lists_[list] = {};
+  if (list < kDueList) {
+    occupiedSlots_[list / kSlotCount] &= ~(uint64_t{1} << (list % kSlotCount));
+  }
+
+  while (index != kNone) {
+    auto next = nodes_[index].next;
+    link(index, getList(nodes_[index].deadline));
+    index = next;
+  }
+}
+
+void TimerWheel::collect(
+    uint32_t list,
+    std::vector<std::pair<Tick, TimerId>>& due) {
+  auto index = lists_[list].head;
+  lists_[list] = {};
+  if (list < kDueList) {
+    occupiedSlots_[list / kSlotCount] &= ~(uint64_t{1} << (list % kSlotCount));
+  }
+
+  while (index != kNone) {
+    auto& node = nodes_[index];
+    due.emplace_back(node.deadline, node.timerId);
+    nodeIndices_.erase(node.timerId);
+    node.list = kNone;
+    freeNodes_.push_back(index);
+    index = node.next;
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A hierarchical timing wheel with millisecond ticks, keeping track of the
+ * deadlines of many timers so they can share a single platform timer.
+ *
+ * Every level has 64 slots, each level's slot spanning a full revolution of
+ * the level below (1ms, 64ms, ~4s and ~4.5min per slot). A timer is placed
+ * on the level of the most significant digit in which its deadline differs
+ * from the current tick, and moved down ("cascaded") when the wheel reaches
+ * its slot. Deadlines beyond the last level wait in an overflow list.
+ *
+ * Scheduling and cancelling are O(1); advancing the wheel skips empty slots
+ * using a bitmap of occupied slots per level.
+ *
+ * Not thread safe.
+ */
+class TimerWheel final {
+ public:
+  using Tick = uint64_t;
+  using TimerId = int;
+
+  explicit TimerWheel(Tick currentTick = 0);
+
+  /*
+   * Not copyable.
+   */
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  bool empty() const;
+  size_t size() const;
+
+  Tick getCurrentTick() const;
+
+  /*
+   * Schedules the timer to be due at `deadline`, replacing its previous
+   * deadline if it was scheduled already. Deadlines before the current tick
+   * are due on the next `advance`.
+   */
+  void schedule(TimerId timerId, Tick deadline);
+
+  /*
+   * Returns true if the timer was scheduled.
+   */
+  bool cancel(TimerId timerId);
+
+  /*
+   * Returns the earliest deadline of all scheduled timers.
+   * It's O(1), except for deadlines further than 64ms, which take a scan of
+   * the timers sharing a slot with the earliest one.
+   */
+  std::optional<Tick> getNextDeadline() const;
+
+  /*
+   * Moves the current tick forward to `tick`, removes all timers that are due
+   * by then and appends them to `dueTimerIds`, ordered by deadline and, for
+   * the same deadline, by id.
+   */
+  void advance(Tick tick, std::vector<TimerId>& dueTimerIds);
+
+ private:
+  static constexpr uint32_t kNone = UINT32_MAX;
+  static constexpr Tick kSlotBits = 6;
+  static constexpr uint32_t kSlotCount = 1 << kSlotBits;
+  static constexpr uint32_t kLevelCount = 4;
+  // Timers that are due already, and timers beyond the last level.
+  static constexpr uint32_t kDueList = kLevelCount * kSlotCount;
+  static constexpr uint32_t kOverflowList = kDueList + 1;
+  static constexpr uint32_t kListCount = kOverflowList + 1;
+
+  struct Node {
+    TimerId timerId;
+    Tick deadline;
+    uint32_t list{kNone};
+    uint32_t previous{kNone};
+    uint32_t next{kNone};
+  };
+
+  struct List {
+    uint32_t head{kNone};
+    uint32_t tail{kNone};
+  };
+
+  /*
+   * Returns the list for the deadline, relative to the current tick.
+   */
+  uint32_t getList(Tick deadline) const;
+
+  /*
+   * Returns the next tick at which some slot has to be processed, if any.
+   */
+  std::optional<Tick> getNextEventTick() const;
+
+  void link(uint32_t nodeIndex, uint32_t list);
+  void unlink(uint32_t nodeIndex);
+
+  /*
+   * Re-inserts all timers of the list relative to the current tick.
+   */
+  void cascade(uint32_t list);
+
+  void collect(uint32_t list, std::vector<std::pair<Tick, TimerId>>& due);
+
+  Tick currentTick_;
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> freeNodes_;
+  std::array<List, kListCount> lists_{};
+  std::array<uint64_t, kLevelCount> occupiedSlots_{};
+  std::unordered_map<TimerId, uint32_t> nodeIndices_;
+  std::vector<std::pair<Tick, TimerId>> dueBuffer_;
+};
+
+} // namespace facebook::react
@@ -113,6 +113,17 @@ class HermesJSRuntime : public JSRuntime {
     runtime_->registerForProfiling();
   }
 
+  std::shared_ptr<const jsi::PreparedJavaScript> unstable_prepareScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) override {
+    if (HermesRuntime::isHermesBytecode(buffer->data(), buffer->size())) {
+      // Only the parts of the bytecode needed to start running it.
+      HermesRuntime::prefetchHermesBytecode(buffer->data(), buffer->size());
+      return nullptr;
+    }
+    return JSRuntime::unstable_prepareScript(buffer, sourceURL);
+  }
+
  private:
   std::shared_ptr<HermesRuntime> runtime_;
   std::optional<jsinspector_modern::HermesRuntimeTargetDelegate>
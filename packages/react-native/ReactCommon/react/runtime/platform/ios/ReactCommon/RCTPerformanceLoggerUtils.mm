@@ -59,6 +59,10 @@ static void mapReactMarkerToPerformanceLogger(
     case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
     case ReactMarker::REGISTER_JS_SEGMENT_START:
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
+    case ReactMarker::PREPARE_JS_BUNDLE_START:
+    case ReactMarker::PREPARE_JS_BUNDLE_STOP:
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_START:
+    case ReactMarker::INSTALL_RUNTIME_BINDINGS_STOP:
       // These are not used on iOS.
       break;
   }
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/MessageQueueThread.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/ReactInstance.h>
+#include <react/runtime/hermes/HermesInstance.h>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace facebook::react {
+
+/*
+ * A bundle of ~6MB, mostly function bodies that are never called, like the
+ * lazily required modules of an app.
+ */
+constexpr auto kBundleModuleCount = 20000;
+
+/*
+ * Runs callbacks on its own thread, like the JS thread of an app.
+ */
+class ThreadMessageQueueThread : public MessageQueueThread {
+ public:
+  ThreadMessageQueueThread() : thread_([this]() { loop(); }) {}
+
+  ~ThreadMessageQueueThread() override {
+    quitSynchronous();
+  }
+
+  void runOnQueue(std::function<void()>&& callback) override {
+    {
+      auto lock = std::lock_guard<std::mutex>(mutex_);
+      callbacks_.push_back(std::move(callback));
+    }
+    condition_.notify_one();
+  }
+
+  void runOnQueueSync(std::function<void()>&& callback) override {
+    auto done = std::promise<void>{};
+    runOnQueue([&]() {
+      callback();
+      done.set_value();
+    });
+    done.get_future().wait();
+  }
+
+  void quitSynchronous() override {
+    {
+      auto lock = std::lock_guard<std::mutex>(mutex_);
+      if (quit_) {
+        return;
+      }
+      quit_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+  }
+
+ private:
+  void loop() {
+    while (true) {
+      auto callback = std::function<void()>{};
+      {
+        auto lock = std::unique_lock<std::mutex>(mutex_);
+        condition_.wait(
+            lock, [this]() { return quit_ || !callbacks_.empty(); });
+        if (callbacks_.empty()) {
+          return;
+        }
+        callback = std::move(callbacks_.front());
+        callbacks_.pop_front();
+      }
+      callback();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> callbacks_;
+  bool quit_{false};
+  std::thread thread_;
+};
+
+class NoopTimerRegistry : public PlatformTimerRegistry {
+ public:
+  void createTimer(uint32_t /*timerID*/, double /*delayMS*/) override {}
+  void deleteTimer(uint32_t /*timerID*/) override {}
+  void createRecurringTimer(uint32_t /*timerID*/, double /*delayMS*/)
+      override {}
+};
+
+/*
+ * Writes the bundle to a temporary file, so that it's mapped like bundles
+ * loaded from the file system.
+ */
+class BundleFile {
+ public:
+  BundleFile()
+      : path_(std::filesystem::temp_directory_path() /
+              "ReactInstanceStartupBenchmark.js") {
+    auto file = std::ofstream(path_);
+    for (int i = 0; i < kBundleModuleCount; i++) {
+      auto index = std::to_string(i);
+      file << "function module" << index << "(exports) {"
+           << "  var values = [];"
+           << "  for (var i = 0; i < 100; i++) {"
+           << "    values.push({id: i, name: 'module" << index << "'});"
+           << "  }"
+           << "  exports.values = values;"
+           << "  exports.describe = function() {"
+           << "    return values.map(function(v) { return v.name; });"
+           << "  };"
+           << "  return exports;"
+           << "}\n";
+    }
+    file << "var started = true;\n";
+  }
+
+  ~BundleFile() {
+    std::filesystem::remove(path_);
+  }
+
+  std::unique_ptr<const JSBigString> load() const {
+    return JSBigFileString::fromPath(path_);
+  }
+
+  const std::string& getPath() const {
+    return path_;
+  }
+
+ private:
+  std::string path_;
+};
+
+/*
+ * Starts an instance the way platforms do, and waits until the bundle has
+ * run. With `overlapped`, the bundle is handed over right away instead of
+ * after the runtime is initialized.
+ */
+static void startInstance(const BundleFile& bundle, bool overlapped) {
+  auto jsThread = std::make_shared<ThreadMessageQueueThread>();
+  auto timerManager =
+      std::make_shared<TimerManager>(std::make_unique<NoopTimerRegistry>());
+  auto instance = std::make_unique<ReactInstance>(
+      HermesInstance::createJSRuntime(nullptr, jsThread, false),
+      jsThread,
+      timerManager,
+      [](jsi::Runtime& /*runtime*/,
+         const JsErrorHandler::ProcessedError& /*error*/) noexcept {});
+  timerManager->setRuntimeExecutor(instance->getBufferedRuntimeExecutor());
+
+  auto initialized = std::promise<void>{};
+  instance->initializeRuntime(
+      {.isProfiling = false}, [&](jsi::Runtime& /*runtime*/) {
+        initialized.set_value();
+      });
+  if (!overlapped) {
+    initialized.get_future().wait();
+  }
+
+  auto loaded = std::promise<void>{};
+  instance->loadScript(
+      bundle.load(), bundle.getPath(), [&](jsi::Runtime& /*runtime*/) {
+        loaded.set_value();
+      });
+  loaded.get_future().wait();
+
+  jsThread->runOnQueueSync([&]() { instance.reset(); });
+}
+
+static void startWithBundleAfterInitialization(benchmark::State& state) {
+  auto bundle = BundleFile{};
+  for (auto _ : state) {
+    startInstance(bundle, false);
+  }
+}
+BENCHMARK(startWithBundleAfterInitialization)->Unit(benchmark::kMillisecond);
+
+static void startWithBundleDuringInitialization(benchmark::State& state) {
+  auto bundle = BundleFile{};
+  for (auto _ : state) {
+    startInstance(bundle, true);
+  }
+}
+BENCHMARK(startWithBundleDuringInitialization)->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/TimerManager.h>
+#include <react/runtime/TimerWheel.h>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * 10k short timers (up to a frame long) created at once, then run
+ * millisecond by millisecond. And debouncing: every millisecond, a pending
+ * timer of one of 100 inputs is cleared and created again 300ms later.
+ */
+constexpr auto kShortTimerCount = 10000;
+constexpr auto kShortTimerMaxDelay = 16;
+constexpr auto kDebounceStepCount = 10000;
+constexpr auto kDebounceInputCount = 100;
+constexpr auto kDebounceDelay = 300;
+
+#pragma mark - Timer wheel
+
+static void shortTimersWithTimerWheel(benchmark::State& state) {
+  auto due = std::vector<TimerWheel::TimerId>{};
+  due.reserve(kShortTimerCount);
+  for (auto _ : state) {
+    auto wheel = TimerWheel{};
+    for (int i = 0; i < kShortTimerCount; i++) {
+      wheel.schedule(i, i % kShortTimerMaxDelay);
+    }
+    for (TimerWheel::Tick tick = 0; !wheel.empty(); tick++) {
+      due.clear();
+      wheel.advance(tick, due);
+    }
+    benchmark::DoNotOptimize(due.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kShortTimerCount);
+}
+BENCHMARK(shortTimersWithTimerWheel);
+
+/*
+ * Same workload with timers ordered by deadline in a tree, the usual way to
+ * multiplex timers without a wheel.
+ */
+static void shortTimersWithOrderedSet(benchmark::State& state) {
+  auto due = std::vector<TimerWheel::TimerId>{};
+  due.reserve(kShortTimerCount);
+  for (auto _ : state) {
+    auto timers = std::set<std::pair<TimerWheel::Tick, TimerWheel::TimerId>>{};
+    for (int i = 0; i < kShortTimerCount; i++) {
+      timers.emplace(i % kShortTimerMaxDelay, i);
+    }
+    for (TimerWheel::Tick tick = 0; !timers.empty(); tick++) {
+      due.clear();
+      while (!timers.empty() && timers.begin()->first <= tick) {
+        due.push_back(timers.begin()->second);
+        timers.erase(timers.begin());
+      }
+    }
+    benchmark::DoNotOptimize(due.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kShortTimerCount);
+}
+BENCHMARK(shortTimersWithOrderedSet);
+
+static void debounceWithTimerWheel(benchmark::State& state) {
+  auto due = std::vector<TimerWheel::TimerId>{};
+  for (auto _ : state) {
+    auto generator = std::mt19937{42};
+    auto wheel = TimerWheel{};
+    for (TimerWheel::Tick tick = 0; tick < kDebounceStepCount; tick++) {
+      auto input = static_cast<int>(generator() % kDebounceInputCount);
+      wheel.cancel(input);
+      wheel.schedule(input, tick + kDebounceDelay);
+
+      due.clear();
+      wheel.advance(tick, due);
+    }
+    benchmark::DoNotOptimize(due.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kDebounceStepCount);
+}
+BENCHMARK(debounceWithTimerWheel);
+
+static void debounceWithOrderedSet(benchmark::State& state) {
+  auto due = std::vector<TimerWheel::TimerId>{};
+  for (auto _ : state) {
+    auto generator = std::mt19937{42};
+    auto timers = std::set<std::pair<TimerWheel::Tick, TimerWheel::TimerId>>{};
+    auto deadlines = std::vector<TimerWheel::Tick>(kDebounceInputCount, 0);
+    auto pending = std::vector<bool>(kDebounceInputCount, false);
+    for (TimerWheel::Tick tick = 0; tick < kDebounceStepCount; tick++) {
+      auto input = static_cast<int>(generator() % kDebounceInputCount);
+      if (pending[input]) {
+        timers.erase({deadlines[input], input});
+      }
+      deadlines[input] = tick + kDebounceDelay;
+      pending[input] = true;
+      timers.emplace(deadlines[input], input);
+
+      due.clear();
+      while (!timers.empty() && timers.begin()->first <= tick) {
+        pending[timers.begin()->second] = false;
+        due.push_back(timers.begin()->second);
+        timers.erase(timers.begin());
+      }
+    }
+    benchmark::DoNotOptimize(due.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kDebounceStepCount);
+}
+BENCHMARK(debounceWithOrderedSet);
+
+#pragma mark - TimerManager
+
+/*
+ * Counts the calls that previously happened once or twice per JavaScript
+ * timer, and keeps the id of the timer created last.
+ */
+class CountingTimerRegistry : public PlatformTimerRegistry {
+ public:
+  CountingTimerRegistry(size_t& callCount, uint32_t& lastTimerID)
+      : callCount_(callCount), lastTimerID_(lastTimerID) {}
+
+  void createTimer(uint32_t timerID, double /*delayMS*/) override {
+    callCount_++;
+    lastTimerID_ = timerID;
+  }
+
+  void deleteTimer(uint32_t /*timerID*/) override {
+    callCount_++;
+  }
+
+  void createRecurringTimer(uint32_t /*timerID*/, double /*delayMS*/)
+      override {
+    callCount_++;
+  }
+
+ private:
+  size_t& callCount_;
+  uint32_t& lastTimerID_;
+};
+
+/*
+ * Runs scripts with the JavaScript timer APIs on a stub clock, firing the
+ * platform timer whenever the clock moves forward. Runtime executor calls are
+ * queued and flushed like on the JavaScript thread.
+ */
+class TimerManagerBenchmark {
+ public:
+  TimerManagerBenchmark()
+      : runtime_(facebook::hermes::makeHermesRuntime()),
+        timerManager_(std::make_shared<TimerManager>(
+            std::make_unique<CountingTimerRegistry>(
+                platformTimerCallCount_, platformTimerID_),
+            [this]() { return now_; })) {
+    timerManager_->setRuntimeExecutor(getRuntimeExecutor());
+    timerManager_->attachGlobals(*runtime_);
+  }
+
+  RuntimeExecutor getRuntimeExecutor() {
+    return [this](std::function<void(jsi::Runtime & runtime)>&& callback) {
+      runtimeExecutorCallCount_++;
+      pendingCallbacks_.push_back(std::move(callback));
+    };
+  }
+
+  jsi::Runtime& getRuntime() {
+    return *runtime_;
+  }
+
+  void run(const std::string& script) {
+    runtime_->evaluateJavaScript(
+        std::make_unique<jsi::StringBuffer>(script), "");
+  }
+
+  void advanceTimeBy(std::chrono::milliseconds duration) {
+    now_ += duration;
+    timerManager_->callTimer(static_cast<TimerHandle>(platformTimerID_));
+    flush();
+  }
+
+  void flush() {
+    while (!pendingCallbacks_.empty()) {
+      auto callbacks = std::move(pendingCallbacks_);
+      pendingCallbacks_.clear();
+      for (auto& callback : callbacks) {
+        callback(*runtime_);
+        runtime_->drainMicrotasks();
+      }
+    }
+  }
+
+  size_t getPlatformTimerCallCount() const {
+    return platformTimerCallCount_;
+  }
+
+  size_t getRuntimeExecutorCallCount() const {
+    return runtimeExecutorCallCount_;
+  }
+
+ private:
+  size_t platformTimerCallCount_{0};
+  uint32_t platformTimerID_{0};
+  size_t runtimeExecutorCallCount_{0};
+  std::vector<std::function<void(jsi::Runtime & runtime)>> pendingCallbacks_;
+  TimerManager::Clock::time_point now_{};
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<TimerManager> timerManager_;
+};
+
+static void setTimeoutOf10kShortTimers(benchmark::State& state) {
+  auto benchmark = TimerManagerBenchmark{};
+  benchmark.run(
+      "var fired = 0; function onTimeout() { fired++; }"
+      "function start(count, maxDelay) {"
+      "  for (var i = 0; i < count; i++) setTimeout(onTimeout, i % maxDelay);"
+      "}");
+  auto script = "start(" + std::to_string(kShortTimerCount) + ", " +
+      std::to_string(kShortTimerMaxDelay) + ");";
+  for (auto _ : state) {
+    benchmark.run(script);
+    for (int i = 0; i <= kShortTimerMaxDelay; i++) {
+      benchmark.advanceTimeBy(std::chrono::milliseconds(1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kShortTimerCount);
+  state.counters["platformTimerCallsPerTimer"] =
+      static_cast<double>(benchmark.getPlatformTimerCallCount()) /
+      static_cast<double>(state.iterations() * kShortTimerCount);
+}
+BENCHMARK(setTimeoutOf10kShortTimers);
+
+static void debounceWithTimerManager(benchmark::State& state) {
+  auto benchmark = TimerManagerBenchmark{};
+  benchmark.run(
+      "var handles = []; function onTimeout() {}"
+      "function onInput(input, delay) {"
+      "  clearTimeout(handles[input]);"
+      "  handles[input] = setTimeout(onTimeout, delay);"
+      "}");
+  auto generator = std::mt19937{42};
+  for (auto _ : state) {
+    for (int step = 0; step < kDebounceStepCount; step++) {
+      benchmark.run(
+          "onInput(" + std::to_string(generator() % kDebounceInputCount) +
+          ", " + std::to_string(kDebounceDelay) + ");");
+      benchmark.advanceTimeBy(std::chrono::milliseconds(1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kDebounceStepCount);
+  state.counters["platformTimerCallsPerInput"] =
+      static_cast<double>(benchmark.getPlatformTimerCallCount()) /
+      static_cast<double>(state.iterations() * kDebounceStepCount);
+}
+BENCHMARK(debounceWithTimerManager);
+
+/*
+ * JavaScript thread overhead of timers expiring in the same millisecond:
+ * they now run in a single runtime executor call.
+ */
+constexpr auto kSameTickTimerCount = 1000;
+
+static void expireSameTickTimers(benchmark::State& state) {
+  auto benchmark = TimerManagerBenchmark{};
+  benchmark.run(
+      "var fired = 0; function onTimeout() { fired++; }"
+      "function start(count) {"
+      "  for (var i = 0; i < count; i++) setTimeout(onTimeout, 1);"
+      "}");
+  auto script = "start(" + std::to_string(kSameTickTimerCount) + ");";
+  auto runtimeExecutorCallCount = size_t{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    benchmark.run(script);
+    auto initialCallCount = benchmark.getRuntimeExecutorCallCount();
+    state.ResumeTiming();
+
+    benchmark.advanceTimeBy(std::chrono::milliseconds(1));
+    runtimeExecutorCallCount +=
+        benchmark.getRuntimeExecutorCallCount() - initialCallCount;
+  }
+  state.SetItemsProcessed(state.iterations() * kSameTickTimerCount);
+  state.counters["runtimeExecutorCallsPerTimer"] =
+      static_cast<double>(runtimeExecutorCallCount) /
+      static_cast<double>(state.iterations() * kSameTickTimerCount);
+}
+BENCHMARK(expireSameTickTimers);
+
+/*
+ * Same workload the previous way: one runtime executor call per expiring
+ * timer, each followed by a microtask checkpoint.
+ */
+static void expireSameTickTimersOneByOne(benchmark::State& state) {
+  auto benchmark = TimerManagerBenchmark{};
+  benchmark.run("var fired = 0; function onTimeout() { fired++; }");
+  auto onTimeout = benchmark.getRuntime().global().getPropertyAsFunction(
+      benchmark.getRuntime(), "onTimeout");
+  auto runtimeExecutor = benchmark.getRuntimeExecutor();
+  for (auto _ : state) {
+    for (int i = 0; i < kSameTickTimerCount; i++) {
+      runtimeExecutor(
+          [&](jsi::Runtime& runtime) { onTimeout.call(runtime); });
+    }
+    benchmark.flush();
+  }
+  state.SetItemsProcessed(state.iterations() * kSameTickTimerCount);
+  state.counters["runtimeExecutorCallsPerTimer"] = 1;
+}
+BENCHMARK(expireSameTickTimersOneByOne);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -5,8 +5,12 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <thread>
+#include <unordered_map>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -354,19 +358,118 @@ function clear() {
   timerManager_->callTimer(timerID);
   step();
 
-  // Now clear the called timer
-  EXPECT_CALL(*mockRegistry_, deleteTimer(timerID));
+  // Now clear the called timer. The platform timer isn't armed anymore.
+  EXPECT_CALL(*mockRegistry_, deleteTimer(_)).Times(0);
   auto clear = runtime_->global().getPropertyAsFunction(*runtime_, "clear");
   EXPECT_NO_THROW(clear.call(*runtime_));
 }
 
-TEST_F(ReactInstanceTest, testSetInterval) {
+TEST_F(ReactInstanceTest, testTimersShareThePlatformTimer) {
+  initializeRuntimeWithScript("");
+
+  // Armed for the first timers, then for the last one.
+  uint32_t timerID{0};
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .Times(2)
+      .WillRepeatedly(SaveArg<0>(&timerID));
+  EXPECT_CALL(*mockRegistry_, deleteTimer(_)).Times(0);
+  eval(R"xyz123(
+let calls = [];
+setTimeout(() => calls.push('a'), 100);
+setTimeout(() => calls.push('b'), 200);
+setTimeout(() => calls.push('c'), 100);
+function getResult() {
+  return calls.join();
+}
+  )xyz123");
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+
+  timerManager_->callTimer(timerID);
+  step();
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_), "a,c");
+
+  timerManager_->callTimer(timerID);
+  step();
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_), "a,c,b");
+}
+
+TEST_F(ReactInstanceTest, testIgnoresCallsOfReplacedPlatformTimers) {
+  initializeRuntimeWithScript("");
+
+  uint32_t firstTimerID{0};
+  uint32_t secondTimerID{0};
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillOnce(SaveArg<0>(&firstTimerID));
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 300))
+      .WillOnce(SaveArg<0>(&secondTimerID));
+  eval(R"xyz123(
+let called = false;
+clearTimeout(setTimeout(() => {}, 100));
+setTimeout(() => {
+  called = true;
+}, 300);
+function getResult() {
+  return called;
+}
+  )xyz123");
+  EXPECT_NE(firstTimerID, secondTimerID);
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+
+  // The first platform timer fired before it was deleted.
+  timerManager_->callTimer(firstTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).getBool(), false);
+
+  timerManager_->callTimer(secondTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).getBool(), true);
+}
+
+TEST_F(ReactInstanceTest, testReportsErrorsOfEachTimer) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
       .WillOnce(SaveArg<0>(&timerID));
   eval(R"xyz123(
+let called = false;
+setTimeout(() => {
+  throw new Error('first');
+}, 100);
+setTimeout(() => {
+  throw new Error('second');
+}, 100);
+setTimeout(() => {
+  called = true;
+}, 100);
+function getResult() {
+  return called;
+}
+  )xyz123");
+  timerManager_->callTimer(timerID);
+  step();
+
+  EXPECT_EQ(errorHandler_->size(), 2);
+  EXPECT_THAT(getLastErrorMessage(), HasSubstr("second"));
+  EXPECT_THAT(getLastErrorMessage(), HasSubstr("first"));
+  auto called = runtime_->global()
+                    .getPropertyAsFunction(*runtime_, "getResult")
+                    .call(*runtime_);
+  EXPECT_EQ(called.getBool(), true);
+}
+
+TEST_F(ReactInstanceTest, testSetInterval) {
+  initializeRuntimeWithScript("");
+
+  uint32_t timerID{0};
+  // Re-armed for the next call every time the interval is called.
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
+  eval(R"xyz123(
 let result = 0;
 setInterval(() => {
   result++;
@@ -391,8 +494,9 @@ TEST_F(ReactInstanceTest, testSetIntervalWithPassThroughArgs) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
-      .WillOnce(SaveArg<0>(&timerID));
+  // Re-armed for the next call every time the interval is called.
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
   eval(R"xyz123(
 let result;
 setInterval(arg => {
@@ -426,8 +530,9 @@ TEST_F(ReactInstanceTest, testClearInterval) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
-      .WillOnce(SaveArg<0>(&timerID));
+  // Re-armed for the next call every time the interval is called.
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
   eval(R"xyz123(
 let result = 0;
 const handle = setInterval(() => {
@@ -626,7 +731,8 @@ function getResult() {
                     .call(*runtime_);
   EXPECT_EQ(called.getBool(), true);
 
-  EXPECT_CALL(*mockRegistry_, deleteTimer(timerID));
+  // The platform timer isn't armed anymore.
+  EXPECT_CALL(*mockRegistry_, deleteTimer(_)).Times(0);
   auto clear = runtime_->global().getPropertyAsFunction(*runtime_, "clear");
   // Canceling an expired timer should fail silently.
   EXPECT_NO_THROW(clear.call(*runtime_));
@@ -741,4 +847,126 @@ function getResult() {
   EXPECT_EQ(result.getNumber(), 1);
 }
 
+/*
+ * Prepares scripts with another runtime, recording the preparing threads.
+ * Preparations wait until `releasePreparations` is called, if
+ * `holdPreparations` was called before.
+ */
+class PreparingRuntimeHolder : public JSIRuntimeHolder {
+ public:
+  PreparingRuntimeHolder()
+      : JSIRuntimeHolder(hermes::makeHermesRuntime()),
+        compiler_(hermes::makeHermesRuntime()) {
+    release_.set_value();
+    released_ = release_.get_future().share();
+  }
+
+  std::shared_ptr<const jsi::PreparedJavaScript> unstable_prepareScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) override {
+    auto released = std::shared_future<void>{};
+    {
+      std::scoped_lock lock(mutex_);
+      preparingThreadIds_[sourceURL] = std::this_thread::get_id();
+      released = released_;
+    }
+    released.wait();
+    return compiler_->prepareJavaScript(buffer, sourceURL);
+  }
+
+  void holdPreparations() {
+    std::scoped_lock lock(mutex_);
+    release_ = std::promise<void>{};
+    released_ = release_.get_future().share();
+  }
+
+  void releasePreparations() {
+    std::scoped_lock lock(mutex_);
+    release_.set_value();
+  }
+
+  std::thread::id getPreparingThreadId(const std::string& sourceURL) {
+    std::scoped_lock lock(mutex_);
+    return preparingThreadIds_[sourceURL];
+  }
+
+ private:
+  std::unique_ptr<jsi::Runtime> compiler_;
+  std::mutex mutex_;
+  std::promise<void> release_;
+  std::shared_future<void> released_;
+  std::unordered_map<std::string, std::thread::id> preparingThreadIds_;
+};
+
+TEST(ReactInstancePrepareScriptTest, evaluatesScriptPreparedInBackground) {
+  auto runtime = std::make_unique<PreparingRuntimeHolder>();
+  auto* runtimeHolder = runtime.get();
+  auto messageQueueThread = std::make_shared<MockMessageQueueThread>();
+  auto timerManager = std::make_shared<TimerManager>(
+      std::make_unique<MockTimerRegistry>());
+  auto instance = std::make_unique<ReactInstance>(
+      std::move(runtime),
+      messageQueueThread,
+      timerManager,
+      [](jsi::Runtime& /*runtime*/,
+         const JsErrorHandler::ProcessedError& /*error*/) noexcept {});
+  timerManager->setRuntimeExecutor(instance->getBufferedRuntimeExecutor());
+
+  // The script is loaded while the runtime is still being initialized.
+  instance->initializeRuntime(
+      {.isProfiling = false}, [](jsi::Runtime& /*runtime*/) {});
+  instance->loadScript(
+      std::make_unique<JSBigStdString>("var prepared = 42;"), "prepared.js");
+  while (messageQueueThread->size() > 0) {
+    messageQueueThread->guardedTick();
+  }
+
+  auto& jsiRuntime = runtimeHolder->getRuntime();
+  EXPECT_EQ(
+      jsiRuntime.global().getProperty(jsiRuntime, "prepared").getNumber(), 42);
+  auto preparingThreadId = runtimeHolder->getPreparingThreadId("prepared.js");
+  EXPECT_NE(preparingThreadId, std::thread::id{});
+  EXPECT_NE(preparingThreadId, std::this_thread::get_id());
+}
+
+TEST(ReactInstancePrepareScriptTest, preparesOneScriptInBackgroundAtATime) {
+  auto runtime = std::make_unique<PreparingRuntimeHolder>();
+  auto* runtimeHolder = runtime.get();
+  auto messageQueueThread = std::make_shared<MockMessageQueueThread>();
+  auto timerManager = std::make_shared<TimerManager>(
+      std::make_unique<MockTimerRegistry>());
+  auto instance = std::make_unique<ReactInstance>(
+      std::move(runtime),
+      messageQueueThread,
+      timerManager,
+      [](jsi::Runtime& /*runtime*/,
+         const JsErrorHandler::ProcessedError& /*error*/) noexcept {});
+  timerManager->setRuntimeExecutor(instance->getBufferedRuntimeExecutor());
+
+  instance->initializeRuntime(
+      {.isProfiling = false}, [](jsi::Runtime& /*runtime*/) {});
+  runtimeHolder->holdPreparations();
+  instance->loadScript(
+      std::make_unique<JSBigStdString>("var first = 1;"), "first.js");
+  // The first script is still being prepared in the background.
+  instance->loadScript(
+      std::make_unique<JSBigStdString>("var second = 2;"), "second.js");
+  runtimeHolder->releasePreparations();
+  while (messageQueueThread->size() > 0) {
+    messageQueueThread->guardedTick();
+  }
+
+  auto& jsiRuntime = runtimeHolder->getRuntime();
+  EXPECT_EQ(
+      jsiRuntime.global().getProperty(jsiRuntime, "first").getNumber(), 1);
+  EXPECT_EQ(
+      jsiRuntime.global().getProperty(jsiRuntime, "second").getNumber(), 2);
+  EXPECT_NE(
+      runtimeHolder->getPreparingThreadId("first.js"),
+      std::this_thread::get_id());
+  EXPECT_EQ(
+      runtimeHolder->getPreparingThreadId("second.js"),
+      std::this_thread::get_id());
+}
+
 } // namespace facebook::react
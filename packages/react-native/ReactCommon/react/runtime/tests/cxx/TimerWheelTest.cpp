@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/TimerWheel.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(TimerWheelTest, firesTimersWhenDue) {
+  auto wheel = TimerWheel{};
+  wheel.schedule(1, 10);
+  wheel.schedule(2, 5);
+  wheel.schedule(3, 100);
+
+  EXPECT_EQ(wheel.size(), 3);
+  EXPECT_EQ(wheel.getNextDeadline(), 5);
+
+  auto due = std::vector<TimerWheel::TimerId>{};
+  wheel.advance(4, due);
+  EXPECT_TRUE(due.empty());
+
+  wheel.advance(10, due);
+  EXPECT_EQ(due, (std::vector<TimerWheel::TimerId>{2, 1}));
+  EXPECT_EQ(wheel.getNextDeadline(), 100);
+
+  due.clear();
+  wheel.advance(1000, due);
+  EXPECT_EQ(due, (std::vector<TimerWheel::TimerId>{3}));
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.getNextDeadline(), std::nullopt);
+  EXPECT_EQ(wheel.getCurrentTick(), 1000);
+}
+
+TEST(TimerWheelTest, firesTimersWithTheSameDeadlineById) {
+  auto wheel = TimerWheel{};
+  auto due = std::vector<TimerWheel::TimerId>{};
+  // Placed on different levels, then cascaded into the same slot.
+  wheel.schedule(3, 5000);
+  wheel.advance(4990, due);
+  wheel.schedule(1, 5000);
+  wheel.schedule(2, 5000);
+
+  wheel.advance(5000, due);
+  EXPECT_EQ(due, (std::vector<TimerWheel::TimerId>{1, 2, 3}));
+}
+
+TEST(TimerWheelTest, firesPastDeadlinesOnNextAdvance) {
+  auto wheel = TimerWheel{100};
+  wheel.schedule(1, 50);
+  EXPECT_EQ(wheel.getNextDeadline(), 100);
+
+  auto due = std::vector<TimerWheel::TimerId>{};
+  wheel.advance(100, due);
+  EXPECT_EQ(due, (std::vector<TimerWheel::TimerId>{1}));
+}
+
+TEST(TimerWheelTest, cancelsAndReschedulesTimers) {
+  auto wheel = TimerWheel{};
+  wheel.schedule(1, 10);
+  wheel.schedule(2, 20);
+
+  EXPECT_TRUE(wheel.cancel(1));
+  EXPECT_FALSE(wheel.cancel(1));
+  EXPECT_EQ(wheel.getNextDeadline(), 20);
+
+  // Debouncing: the deadline moves further with every reschedule.
+  wheel.schedule(2, 300);
+  wheel.schedule(2, 70000);
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(wheel.getNextDeadline(), 70000);
+
+  auto due = std::vector<TimerWheel::TimerId>{};
+  wheel.advance(69999, due);
+  EXPECT_TRUE(due.empty());
+  wheel.advance(70000, due);
+  EXPECT_EQ(due, (std::vector<TimerWheel::TimerId>{2}));
+}
+
+TEST(TimerWheelTest, matchesSortedDeadlines) {
+  auto wheel = TimerWheel{};
+  auto deadlines = std::map<TimerWheel::TimerId, TimerWheel::Tick>{};
+  auto generator = std::mt19937{42};
+  auto currentTick = TimerWheel::Tick{0};
+
+  for (TimerWheel::TimerId timerId = 0; timerId < 5000; timerId++) {
+    // Delays on all levels, including beyond the last one.
+    auto delay = generator() % (TimerWheel::Tick{1} << (1 + generator() % 28));
+    switch (generator() % 4) {
+      case 0:
+        if (!deadlines.empty()) {
+          auto cancelled = deadlines.begin()->first;
+          EXPECT_TRUE(wheel.cancel(cancelled));
+          deadlines.erase(cancelled);
+        }
+        break;
+      case 1: {
+        auto step = generator() % (TimerWheel::Tick{1} << (generator() % 24));
+        currentTick += step;
+
+        auto due = std::vector<TimerWheel::TimerId>{};
+        wheel.advance(currentTick, due);
+
+        auto expected = std::vector<std::pair<TimerWheel::Tick, int>>{};
+        for (auto iterator = deadlines.begin(); iterator != deadlines.end();) {
+          if (iterator->second <= currentTick) {
+            expected.emplace_back(iterator->second, iterator->first);
+            iterator = deadlines.erase(iterator);
+          } else {
+            iterator++;
+          }
+        }
+        std::sort(expected.begin(), expected.end());
+        auto expectedIds = std::vector<TimerWheel::TimerId>{};
+        for (const auto& [deadline, id] : expected) {
+          expectedIds.push_back(id);
+        }
+        ASSERT_EQ(due, expectedIds);
+        break;
+      }
+      default:
+        wheel.schedule(timerId, currentTick + delay);
+        deadlines[timerId] = currentTick + delay;
+        break;
+    }
+
+    ASSERT_EQ(wheel.size(), deadlines.size());
+    if (deadlines.empty()) {
+      EXPECT_EQ(wheel.getNextDeadline(), std::nullopt);
+    } else {
+      auto earliest = std::min_element(
+          deadlines.begin(),
+          deadlines.end(),
+          [](const auto& lhs, const auto& rhs) {
+            return lhs.second < rhs.second;
+          });
+      EXPECT_EQ(
+          wheel.getNextDeadline(), std::max(earliest->second, currentTick));
+    }
+  }
+}
+
+} // namespace facebook::react
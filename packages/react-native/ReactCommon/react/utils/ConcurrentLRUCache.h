@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Thread-safe LRU cache split into independently locked shards.
+ *
+ * Unlike `SimpleThreadSafeCache`, values are generated outside of any lock,
+ * so a slow generator (e.g. text measurement) only blocks threads that ask for
+ * the very same key. Concurrent requests for a key that is being generated
+ * wait for the in-flight computation instead of running the generator again.
+ *
+ * `maxSize` is split between the shards, and every shard evicts its least
+ * recently used entries independently, so the cache holds at most `maxSize`
+ * entries in total.
+ */
+template <
+    typename KeyT,
+    typename ValueT,
+    typename HashT = std::hash<KeyT>,
+    typename KeyEqualT = std::equal_to<KeyT>>
+class ConcurrentLRUCache {
+ public:
+  static constexpr size_t kDefaultShardCount = 8;
+
+  explicit ConcurrentLRUCache(
+      size_t maxSize,
+      size_t shardCount = kDefaultShardCount)
+      : shards_(std::clamp(
+            shardCount,
+            size_t{1},
+            std::max(size_t{1}, maxSize))) {
+    // The first `maxSize % shards_.size()` shards get one more entry.
+    for (size_t i = 0; i < shards_.size(); i++) {
+      shards_[i].maxSize = std::max(size_t{1}, maxSize / shards_.size()) +
+          (i < maxSize % shards_.size() ? 1 : 0);
+    }
+  }
+
+  /*
+   * Returns a value from the cache with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it. If another
+   * thread is already generating the value for the same key, waits for it
+   * instead. The generator runs outside of any lock. If it asks for the key
+   * it's generating, the nested call runs the generator again, without
+   * caching the result, instead of waiting for itself.
+   * Can be called from any thread.
+   */
+  ValueT get(const KeyT& key, std::function<ValueT(const KeyT& key)> generator)
+      const {
+    auto& shard = shardForKey(key);
+
+    auto promise = std::promise<ValueT>{};
+    auto future = std::shared_future<ValueT>{};
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (auto value = shard.find(key)) {
+        return *value;
+      }
+
+      auto inFlight = shard.inFlight.find(key);
+      if (inFlight == shard.inFlight.end()) {
+        shard.inFlight.emplace(
+            key,
+            InFlight{promise.get_future().share(), std::this_thread::get_id()});
+      } else if (inFlight->second.thread != std::this_thread::get_id()) {
+        future = inFlight->second.future;
+      } else {
+        // Reentrant call from the generator.
+        return generator(key);
+      }
+    }
+
+    if (future.valid()) {
+      return future.get();
+    }
+
+    auto value = std::optional<ValueT>{};
+    try {
+      value = generator(key);
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.inFlight.erase(key);
+      }
+      promise.set_exception(std::current_exception());
+      throw;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.set(key, *value);
+      shard.inFlight.erase(key);
+    }
+    promise.set_value(*value);
+
+    return std::move(*value);
+  }
+
+  /*
+   * Returns a value from the cache with a given key.
+   * If the value wasn't found in the cache, returns empty optional.
+   * Can be called from any thread.
+   */
+  std::optional<ValueT> get(const KeyT& key) const {
+    auto& shard = shardForKey(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.find(key);
+  }
+
+  /*
+   * Sets a key-value pair in the LRU cache.
+   * Can be called from any thread.
+   */
+  void set(const KeyT& key, const ValueT& value) const {
+    auto& shard = shardForKey(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.set(key, value);
+  }
+
+  /*
+   * Removes all cached entries. Values being generated right now are still
+   * stored once they are ready.
+   * Can be called from any thread.
+   */
+  void clear() const {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.index.clear();
+      shard.entries.clear();
+    }
+  }
+
+  /*
+   * Returns the number of cached entries.
+   * Can be called from any thread.
+   */
+  size_t size() const {
+    auto result = size_t{0};
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += shard.entries.size();
+    }
+    return result;
+  }
+
+ private:
+  using KeyRef = std::reference_wrapper<const KeyT>;
+  using Entries = std::list<std::pair<KeyT, ValueT>>;
+
+  struct InFlight {
+    std::shared_future<ValueT> future;
+    // The thread running the generator.
+    std::thread::id thread;
+  };
+
+  struct Shard {
+    size_t maxSize{1};
+    // Most recently used entries are at the front.
+    Entries entries;
+    // Keys refer to the keys stored in `entries`, list nodes are stable.
+    std::unordered_map<KeyRef, typename Entries::iterator, HashT, KeyEqualT>
+        index;
+    std::unordered_map<KeyT, InFlight, HashT, KeyEqualT> inFlight;
+    std::mutex mutex;
+
+    std::optional<ValueT> find(const KeyT& key) {
+      auto iterator = index.find(key);
+      if (iterator == index.end()) {
+        return {};
+      }
+
+      entries.splice(entries.begin(), entries, iterator->second);
+      return iterator->second->second;
+    }
+
+    void set(const KeyT& key, const ValueT& value) {
+      auto iterator = index.find(key);
+      if (iterator != index.end()) {
+        iterator->second->second = value;
+        entries.splice(entries.begin(), entries, iterator->second);
+        return;
+      }
+
+      entries.emplace_front(key, value);
+      index.emplace(std::cref(entries.front().first), entries.begin());
+
+      if (entries.size() > maxSize) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+      }
+    }
+  };
+
+  Shard& shardForKey(const KeyT& key) const {
+    // Mixing the hash so that shards don't correlate with the buckets of the
+    // per-shard hash tables.
+    auto hash = HashT{}(key) * static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+    return shards_[(hash >> 16) % shards_.size()];
+  }
+
+  mutable std::vector<Shard> shards_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Unbounded lock-free multi-producer single-consumer queue.
+ *
+ * Producers push nodes onto an intrusive atomic stack with a single CAS. The
+ * consumer detaches the whole stack with one atomic exchange and reverses it,
+ * so items are drained in the order in which their `push` calls linearized.
+ * Because the consumer never pops individual nodes, the stack is not prone to
+ * the ABA problem.
+ *
+ * The queue only knows push order. Values that need another order, e.g. by
+ * timestamp, have to be sorted by the caller after draining.
+ *
+ * Every `push` allocates a node, and there is no capacity bound: the queue
+ * grows for as long as the consumer doesn't drain it.
+ *
+ * `push` can be called from any thread. `drain` must not be called
+ * concurrently with itself (the caller is responsible for serializing
+ * consumers).
+ */
+template <typename T>
+class LockFreeMPSCQueue {
+ public:
+  LockFreeMPSCQueue() = default;
+
+  ~LockFreeMPSCQueue() {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+      auto next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  // not copyable, not movable
+  LockFreeMPSCQueue(const LockFreeMPSCQueue&) = delete;
+  LockFreeMPSCQueue& operator=(const LockFreeMPSCQueue&) = delete;
+
+  /*
+   * Enqueues a given value.
+   * Can be called from any thread.
+   */
+  void push(T&& value) {
+    auto node =
+        new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+    while (!head_.compare_exchange_weak(
+        node->next,
+        node,
+        std::memory_order_release,
+        std::memory_order_relaxed)) {
+    }
+  }
+
+  /*
+   * Removes all enqueued values and appends them to `destination` in the
+   * order they were pushed. Returns the number of drained values.
+   */
+  size_t drain(std::vector<T>& destination) {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+    if (node == nullptr) {
+      return 0;
+    }
+
+    // The detached stack is in reverse push order.
+    Node* reversed = nullptr;
+    size_t count = 0;
+    while (node != nullptr) {
+      auto next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+      count++;
+    }
+
+    destination.reserve(destination.size() + count);
+    while (reversed != nullptr) {
+      auto next = reversed->next;
+      destination.push_back(std::move(reversed->value));
+      delete reversed;
+      reversed = next;
+    }
+
+    return count;
+  }
+
+  /*
+   * Returns `true` if there is nothing to drain at this moment.
+   * The result is only a hint when producers are active.
+   */
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  struct Node {
+    T value;
+    Node* next;
+  };
+
+  std::atomic<Node*> head_{nullptr};
+};
+
+} // namespace facebook::react
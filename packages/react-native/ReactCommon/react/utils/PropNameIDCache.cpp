@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropNameIDCache.h"
+
+namespace facebook::react {
+
+const void* PropNameIDCache::getOrCreate(
+    jsi::Runtime& runtime,
+    std::type_index type,
+    std::shared_ptr<const void> (*create)(jsi::Runtime& runtime)) {
+  auto global = runtime.global();
+  std::shared_ptr<PropNameIDCache> cache;
+  if (global.hasNativeState<PropNameIDCache>(runtime)) {
+    cache = global.getNativeState<PropNameIDCache>(runtime);
+  } else {
+    cache = std::make_shared<PropNameIDCache>();
+    global.setNativeState(runtime, cache);
+  }
+
+  auto entry = cache->propNames_.find(type);
+  if (entry == cache->propNames_.end()) {
+    entry = cache->propNames_.emplace(type, create(runtime)).first;
+  }
+  return entry->second.get();
+}
+
+} // namespace facebook::react
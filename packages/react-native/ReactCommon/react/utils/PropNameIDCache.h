@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Per-runtime cache of `jsi::PropNameID`s.
+ * Used to convert high-frequency payloads (pointer, touch, scroll events) to
+ * JSI objects without re-creating property names from C strings every time.
+ *
+ * Property names are grouped in structs with a `jsi::PropNameID` field per
+ * name and a constructor taking the runtime, e.g.:
+ *
+ *   struct PointPropNames {
+ *     explicit PointPropNames(jsi::Runtime& runtime)
+ *         : x(jsi::PropNameID::forAscii(runtime, "x")),
+ *           y(jsi::PropNameID::forAscii(runtime, "y")) {}
+ *
+ *     jsi::PropNameID x;
+ *     jsi::PropNameID y;
+ *   };
+ *
+ *   const auto& names = PropNameIDCache::get<PointPropNames>(runtime);
+ *   object.setProperty(runtime, names.x, point.x);
+ *
+ * The cache is attached to the runtime's global object as native state, so it
+ * is never exposed to JavaScript and is released together with the runtime.
+ */
+class PropNameIDCache : public jsi::NativeState {
+ public:
+  /*
+   * Returns the `PropNames` of the given runtime, creating them on first use.
+   * The reference stays valid as long as the runtime.
+   * Must be called on the JavaScript thread.
+   */
+  template <typename PropNames>
+  static const PropNames& get(jsi::Runtime& runtime) {
+    return *static_cast<const PropNames*>(getOrCreate(
+        runtime, typeid(PropNames), [](jsi::Runtime& runtime) {
+          return std::shared_ptr<const void>(
+              std::make_shared<const PropNames>(runtime));
+        }));
+  }
+
+ private:
+  static const void* getOrCreate(
+      jsi::Runtime& runtime,
+      std::type_index type,
+      std::shared_ptr<const void> (*create)(jsi::Runtime& runtime));
+
+  std::unordered_map<std::type_index, std::shared_ptr<const void>> propNames_;
+};
+
+} // namespace facebook::react
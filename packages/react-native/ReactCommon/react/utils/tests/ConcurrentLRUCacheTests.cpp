@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/ConcurrentLRUCache.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(ConcurrentLRUCacheTests, testGetAndSet) {
+  auto cache = ConcurrentLRUCache<int, std::string>{16};
+
+  EXPECT_FALSE(cache.get(1).has_value());
+
+  cache.set(1, "one");
+  EXPECT_EQ(cache.get(1), "one");
+
+  cache.set(1, "uno");
+  EXPECT_EQ(cache.get(1), "uno");
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(ConcurrentLRUCacheTests, testClear) {
+  auto cache = ConcurrentLRUCache<int, int>{16};
+  cache.set(1, 1);
+  cache.set(2, 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.get(1).has_value());
+
+  cache.set(1, 3);
+  EXPECT_EQ(cache.get(1), 3);
+}
+
+TEST(ConcurrentLRUCacheTests, testGeneratorIsCalledOnce) {
+  auto cache = ConcurrentLRUCache<int, int>{16};
+  auto calls = 0;
+  auto generator = [&](const int& key) {
+    calls++;
+    return key * 2;
+  };
+
+  EXPECT_EQ(cache.get(21, generator), 42);
+  EXPECT_EQ(cache.get(21, generator), 42);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ConcurrentLRUCacheTests, testEvictsLeastRecentlyUsed) {
+  // A single shard makes eviction order deterministic.
+  auto cache = ConcurrentLRUCache<int, int>{2, 1};
+
+  cache.set(1, 1);
+  cache.set(2, 2);
+  // Touching `1` makes `2` the least recently used entry.
+  EXPECT_TRUE(cache.get(1).has_value());
+  cache.set(3, 3);
+
+  EXPECT_TRUE(cache.get(1).has_value());
+  EXPECT_FALSE(cache.get(2).has_value());
+  EXPECT_TRUE(cache.get(3).has_value());
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(ConcurrentLRUCacheTests, testNeverExceedsMaxSize) {
+  auto cache = ConcurrentLRUCache<int, int>{64};
+  for (int i = 0; i < 1000; i++) {
+    cache.set(i, i);
+  }
+  EXPECT_LE(cache.size(), 64);
+
+  // `maxSize` isn't a multiple of the shard count.
+  auto unevenCache = ConcurrentLRUCache<int, int>{10, 8};
+  for (int i = 0; i < 1000; i++) {
+    unevenCache.set(i, i);
+  }
+  EXPECT_LE(unevenCache.size(), 10);
+}
+
+TEST(ConcurrentLRUCacheTests, testGeneratorExceptionIsPropagated) {
+  auto cache = ConcurrentLRUCache<int, int>{16};
+
+  EXPECT_THROW(
+      cache.get(
+          1, [](const int& /*key*/) -> int { throw std::runtime_error(""); }),
+      std::runtime_error);
+
+  // A failed generation isn't cached and doesn't block future attempts.
+  EXPECT_FALSE(cache.get(1).has_value());
+  EXPECT_EQ(cache.get(1, [](const int& key) { return key; }), 1);
+}
+
+TEST(ConcurrentLRUCacheTests, testInFlightGenerationIsShared) {
+  auto cache = ConcurrentLRUCache<int, int>{16};
+  auto calls = std::atomic<int>{0};
+  auto generator = [&](const int& key) {
+    calls++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return key;
+  };
+
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&]() { EXPECT_EQ(cache.get(7, generator), 7); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ConcurrentLRUCacheTests, testGeneratorCanAskForItsOwnKey) {
+  auto cache = ConcurrentLRUCache<int, int>{16};
+  auto generator = [&](const int& key) {
+    return cache.get(key, [](const int& key) { return key; }) + 1;
+  };
+
+  EXPECT_EQ(cache.get(1, generator), 2);
+  EXPECT_EQ(cache.get(1), 2);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/LockFreeMPSCQueue.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(LockFreeMPSCQueueTests, testDrainPreservesPushOrder) {
+  auto queue = LockFreeMPSCQueue<int>{};
+  EXPECT_TRUE(queue.empty());
+
+  for (int i = 0; i < 5; i++) {
+    queue.push(int{i});
+  }
+  EXPECT_FALSE(queue.empty());
+
+  auto values = std::vector<int>{};
+  EXPECT_EQ(queue.drain(values), 5);
+  EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.drain(values), 0);
+}
+
+TEST(LockFreeMPSCQueueTests, testMoveOnlyValues) {
+  auto queue = LockFreeMPSCQueue<std::unique_ptr<int>>{};
+  queue.push(std::make_unique<int>(42));
+
+  auto values = std::vector<std::unique_ptr<int>>{};
+  queue.drain(values);
+  EXPECT_EQ(values.size(), 1);
+  EXPECT_EQ(*values[0], 42);
+
+  // Undrained values are released by the destructor.
+  queue.push(std::make_unique<int>(1));
+}
+
+TEST(LockFreeMPSCQueueTests, testConcurrentProducers) {
+  constexpr int kProducerCount = 4;
+  constexpr int kValuesPerProducer = 10000;
+
+  auto queue = LockFreeMPSCQueue<std::pair<int, int>>{};
+  auto producers = std::vector<std::thread>{};
+  for (int producer = 0; producer < kProducerCount; producer++) {
+    producers.emplace_back([&queue, producer]() {
+      for (int i = 0; i < kValuesPerProducer; i++) {
+        queue.push({producer, i});
+      }
+    });
+  }
+
+  auto values = std::vector<std::pair<int, int>>{};
+  while (values.size() < kProducerCount * kValuesPerProducer) {
+    queue.drain(values);
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  // Values pushed by the same producer keep their relative order.
+  auto lastValues = std::vector<int>(kProducerCount, -1);
+  for (const auto& [producer, value] : values) {
+    EXPECT_EQ(value, lastValues[producer] + 1);
+    lastValues[producer] = value;
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/utils/ConcurrentLRUCache.h>
+#include <react/utils/SimpleThreadSafeCache.h>
+#include <chrono>
+#include <memory>
+
+namespace facebook::react {
+
+constexpr auto kCacheSize = size_t{1024};
+
+// Number of distinct keys; larger than the cache so that some lookups miss,
+// like measurements of text on several concurrently laid out surfaces.
+constexpr auto kKeyCount = 1536;
+
+/*
+ * Stand-in for a platform text measurement: a busy wait of a few
+ * microseconds.
+ */
+int measure(const int& key) {
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::microseconds(5);
+  while (std::chrono::steady_clock::now() < deadline) {
+  }
+  return key;
+}
+
+std::unique_ptr<SimpleThreadSafeCache<int, int, kCacheSize>> simpleCache;
+std::unique_ptr<ConcurrentLRUCache<int, int>> concurrentCache;
+
+static void simpleThreadSafeCache(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    simpleCache =
+        std::make_unique<SimpleThreadSafeCache<int, int, kCacheSize>>();
+  }
+
+  auto key = state.thread_index() * 7919;
+  for (auto _ : state) {
+    key = (key + 31) % kKeyCount;
+    benchmark::DoNotOptimize(simpleCache->get(key, measure));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(simpleThreadSafeCache)->ThreadRange(1, 8)->UseRealTime();
+
+static void concurrentLRUCache(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    concurrentCache =
+        std::make_unique<ConcurrentLRUCache<int, int>>(kCacheSize);
+  }
+
+  auto key = state.thread_index() * 7919;
+  for (auto _ : state) {
+    key = (key + 31) % kKeyCount;
+    benchmark::DoNotOptimize(concurrentCache->get(key, measure));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(concurrentLRUCache)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -114,6 +114,16 @@ const definitions: FeatureFlagDefinitions = {
         purpose: 'release',
       },
     },
+    enableBinaryNativeCallQueue: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-19',
+        description:
+          'Enables handing native module calls over from JavaScript to JSIExecutor as ArrayBuffers instead of arrays of JS values.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+    },
     enableBridgelessArchitecture: {
       defaultValue: false,
       metadata: {
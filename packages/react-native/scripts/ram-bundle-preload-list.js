@@ -0,0 +1,77 @@
+#!/usr/bin/env node
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @noflow
+ * @format
+ */
+
+'use strict';
+
+// Turns a module load trace recorded by ModuleLoadTrace into a preload list:
+// the modules in the order in which they were first loaded, as
+// "<bundle id> <module id>" lines. See ReactCommon/cxxreact/ModuleLoadTrace.h.
+
+const fs = require('fs');
+
+const MAGIC_NUMBER = 0x544d4e52; // "RNMT"
+const VERSION = 1;
+const HEADER_SIZE = 8;
+const EVENT_SIZE = 24;
+
+const argv = process.argv.slice(2);
+let untilMs = Infinity;
+for (let i = 0; i < argv.length; ) {
+  if (argv[i] === '--until-ms') {
+    untilMs = Number(argv[i + 1]);
+    argv.splice(i, 2);
+    continue;
+  }
+  ++i;
+}
+
+if (argv.length !== 1 || Number.isNaN(untilMs)) {
+  process.stderr.write(
+    'Usage: node ram-bundle-preload-list.js <trace_file> [--until-ms ms]\n',
+  );
+  process.exitCode = -1;
+} else {
+  const data = fs.readFileSync(argv[0]);
+  if (
+    data.length < HEADER_SIZE ||
+    (data.length - HEADER_SIZE) % EVENT_SIZE !== 0 ||
+    data.readUInt32LE(0) !== MAGIC_NUMBER ||
+    data.readUInt32LE(4) !== VERSION
+  ) {
+    process.stderr.write(`${argv[0]} is not a module load trace\n`);
+    process.exitCode = -1;
+  } else {
+    const until =
+      untilMs === Infinity ? null : BigInt(Math.floor(untilMs * 1e6));
+    const seen = new Set();
+    const threads = new Set();
+    const lines = [];
+    let bytes = 0;
+    for (let offset = HEADER_SIZE; offset < data.length; offset += EVENT_SIZE) {
+      if (until != null && data.readBigUInt64LE(offset) > until) {
+        continue;
+      }
+      const bundleId = data.readUInt32LE(offset + 8);
+      const moduleId = data.readUInt32LE(offset + 12);
+      const key = `${bundleId} ${moduleId}`;
+      threads.add(data.readUInt32LE(offset + 20));
+      if (!seen.has(key)) {
+        seen.add(key);
+        bytes += data.readUInt32LE(offset + 16);
+        lines.push(key);
+      }
+    }
+    process.stdout.write(lines.map(line => line + '\n').join(''));
+    process.stderr.write(
+      `${lines.length} modules, ${bytes} bytes, loaded on ${threads.size} threads\n`,
+    );
+  }
+}